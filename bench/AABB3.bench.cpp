@@ -0,0 +1,76 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+#include "AABB3.hpp"
+
+using Calcda::AABB3;
+using Calcda::Vector3;
+
+namespace {
+// unit-sized boxes scattered in front of the ray origin
+std::vector<AABB3> generateRandomBoxes(std::size_t count, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<float> distribution(-20.0f, 20.0f);
+
+    std::vector<AABB3> result;
+    result.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+        result.push_back(AABB3::fromCenter(
+            Vector3(distribution(gen), distribution(gen), distribution(gen)),
+            Vector3::One));
+
+    return result;
+}
+
+const Vector3 RayOrigin(-30.0f, 0.5f, 0.25f), RayDirection(1.0f, 0.1f, 0.05f);
+} // namespace
+
+static void BM_AABB3Merge(benchmark::State &state) {
+    const auto boxes = generateRandomBoxes(state.range(0), 1234);
+
+    for (auto _ : state) {
+        AABB3 bounds;
+        for (const auto &box : boxes)
+            bounds.selfMerge(box);
+
+        benchmark::DoNotOptimize(bounds);
+    }
+
+    state.SetItemsProcessed(state.iterations() * boxes.size());
+}
+BENCHMARK(BM_AABB3Merge)->Arg(1 << 12);
+
+static void BM_AABB3IntersectRay(benchmark::State &state) {
+    const auto boxes = generateRandomBoxes(state.range(0), 1234);
+    std::vector<float> distances(boxes.size());
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < boxes.size(); ++i) {
+            const auto distance =
+                boxes[i].intersectRay(RayOrigin, RayDirection);
+            distances[i] = distance ? *distance : INFINITY;
+        }
+
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * boxes.size());
+}
+BENCHMARK(BM_AABB3IntersectRay)->Arg(1 << 12);
+
+static void BM_AABB3IntersectRayBatch(benchmark::State &state) {
+    const auto boxes = generateRandomBoxes(state.range(0), 1234);
+    std::vector<float> distances(boxes.size());
+
+    for (auto _ : state) {
+        AABB3::intersectRayBatch(RayOrigin, RayDirection, boxes.data(),
+                                 boxes.size(), distances.data());
+
+        benchmark::DoNotOptimize(distances.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * boxes.size());
+}
+BENCHMARK(BM_AABB3IntersectRayBatch)->Arg(1 << 12);
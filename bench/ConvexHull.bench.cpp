@@ -0,0 +1,124 @@
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "ConvexHull.hpp"
+
+using Calcda::Vector2;
+using Calcda::Vector3;
+
+namespace {
+constexpr float TwoPi = 6.2831853f;
+
+std::vector<Vector2> generateSquarePoints(std::size_t count) {
+    std::mt19937 gen(1234);
+    std::uniform_real_distribution<float> distribution(0.0f, 1000.0f);
+
+    std::vector<Vector2> result(count);
+    for (auto &point : result)
+        point = Vector2(distribution(gen), distribution(gen));
+
+    return result;
+}
+
+// every point is on the hull, so the filter drops none of them
+std::vector<Vector2> generateCirclePoints(std::size_t count) {
+    std::mt19937 gen(1234);
+    std::uniform_real_distribution<float> distribution(0.0f, TwoPi);
+
+    std::vector<Vector2> result(count);
+    for (auto &point : result) {
+        const float angle = distribution(gen);
+        point = Vector2(500.0f * std::cos(angle), 500.0f * std::sin(angle));
+    }
+
+    return result;
+}
+
+std::vector<Vector3> generateCubePoints(std::size_t count) {
+    std::mt19937 gen(1234);
+    std::uniform_real_distribution<float> distribution(0.0f, 1000.0f);
+
+    std::vector<Vector3> result(count);
+    for (auto &point : result)
+        point = Vector3(distribution(gen), distribution(gen),
+                        distribution(gen));
+
+    return result;
+}
+
+std::vector<Vector3> generateSpherePoints(std::size_t count) {
+    std::mt19937 gen(1234);
+    std::normal_distribution<float> distribution;
+
+    std::vector<Vector3> result(count);
+    for (auto &point : result)
+        point = Vector3(distribution(gen), distribution(gen),
+                        distribution(gen))
+                    .normalize() *
+                Vector3(500.0f, 500.0f, 500.0f);
+
+    return result;
+}
+} // namespace
+
+static void BM_ConvexHullSquare(benchmark::State &state) {
+    const auto points = generateSquarePoints(state.range(0));
+    const auto threads = static_cast<unsigned int>(state.range(1));
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(Calcda::computeConvexHull(points, threads));
+
+    state.SetItemsProcessed(state.iterations() * points.size());
+}
+BENCHMARK(BM_ConvexHullSquare)
+    ->ArgNames({"points", "threads"})
+    ->Args({1 << 20, 1})
+    ->Args({1 << 20, 4})
+    ->Args({1 << 23, 1})
+    ->Args({1 << 23, 4})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+static void BM_ConvexHullCircle(benchmark::State &state) {
+    const auto points = generateCirclePoints(state.range(0));
+    const auto threads = static_cast<unsigned int>(state.range(1));
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(Calcda::computeConvexHull(points, threads));
+
+    state.SetItemsProcessed(state.iterations() * points.size());
+}
+BENCHMARK(BM_ConvexHullCircle)
+    ->ArgNames({"points", "threads"})
+    ->Args({1 << 20, 1})
+    ->Args({1 << 20, 4})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+static void BM_ConvexHullCube(benchmark::State &state) {
+    const auto points = generateCubePoints(state.range(0));
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(Calcda::computeConvexHull(points));
+
+    state.SetItemsProcessed(state.iterations() * points.size());
+}
+BENCHMARK(BM_ConvexHullCube)
+    ->Arg(1 << 16)
+    ->Arg(1 << 20)
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_ConvexHullSphere(benchmark::State &state) {
+    const auto points = generateSpherePoints(state.range(0));
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(Calcda::computeConvexHull(points));
+
+    state.SetItemsProcessed(state.iterations() * points.size());
+}
+BENCHMARK(BM_ConvexHullSphere)
+    ->Arg(1 << 12)
+    ->Arg(1 << 16)
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,106 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+#include "Frustum.hpp"
+
+using Calcda::Frustum;
+using Calcda::Matrix4;
+using Calcda::Vector3;
+using Calcda::Vector3SoA;
+
+namespace {
+Frustum generateFrustum() {
+    return Frustum(Matrix4::perspective(0.5f, 16.0f / 9.0f, 0.1f, 100.0f) *
+                   Matrix4::lookAt(Vector3(0.0f, 2.0f, 5.0f), Vector3::Zero,
+                                   Vector3::UnitY));
+}
+
+// objects around the camera, about a third of them visible
+Vector3SoA generateRandomPoints(std::size_t count, unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<float> distribution(-60.0f, 60.0f);
+
+    Vector3SoA result;
+    result.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+        result.append(
+            Vector3(distribution(gen), distribution(gen), distribution(gen)));
+
+    return result;
+}
+} // namespace
+
+static void BM_FrustumSpheres(benchmark::State &state) {
+    const auto frustum = generateFrustum();
+    const auto centers = generateRandomPoints(state.range(0), 1234);
+    const std::vector<float> radii(centers.size(), 1.0f);
+    std::vector<bool> visible(centers.size());
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < centers.size(); ++i)
+            visible[i] = frustum.intersectsSphere(centers.get(i), radii[i]);
+
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * centers.size());
+}
+BENCHMARK(BM_FrustumSpheres)->Arg(1 << 14);
+
+static void BM_FrustumSpheresBatch(benchmark::State &state) {
+    const auto frustum = generateFrustum();
+    const auto centers = generateRandomPoints(state.range(0), 1234);
+    const std::vector<float> radii(centers.size(), 1.0f);
+    std::vector<std::uint32_t> masks((centers.size() + 31) / 32);
+
+    for (auto _ : state) {
+        frustum.intersectsSpheres(centers, radii.data(), masks.data());
+
+        benchmark::DoNotOptimize(masks.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * centers.size());
+}
+BENCHMARK(BM_FrustumSpheresBatch)->Arg(1 << 14);
+
+static void BM_FrustumBoxes(benchmark::State &state) {
+    const auto frustum = generateFrustum();
+    const auto mins = generateRandomPoints(state.range(0), 1234);
+    auto maxs = mins;
+    for (auto *stream : {&maxs.x, &maxs.y, &maxs.z})
+        for (auto &value : *stream)
+            value += 2.0f;
+    std::vector<bool> visible(mins.size());
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < mins.size(); ++i)
+            visible[i] = frustum.intersectsBox(mins.get(i), maxs.get(i));
+
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * mins.size());
+}
+BENCHMARK(BM_FrustumBoxes)->Arg(1 << 14);
+
+static void BM_FrustumBoxesBatch(benchmark::State &state) {
+    const auto frustum = generateFrustum();
+    const auto mins = generateRandomPoints(state.range(0), 1234);
+    auto maxs = mins;
+    for (auto *stream : {&maxs.x, &maxs.y, &maxs.z})
+        for (auto &value : *stream)
+            value += 2.0f;
+    std::vector<std::uint32_t> masks((mins.size() + 31) / 32);
+
+    for (auto _ : state) {
+        frustum.intersectsBoxes(mins, maxs, masks.data());
+
+        benchmark::DoNotOptimize(masks.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * mins.size());
+}
+BENCHMARK(BM_FrustumBoxesBatch)->Arg(1 << 14);
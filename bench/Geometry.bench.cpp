@@ -0,0 +1,611 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "BoundingVolumeHierarchy.hpp"
+#include "Geometry.hpp"
+#include "Predicates.hpp"
+#include "SegmentIntersection.hpp"
+
+using Calcda::BoundingVolumeHierarchy;
+using Calcda::Circle;
+using Calcda::computePolygonMetrics;
+using Calcda::Line;
+using Calcda::LineType;
+using Calcda::PointSpan;
+using Calcda::Polygon;
+using Calcda::PolygonMetrics;
+using Calcda::PolygonView;
+using Calcda::PreparedPolygon;
+using Calcda::Shape;
+using Calcda::Summation;
+using Calcda::Vector2;
+using Calcda::Vector2SoA;
+
+namespace {
+constexpr float WorldSize = 1000.0f;
+
+std::vector<Vector2> generateRandomPoints(std::size_t count,
+                                          unsigned seed = 1234) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<float> distribution(0.0f, WorldSize);
+
+    std::vector<Vector2> result(count);
+    for (auto &point : result)
+        point = Vector2(distribution(gen), distribution(gen));
+
+    return result;
+}
+
+std::vector<Circle> generateRandomCircles(std::size_t count) {
+    std::vector<Circle> result;
+    for (const auto &origin : generateRandomPoints(count))
+        result.emplace_back(origin, 2.0f);
+
+    return result;
+}
+
+std::vector<Polygon> generateRandomTriangles(std::size_t count) {
+    std::vector<Polygon> result;
+    for (const auto &origin : generateRandomPoints(count))
+        result.push_back(Polygon{origin, origin + Vector2(4.0f, 0.0f),
+                                 origin + Vector2(0.0f, 4.0f)});
+
+    return result;
+}
+
+std::vector<Vector2> generateStarPolygon(std::size_t count) {
+    std::mt19937 gen(1234);
+    std::uniform_real_distribution<float> distribution(0.2f, 0.5f);
+
+    std::vector<Vector2> result(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        const float angle = static_cast<float>(i) * 6.2831853f / count,
+                    radius = distribution(gen) * WorldSize;
+
+        result[i] = Vector2(0.5f * WorldSize + std::cos(angle) * radius,
+                            0.5f * WorldSize + std::sin(angle) * radius);
+    }
+
+    return result;
+}
+
+// short segments, as in road networks, with O(n) intersections
+std::vector<Vector2> generateRandomSegments(std::size_t count) {
+    auto result = generateRandomPoints(2 * count);
+    std::mt19937 gen(4321);
+    std::uniform_real_distribution<float> distribution(-10.0f, 10.0f);
+
+    for (std::size_t i = 0; i < count; ++i)
+        result[2 * i + 1] =
+            result[2 * i] + Vector2(distribution(gen), distribution(gen));
+
+    return result;
+}
+} // namespace
+
+static void BM_ShapePointQueryLinear(benchmark::State &state) {
+    const auto circles = generateRandomCircles(state.range(0));
+    const auto queries = generateRandomPoints(256, 4321);
+    std::vector<std::size_t> hits;
+
+    for (auto _ : state) {
+        for (const auto &query : queries) {
+            hits.clear();
+            for (std::size_t i = 0; i < circles.size(); ++i)
+                if (circles[i].isPointInside(query))
+                    hits.push_back(i);
+
+            benchmark::DoNotOptimize(hits.data());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * queries.size());
+}
+BENCHMARK(BM_ShapePointQueryLinear)->Arg(1 << 14);
+
+static void BM_ShapePointQueryHierarchy(benchmark::State &state) {
+    const auto circles = generateRandomCircles(state.range(0));
+    const auto queries = generateRandomPoints(256, 4321);
+    const BoundingVolumeHierarchy hierarchy(circles);
+
+    for (auto _ : state) {
+        for (const auto &query : queries) {
+            auto hits = hierarchy.queryPoint(query);
+            benchmark::DoNotOptimize(hits.data());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * queries.size());
+}
+BENCHMARK(BM_ShapePointQueryHierarchy)->Arg(1 << 14);
+
+static void BM_ShapeRayQueryLinear(benchmark::State &state) {
+    const auto triangles = generateRandomTriangles(state.range(0));
+    const auto origins = generateRandomPoints(64, 4321);
+
+    for (auto _ : state) {
+        for (const auto &origin : origins) {
+            float closest = INFINITY;
+            for (const auto &triangle : triangles)
+                for (const auto &point : triangle.intersectLine(
+                         origin, origin + Vector2(1.0f, 0.5f), LineType::RAY))
+                    closest =
+                        std::min(closest, (point - origin).lengthSquared());
+
+            benchmark::DoNotOptimize(closest);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * origins.size());
+}
+BENCHMARK(BM_ShapeRayQueryLinear)->Arg(1 << 14);
+
+static void BM_ShapeRayQueryHierarchy(benchmark::State &state) {
+    const auto triangles = generateRandomTriangles(state.range(0));
+    const auto origins = generateRandomPoints(64, 4321);
+    const BoundingVolumeHierarchy hierarchy(triangles);
+
+    for (auto _ : state) {
+        for (const auto &origin : origins) {
+            auto hit = hierarchy.intersectLineClosest(
+                origin, origin + Vector2(1.0f, 0.5f), LineType::RAY);
+            benchmark::DoNotOptimize(hit);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * origins.size());
+}
+BENCHMARK(BM_ShapeRayQueryHierarchy)->Arg(1 << 14);
+
+static void BM_ShapeHierarchyBuild(benchmark::State &state) {
+    const auto circles = generateRandomCircles(state.range(0));
+
+    for (auto _ : state) {
+        BoundingVolumeHierarchy hierarchy(circles);
+        benchmark::DoNotOptimize(hierarchy);
+    }
+
+    state.SetItemsProcessed(state.iterations() * circles.size());
+}
+BENCHMARK(BM_ShapeHierarchyBuild)->Arg(1 << 14);
+
+static void BM_PolygonContains(benchmark::State &state) {
+    const Polygon polygon(generateStarPolygon(state.range(0)));
+    const auto points = generateRandomPoints(4096, 4321);
+    std::vector<char> results(points.size());
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < points.size(); ++i)
+            results[i] = polygon.isPointInside(points[i]);
+
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * points.size());
+}
+BENCHMARK(BM_PolygonContains)->RangeMultiplier(4)->Range(4, 1024);
+
+static void BM_PreparedPolygonContains(benchmark::State &state) {
+    const PreparedPolygon polygon(generateStarPolygon(state.range(0)));
+    const auto points = generateRandomPoints(4096, 4321);
+    std::unique_ptr<bool[]> results(new bool[points.size()]);
+
+    for (auto _ : state) {
+        polygon.containsPoints(points.data(), results.get(), points.size());
+
+        benchmark::DoNotOptimize(results.get());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * points.size());
+}
+BENCHMARK(BM_PreparedPolygonContains)->RangeMultiplier(4)->Range(4, 1024);
+
+// the argument is the number of circles, tested against 2^16 points
+static void BM_CircleContainsLinear(benchmark::State &state) {
+    const auto circles = generateRandomCircles(state.range(0));
+    const auto points = generateRandomPoints(1 << 16, 4321);
+    std::vector<std::uint32_t> masks(circles.size() * (points.size() / 32));
+
+    for (auto _ : state) {
+        std::fill(masks.begin(), masks.end(), 0U);
+        for (std::size_t c = 0; c < circles.size(); ++c) {
+            const Shape &shape = circles[c];
+            std::uint32_t *row = masks.data() + c * (points.size() / 32);
+            for (std::size_t i = 0; i < points.size(); ++i)
+                row[i / 32] |= static_cast<std::uint32_t>(
+                                   shape.isPointInside(points[i]))
+                               << (i % 32);
+        }
+
+        benchmark::DoNotOptimize(masks.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * circles.size() *
+                            points.size());
+}
+BENCHMARK(BM_CircleContainsLinear)->Arg(16)->Arg(256);
+
+static void BM_CircleContainsPoints(benchmark::State &state) {
+    const auto circles = generateRandomCircles(state.range(0));
+    const Vector2SoA points = generateRandomPoints(1 << 16, 4321);
+    std::vector<std::uint32_t> masks(circles.size() * (points.size() / 32));
+
+    for (auto _ : state) {
+        Circle::containsPoints(circles.data(), circles.size(), points,
+                               masks.data());
+
+        benchmark::DoNotOptimize(masks.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * circles.size() *
+                            points.size());
+}
+BENCHMARK(BM_CircleContainsPoints)->Arg(16)->Arg(256);
+
+static void BM_PolygonIntersectLine(benchmark::State &state) {
+    const Polygon polygon(generateStarPolygon(state.range(0)));
+    const auto origins = generateRandomPoints(256, 4321);
+    std::size_t hits = 0;
+
+    for (auto _ : state) {
+        for (const auto &origin : origins)
+            hits += polygon
+                        .intersectLine(origin, origin + Vector2(1.0f, 0.5f),
+                                       LineType::RAY)
+                        .size();
+
+        benchmark::DoNotOptimize(hits);
+    }
+
+    state.SetItemsProcessed(state.iterations() * origins.size());
+}
+BENCHMARK(BM_PolygonIntersectLine)->Arg(16)->Arg(256);
+
+static void BM_PolygonIntersectLineBuffer(benchmark::State &state) {
+    const Polygon polygon(generateStarPolygon(state.range(0)));
+    const auto origins = generateRandomPoints(256, 4321);
+    std::vector<Vector2> buffer(polygon.getPoints().size());
+    std::size_t hits = 0;
+
+    for (auto _ : state) {
+        for (const auto &origin : origins)
+            hits += polygon.intersectLine(origin, origin + Vector2(1.0f, 0.5f),
+                                          LineType::RAY, buffer.data(),
+                                          buffer.size());
+
+        benchmark::DoNotOptimize(hits);
+    }
+
+    state.SetItemsProcessed(state.iterations() * origins.size());
+}
+BENCHMARK(BM_PolygonIntersectLineBuffer)->Arg(16)->Arg(256);
+
+// polygons of the argument number of points, from a shared vertex buffer
+static void BM_PolygonFromBuffer(benchmark::State &state) {
+    const std::size_t size = state.range(0);
+    const auto buffer = generateRandomPoints(1024 * size);
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < 1024; ++i) {
+            const Polygon polygon(std::vector<Vector2>(
+                buffer.begin() + i * size, buffer.begin() + (i + 1) * size));
+            benchmark::DoNotOptimize(polygon);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * 1024);
+}
+BENCHMARK(BM_PolygonFromBuffer)->Arg(16)->Arg(256);
+
+static void BM_PolygonViewFromBuffer(benchmark::State &state) {
+    const std::size_t size = state.range(0);
+    const auto buffer = generateRandomPoints(1024 * size);
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < 1024; ++i) {
+            const PolygonView polygon(buffer.data() + i * size, size);
+            benchmark::DoNotOptimize(polygon);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * 1024);
+}
+BENCHMARK(BM_PolygonViewFromBuffer)->Arg(16)->Arg(256);
+
+// metrics of a polygon of the first argument number of points, summed fast (0)
+// or compensated (1)
+static void BM_PolygonMetrics(benchmark::State &state) {
+    const auto points = generateRandomPoints(state.range(0));
+    const auto mode =
+        state.range(1) ? Summation::COMPENSATED : Summation::FAST;
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(computePolygonMetrics(points, mode));
+
+    state.SetItemsProcessed(state.iterations() * points.size());
+}
+BENCHMARK(BM_PolygonMetrics)
+    ->ArgNames({"points", "compensated"})
+    ->Args({256, 0})
+    ->Args({256, 1})
+    ->Args({65536, 0})
+    ->Args({65536, 1});
+
+// metrics of 4096 polygons of 64 points each, from a shared vertex buffer
+static void BM_PolygonMetricsBatch(benchmark::State &state) {
+    constexpr std::size_t Count = 4096, Size = 64;
+    const auto buffer = generateRandomPoints(Count * Size);
+    const auto threads = static_cast<unsigned int>(state.range(0));
+
+    std::vector<PointSpan> polygons;
+    for (std::size_t i = 0; i < Count; ++i)
+        polygons.emplace_back(buffer.data() + i * Size, Size);
+    std::vector<PolygonMetrics> metrics(Count);
+
+    for (auto _ : state) {
+        computePolygonMetrics(polygons.data(), Count, metrics.data(),
+                              Summation::FAST, threads);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * Count);
+}
+BENCHMARK(BM_PolygonMetricsBatch)
+    ->ArgName("threads")
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->UseRealTime();
+
+static void BM_LineIntersectRaw(benchmark::State &state) {
+    const auto first = generateRandomPoints(2 * state.range(0), 1);
+    const auto second = generateRandomPoints(2 * state.range(0), 2);
+    std::size_t hits = 0;
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < first.size(); i += 2)
+            for (std::size_t j = 0; j < second.size(); j += 2)
+                hits += Line::intersectRaw(first[i], first[i + 1],
+                                           LineType::SEGMENT, second[j],
+                                           second[j + 1], LineType::SEGMENT)
+                            .has_value();
+
+        benchmark::DoNotOptimize(hits);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0) *
+                            state.range(0));
+}
+BENCHMARK(BM_LineIntersectRaw)->Arg(1024);
+
+// random points, which the double precision filter decides
+static void BM_PredicateOrient2d(benchmark::State &state) {
+    const auto points = generateRandomPoints(3 * state.range(0));
+    double total = 0.0;
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < points.size(); i += 3)
+            total += Calcda::Predicates::orient2d(points[i], points[i + 1],
+                                                  points[i + 2]);
+
+        benchmark::DoNotOptimize(total);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PredicateOrient2d)->Arg(1024);
+
+// collinear points, which take the exact path
+static void BM_PredicateOrient2dCollinear(benchmark::State &state) {
+    auto points = generateRandomPoints(3 * state.range(0));
+    for (std::size_t i = 0; i < points.size(); i += 3)
+        points[i + 2] = Vector2(0.25f * points[i].x + 0.75f * points[i + 1].x,
+                                0.25f * points[i].y + 0.75f * points[i + 1].y);
+    double total = 0.0;
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < points.size(); i += 3)
+            total += Calcda::Predicates::orient2d(points[i], points[i + 1],
+                                                  points[i + 2]);
+
+        benchmark::DoNotOptimize(total);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PredicateOrient2dCollinear)->Arg(1024);
+
+// exactly collinear points, like the shared vertices and collinear edges of
+// polygons and grids, which the exact path answers from the products
+static void BM_PredicateOrient2dExactlyCollinear(benchmark::State &state) {
+    auto points = generateRandomPoints(3 * state.range(0));
+    for (std::size_t i = 0; i < points.size(); i += 3) {
+        points[i] = Vector2(std::round(points[i].x), std::round(points[i].y));
+        points[i + 1] = points[i] + Vector2(3.0f, 7.0f);
+        points[i + 2] = points[i] + Vector2(6.0f, 14.0f);
+    }
+    double total = 0.0;
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < points.size(); i += 3)
+            total += Calcda::Predicates::orient2d(points[i], points[i + 1],
+                                                  points[i + 2]);
+
+        benchmark::DoNotOptimize(total);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PredicateOrient2dExactlyCollinear)->Arg(1024);
+
+static void BM_PredicateIncircle(benchmark::State &state) {
+    const auto points = generateRandomPoints(4 * state.range(0));
+    double total = 0.0;
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < points.size(); i += 4)
+            total += Calcda::Predicates::incircle(
+                points[i], points[i + 1], points[i + 2], points[i + 3]);
+
+        benchmark::DoNotOptimize(total);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_PredicateIncircle)->Arg(1024);
+
+static void BM_LineIntersectBatch(benchmark::State &state) {
+    const auto first = generateRandomPoints(2 * state.range(0), 1);
+    const auto second = generateRandomPoints(2 * state.range(0), 2);
+    std::vector<Calcda::LineIntersection> hits;
+
+    for (auto _ : state) {
+        hits.clear();
+        Line::intersectBatch<LineType::SEGMENT, LineType::SEGMENT>(
+            first.data(), state.range(0), second.data(), state.range(0), hits);
+
+        benchmark::DoNotOptimize(hits.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0) *
+                            state.range(0));
+}
+BENCHMARK(BM_LineIntersectBatch)->Arg(1024);
+
+static void BM_SegmentIntersectionsPairwise(benchmark::State &state) {
+    const auto segments = generateRandomSegments(state.range(0));
+    std::vector<Calcda::LineIntersection> hits;
+
+    for (auto _ : state) {
+        hits.clear();
+        Line::intersectBatch<LineType::SEGMENT, LineType::SEGMENT>(
+            segments.data(), state.range(0), segments.data(), state.range(0),
+            hits);
+
+        benchmark::DoNotOptimize(hits.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SegmentIntersectionsPairwise)->Arg(1 << 12);
+
+static void BM_SegmentIntersectionsSweep(benchmark::State &state) {
+    const auto segments = generateRandomSegments(state.range(0));
+
+    for (auto _ : state) {
+        auto hits = Calcda::intersectSegments(segments.data(), state.range(0));
+        benchmark::DoNotOptimize(hits.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SegmentIntersectionsSweep)->Arg(1 << 12)->Arg(1 << 16);
+
+// the argument is the LineType of the query lines
+static void BM_CircleIntersectLine(benchmark::State &state) {
+    const auto circles = generateRandomCircles(1024);
+    const auto points = generateRandomPoints(2 * circles.size(), 4321);
+    const auto type = static_cast<LineType>(state.range(0));
+    std::size_t hits = 0;
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < circles.size(); ++i)
+            hits += circles[i]
+                        .intersectLine(points[2 * i], points[2 * i + 1], type)
+                        .size();
+
+        benchmark::DoNotOptimize(hits);
+    }
+
+    state.SetItemsProcessed(state.iterations() * circles.size());
+}
+BENCHMARK(BM_CircleIntersectLine)
+    ->ArgName("type")
+    ->DenseRange(static_cast<int>(LineType::LINE),
+                 static_cast<int>(LineType::SEGMENT));
+
+// rays from the middle of the world, against the argument number of circles
+static void BM_CircleIntersectRaysLinear(benchmark::State &state) {
+    const auto circles = generateRandomCircles(state.range(0));
+    const auto targets = generateRandomPoints(256, 4321);
+    const Vector2 origin(WorldSize / 2.0f, WorldSize / 2.0f);
+    Vector2 points[Circle::MaxIntersections];
+    std::size_t hits = 0;
+
+    for (auto _ : state) {
+        for (const auto &target : targets)
+            for (const auto &circle : circles)
+                hits += circle.intersectLine(origin, target, LineType::RAY,
+                                             points, Circle::MaxIntersections);
+
+        benchmark::DoNotOptimize(hits);
+    }
+
+    state.SetItemsProcessed(state.iterations() * targets.size() *
+                            circles.size());
+}
+BENCHMARK(BM_CircleIntersectRaysLinear)->Arg(64)->Arg(1024);
+
+static void BM_CircleIntersectRays(benchmark::State &state) {
+    const auto circles = generateRandomCircles(state.range(0));
+    const auto targets = generateRandomPoints(256, 4321);
+    const Vector2 origin(WorldSize / 2.0f, WorldSize / 2.0f);
+
+    Vector2SoA origins, directions, centers;
+    for (const auto &target : targets) {
+        origins.append(origin);
+        directions.append(target - origin);
+    }
+
+    std::vector<float> radii;
+    for (const auto &circle : circles) {
+        centers.append(circle.getOrigin());
+        radii.push_back(circle.getRadius());
+    }
+
+    const std::size_t size = targets.size() * circles.size();
+    std::vector<float> entries(size), exits(size);
+    std::vector<Vector2> entryPoints(size), exitPoints(size);
+
+    for (auto _ : state) {
+        Circle::intersectLines<LineType::RAY>(
+            origins, directions, centers, radii.data(), entries.data(),
+            exits.data(), entryPoints.data(), exitPoints.data());
+
+        benchmark::DoNotOptimize(entries.data());
+        benchmark::DoNotOptimize(entryPoints.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK(BM_CircleIntersectRays)->Arg(64)->Arg(1024);
+
+static void BM_LineIntersectLine(benchmark::State &state) {
+    const auto points = generateRandomPoints(2048);
+    const Line line(points[0], points[1], LineType::SEGMENT);
+    const auto type = static_cast<LineType>(state.range(0));
+    std::size_t hits = 0;
+
+    for (auto _ : state) {
+        for (std::size_t i = 2; i < points.size(); i += 2)
+            hits += line.intersectLine(points[i], points[i + 1], type).size();
+
+        benchmark::DoNotOptimize(hits);
+    }
+
+    state.SetItemsProcessed(state.iterations() * (points.size() / 2 - 1));
+}
+BENCHMARK(BM_LineIntersectLine)
+    ->ArgName("type")
+    ->DenseRange(static_cast<int>(LineType::LINE),
+                 static_cast<int>(LineType::SEGMENT));
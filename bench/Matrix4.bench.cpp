@@ -0,0 +1,284 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+#include "Matrix4.hpp"
+
+using Calcda::Axis;
+using Calcda::Matrix4;
+using Calcda::Matrix4d;
+using Calcda::Vector3;
+using Calcda::Vector3d;
+using Calcda::Vector4;
+
+namespace {
+std::vector<Matrix4> generateRandomMatrices(std::size_t count) {
+    std::mt19937 gen(1234);
+    std::uniform_real_distribution<float> distribution(-2.0f, 2.0f);
+
+    std::vector<Matrix4> result(count);
+    for (auto &matrix : result)
+        for (auto &element : matrix.value.data)
+            element = distribution(gen);
+
+    return result;
+}
+
+// rotations followed by translations
+std::vector<Matrix4> generateRigidTransforms(std::size_t count) {
+    std::mt19937 gen(1234);
+    std::uniform_real_distribution<float> distribution(-2.0f, 2.0f);
+
+    std::vector<Matrix4> result(count);
+    for (auto &matrix : result)
+        matrix = Matrix4::translation(distribution(gen), distribution(gen),
+                                      distribution(gen)) *
+                 Matrix4::rotation(Axis::X, distribution(gen)) *
+                 Matrix4::rotation(Axis::Y, distribution(gen));
+
+    return result;
+}
+
+// The triple loop Matrix4::multiply used before the SIMD kernels
+Matrix4 multiplyReference(const Matrix4 &Left, const Matrix4 &Right) {
+    Matrix4 result;
+
+    for (unsigned int i = 0U; i < 4U; i++) {
+        for (unsigned int j = 0U; j < 4U; j++) {
+            for (unsigned int k = 0U; k < 4U; k++) {
+                result.value.matrix[i][j] +=
+                    Left.value.matrix[i][k] * Right.value.matrix[k][j];
+            }
+        }
+    }
+    return result;
+}
+} // namespace
+
+static void BM_Matrix4MultiplyReference(benchmark::State &state) {
+    const auto matrices = generateRandomMatrices(state.range(0));
+    std::vector<Matrix4> results(matrices.size());
+
+    for (auto _ : state) {
+        for (std::size_t i = 1; i < matrices.size(); ++i)
+            results[i] = multiplyReference(matrices[i - 1], matrices[i]);
+
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (matrices.size() - 1));
+}
+BENCHMARK(BM_Matrix4MultiplyReference)->Arg(1024);
+
+static void BM_Matrix4Multiply(benchmark::State &state) {
+    const auto matrices = generateRandomMatrices(state.range(0));
+    std::vector<Matrix4> results(matrices.size());
+
+    for (auto _ : state) {
+        for (std::size_t i = 1; i < matrices.size(); ++i)
+            results[i] = matrices[i - 1].multiply(matrices[i]);
+
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (matrices.size() - 1));
+}
+BENCHMARK(BM_Matrix4Multiply)->Arg(1024);
+
+static void BM_Matrix4SelfMultiply(benchmark::State &state) {
+    const auto matrices = generateRandomMatrices(state.range(0));
+    auto results = matrices;
+
+    for (auto _ : state) {
+        for (std::size_t i = 1; i < matrices.size(); ++i)
+            results[i] *= matrices[i - 1];
+
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (matrices.size() - 1));
+}
+BENCHMARK(BM_Matrix4SelfMultiply)->Arg(1024);
+
+static void BM_Matrix4MultiplyVector(benchmark::State &state) {
+    const auto matrix = generateRandomMatrices(1).front();
+    std::vector<Vector4> vectors(state.range(0),
+                                 Vector4(1.0f, 2.0f, 3.0f, 1.0f));
+    std::vector<Vector4> results(vectors.size());
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < vectors.size(); ++i)
+            results[i] = matrix.multiply(vectors[i]);
+
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * vectors.size());
+}
+BENCHMARK(BM_Matrix4MultiplyVector)->Arg(1 << 16);
+
+static void BM_Matrix4TransformBatch(benchmark::State &state) {
+    const auto matrix = generateRandomMatrices(1).front();
+    std::vector<Vector4> vectors(state.range(0),
+                                 Vector4(1.0f, 2.0f, 3.0f, 1.0f));
+    std::vector<Vector4> results(vectors.size());
+
+    for (auto _ : state) {
+        matrix.transformBatch(vectors.data(), results.data(), vectors.size());
+
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * vectors.size());
+}
+BENCHMARK(BM_Matrix4TransformBatch)->Arg(1 << 16);
+
+static void BM_Matrix4TransformPoints(benchmark::State &state) {
+    const auto matrix = generateRandomMatrices(1).front();
+    std::vector<Vector3> points(state.range(0), Vector3(1.0f, 2.0f, 3.0f));
+    std::vector<Vector3> results(points.size());
+
+    for (auto _ : state) {
+        matrix.transformPoints(points.data(), results.data(), points.size());
+
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * points.size());
+}
+BENCHMARK(BM_Matrix4TransformPoints)->Arg(1 << 16);
+
+static void BM_Matrix4dMultiply(benchmark::State &state) {
+    const auto floats = generateRandomMatrices(state.range(0));
+    const std::vector<Matrix4d> matrices(floats.begin(), floats.end());
+    std::vector<Matrix4d> results(matrices.size());
+
+    for (auto _ : state) {
+        for (std::size_t i = 1; i < matrices.size(); ++i)
+            results[i] = matrices[i - 1].multiply(matrices[i]);
+
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (matrices.size() - 1));
+}
+BENCHMARK(BM_Matrix4dMultiply)->Arg(1024);
+
+static void BM_Matrix4dTransformPoints(benchmark::State &state) {
+    const Matrix4d matrix(generateRandomMatrices(1).front());
+    std::vector<Vector3d> points(state.range(0), Vector3d(1.0, 2.0, 3.0));
+    std::vector<Vector3d> results(points.size());
+
+    for (auto _ : state) {
+        matrix.transformPoints(points.data(), results.data(), points.size());
+
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * points.size());
+}
+BENCHMARK(BM_Matrix4dTransformPoints)->Arg(1 << 16);
+
+static void BM_Matrix4Inverse(benchmark::State &state) {
+    const auto matrices = generateRandomMatrices(state.range(0));
+    std::vector<Matrix4> results(matrices.size());
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < matrices.size(); ++i)
+            results[i] = matrices[i].inverse();
+
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * matrices.size());
+}
+BENCHMARK(BM_Matrix4Inverse)->Arg(1024);
+
+static void BM_Matrix4InverseUnchecked(benchmark::State &state) {
+    const auto matrices = generateRandomMatrices(state.range(0));
+    std::vector<Matrix4> results(matrices.size());
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < matrices.size(); ++i)
+            results[i] = matrices[i].inverseUnchecked();
+
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * matrices.size());
+}
+BENCHMARK(BM_Matrix4InverseUnchecked)->Arg(1024);
+
+static void BM_Matrix4InverseChecked(benchmark::State &state) {
+    const auto matrices = generateRandomMatrices(state.range(0));
+    std::vector<Matrix4> results(matrices.size());
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < matrices.size(); ++i)
+            results[i] =
+                matrices[i].inverseChecked().value_or(Matrix4::Identity);
+
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * matrices.size());
+}
+BENCHMARK(BM_Matrix4InverseChecked)->Arg(1024);
+
+static void BM_Matrix4InverseAffine(benchmark::State &state) {
+    const auto matrices = generateRigidTransforms(state.range(0));
+    std::vector<Matrix4> results(matrices.size());
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < matrices.size(); ++i)
+            results[i] = matrices[i].inverseAffine();
+
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * matrices.size());
+}
+BENCHMARK(BM_Matrix4InverseAffine)->Arg(1024);
+
+static void BM_Matrix4InverseRigid(benchmark::State &state) {
+    const auto matrices = generateRigidTransforms(state.range(0));
+    std::vector<Matrix4> results(matrices.size());
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < matrices.size(); ++i)
+            results[i] = matrices[i].inverseRigid();
+
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * matrices.size());
+}
+BENCHMARK(BM_Matrix4InverseRigid)->Arg(1024);
+
+static void BM_Matrix4ToString(benchmark::State &state) {
+    const auto matrices = generateRandomMatrices(state.range(0));
+    std::size_t length = 0;
+
+    for (auto _ : state) {
+        for (const auto &matrix : matrices)
+            length += matrix.toString().size();
+
+        benchmark::DoNotOptimize(length);
+    }
+
+    state.SetItemsProcessed(state.iterations() * matrices.size());
+}
+BENCHMARK(BM_Matrix4ToString)->Arg(256);
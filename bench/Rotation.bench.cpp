@@ -0,0 +1,124 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+#include "Matrix3.hpp"
+#include "Rotation.hpp"
+
+using Calcda::Matrix3;
+using Calcda::Quaternion;
+using Calcda::Vector3;
+
+namespace {
+std::vector<Quaternion> generateRandomRotations(std::size_t count,
+                                                unsigned seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<float> distribution(-2.0f, 2.0f);
+
+    std::vector<Quaternion> result(count);
+    for (auto &rotation : result)
+        rotation = Quaternion::fromAxisAngle(
+            Vector3(distribution(gen), distribution(gen), distribution(gen)),
+            distribution(gen));
+
+    return result;
+}
+
+std::vector<float> generateAmounts(std::size_t count) {
+    std::mt19937 gen(1234);
+    std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+
+    std::vector<float> result(count);
+    for (auto &amount : result)
+        amount = distribution(gen);
+
+    return result;
+}
+} // namespace
+
+static void BM_QuaternionMultiply(benchmark::State &state) {
+    const auto rotations = generateRandomRotations(state.range(0), 1234);
+    std::vector<Quaternion> results(rotations.size());
+
+    for (auto _ : state) {
+        for (std::size_t i = 1; i < rotations.size(); ++i)
+            results[i] = rotations[i - 1].multiply(rotations[i]);
+
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (rotations.size() - 1));
+}
+BENCHMARK(BM_QuaternionMultiply)->Arg(1024);
+
+// the same rotations composed as matrices
+static void BM_QuaternionMultiplyMatrix3(benchmark::State &state) {
+    const auto rotations = generateRandomRotations(state.range(0), 1234);
+    std::vector<Matrix3> matrices, results(rotations.size());
+    for (const auto &rotation : rotations)
+        matrices.push_back(rotation.toMatrix3());
+
+    for (auto _ : state) {
+        for (std::size_t i = 1; i < matrices.size(); ++i)
+            results[i] = matrices[i - 1].multiply(matrices[i]);
+
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (matrices.size() - 1));
+}
+BENCHMARK(BM_QuaternionMultiplyMatrix3)->Arg(1024);
+
+static void BM_QuaternionRotate(benchmark::State &state) {
+    const auto rotations = generateRandomRotations(state.range(0), 1234);
+    std::vector<Vector3> results(rotations.size());
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < rotations.size(); ++i)
+            results[i] = rotations[i].rotate(Vector3::UnitX);
+
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * rotations.size());
+}
+BENCHMARK(BM_QuaternionRotate)->Arg(1024);
+
+static void BM_QuaternionSlerp(benchmark::State &state) {
+    const auto from = generateRandomRotations(state.range(0), 1234),
+               to = generateRandomRotations(state.range(0), 5678);
+    const auto amounts = generateAmounts(from.size());
+    std::vector<Quaternion> results(from.size());
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < from.size(); ++i)
+            results[i] = Quaternion::slerp(from[i], to[i], amounts[i]);
+
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * from.size());
+}
+BENCHMARK(BM_QuaternionSlerp)->Arg(1024);
+
+static void BM_QuaternionSlerpBatch(benchmark::State &state) {
+    const auto from = generateRandomRotations(state.range(0), 1234),
+               to = generateRandomRotations(state.range(0), 5678);
+    const auto amounts = generateAmounts(from.size());
+    std::vector<Quaternion> results(from.size());
+
+    for (auto _ : state) {
+        Quaternion::slerpBatch(from.data(), to.data(), amounts.data(),
+                               results.data(), results.size());
+
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * from.size());
+}
+BENCHMARK(BM_QuaternionSlerpBatch)->Arg(1024);
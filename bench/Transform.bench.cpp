@@ -0,0 +1,204 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+#include "Transform.hpp"
+#include "TransformHierarchy.hpp"
+
+using Calcda::CachedTransform;
+using Calcda::Matrix4;
+using Calcda::Quaternion;
+using Calcda::Transform;
+using Calcda::TransformHierarchy;
+using Calcda::Vector3;
+
+namespace {
+std::vector<Transform> generateRandomTransforms(std::size_t count) {
+    std::mt19937 gen(1234);
+    std::uniform_real_distribution<float> distribution(-2.0f, 2.0f);
+
+    std::vector<Transform> result;
+    result.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        const Vector3 translation(distribution(gen), distribution(gen),
+                                  distribution(gen));
+        const auto rotation = Quaternion::fromAxisAngle(
+            Vector3(distribution(gen), distribution(gen), distribution(gen)),
+            distribution(gen));
+        const float scale = 1.0f + 0.25f * distribution(gen);
+
+        result.emplace_back(translation, rotation,
+                            Vector3(scale, scale, scale));
+    }
+
+    return result;
+}
+} // namespace
+
+// how world matrices are built without Transform
+static void BM_Matrix4ComposeTRS(benchmark::State &state) {
+    const auto transforms = generateRandomTransforms(state.range(0));
+    std::vector<Matrix4> results(transforms.size());
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < transforms.size(); ++i) {
+            const auto &transform = transforms[i];
+            results[i] = Matrix4::translation(transform.getTranslation()) *
+                         transform.getRotation().toMatrix4() *
+                         Matrix4::scale(transform.getScale());
+        }
+
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * transforms.size());
+}
+BENCHMARK(BM_Matrix4ComposeTRS)->Arg(1024);
+
+static void BM_TransformToMatrix4(benchmark::State &state) {
+    const auto transforms = generateRandomTransforms(state.range(0));
+    std::vector<Matrix4> results(transforms.size());
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < transforms.size(); ++i)
+            results[i] = transforms[i].toMatrix4();
+
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * transforms.size());
+}
+BENCHMARK(BM_TransformToMatrix4)->Arg(1024);
+
+static void BM_TransformToMatrix4Cached(benchmark::State &state) {
+    std::vector<CachedTransform> transforms;
+    for (const auto &transform : generateRandomTransforms(state.range(0)))
+        transforms.emplace_back(transform);
+    std::vector<Matrix4> results(transforms.size());
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < transforms.size(); ++i)
+            results[i] = transforms[i].toMatrix4();
+
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * transforms.size());
+}
+BENCHMARK(BM_TransformToMatrix4Cached)->Arg(1024);
+
+static void BM_TransformCombine(benchmark::State &state) {
+    const auto transforms = generateRandomTransforms(state.range(0));
+    std::vector<Transform> results(transforms.size());
+
+    for (auto _ : state) {
+        for (std::size_t i = 1; i < transforms.size(); ++i)
+            results[i] = transforms[i - 1].combine(transforms[i]);
+
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (transforms.size() - 1));
+}
+BENCHMARK(BM_TransformCombine)->Arg(1024);
+
+static void BM_TransformPoint(benchmark::State &state) {
+    const auto transforms = generateRandomTransforms(state.range(0));
+    std::vector<Vector3> results(transforms.size());
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < transforms.size(); ++i)
+            results[i] = transforms[i].transformPoint(Vector3::One);
+
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * transforms.size());
+}
+BENCHMARK(BM_TransformPoint)->Arg(1024);
+
+namespace {
+// 64 trees of 64 nodes, each node below a random earlier node of its tree
+TransformHierarchy generateHierarchy() {
+    const auto transforms = generateRandomTransforms(64 * 64);
+    std::mt19937 gen(1234);
+
+    TransformHierarchy hierarchy;
+    hierarchy.reserve(transforms.size());
+    for (std::size_t tree = 0; tree < 64; ++tree) {
+        const auto root = hierarchy.add(transforms[tree * 64]);
+        for (std::size_t i = 1; i < 64; ++i) {
+            std::uniform_int_distribution<std::size_t> parent(0, i - 1);
+            hierarchy.add(transforms[tree * 64 + i], root + parent(gen));
+        }
+    }
+
+    hierarchy.update();
+    return hierarchy;
+}
+} // namespace
+
+// recomputing every world matrix, as without dirty flags
+static void BM_TransformHierarchyFull(benchmark::State &state) {
+    const auto hierarchy = generateHierarchy();
+    std::vector<Matrix4> worlds(hierarchy.size());
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < hierarchy.size(); ++i) {
+            const auto parent = hierarchy.getParent(i);
+            worlds[i] = parent == TransformHierarchy::NoParent
+                            ? hierarchy.getLocal(i)
+                            : worlds[parent].multiply(hierarchy.getLocal(i));
+        }
+
+        benchmark::DoNotOptimize(worlds.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * hierarchy.size());
+}
+BENCHMARK(BM_TransformHierarchyFull);
+
+// moves every n-th node, as an animation would
+static void BM_TransformHierarchyUpdate(benchmark::State &state) {
+    auto hierarchy = generateHierarchy();
+    const std::size_t stride = state.range(0);
+
+    std::size_t updated = 0;
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < hierarchy.size(); i += stride)
+            hierarchy.setLocal(i, hierarchy.getLocal(i));
+
+        updated = hierarchy.update();
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["updated"] = static_cast<double>(updated);
+    state.SetItemsProcessed(state.iterations() * hierarchy.size());
+}
+BENCHMARK(BM_TransformHierarchyUpdate)->ArgName("stride")->Arg(1)->Arg(97);
+
+static void BM_TransformHierarchyUpdateParallel(benchmark::State &state) {
+    auto hierarchy = generateHierarchy();
+    const auto threads = static_cast<unsigned int>(state.range(0));
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < hierarchy.size(); ++i)
+            hierarchy.setLocal(i, hierarchy.getLocal(i));
+
+        benchmark::DoNotOptimize(hierarchy.updateParallel(threads));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * hierarchy.size());
+}
+BENCHMARK(BM_TransformHierarchyUpdateParallel)
+    ->ArgName("threads")
+    ->Arg(2)
+    ->Arg(4)
+    ->UseRealTime();
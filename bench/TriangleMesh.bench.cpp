@@ -0,0 +1,95 @@
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <vector>
+
+#include "TriangleMesh.hpp"
+
+using Calcda::TriangleMesh;
+using Calcda::Vector3;
+using Calcda::Vector3SoA;
+
+namespace {
+// a wavy terrain of size x size quads, two triangles each
+TriangleMesh generateTerrain(std::size_t size) {
+    std::vector<Vector3> vertices;
+    std::vector<std::uint32_t> indices;
+
+    for (std::size_t z = 0; z <= size; ++z)
+        for (std::size_t x = 0; x <= size; ++x)
+            vertices.emplace_back(
+                static_cast<float>(x),
+                2.0f * std::sin(0.1f * x) * std::cos(0.13f * z),
+                static_cast<float>(z));
+
+    const auto vertex = [size](std::size_t x, std::size_t z) {
+        return static_cast<std::uint32_t>(z * (size + 1) + x);
+    };
+    for (std::size_t z = 0; z < size; ++z)
+        for (std::size_t x = 0; x < size; ++x)
+            indices.insert(indices.end(),
+                           {vertex(x, z), vertex(x + 1, z), vertex(x, z + 1),
+                            vertex(x + 1, z), vertex(x + 1, z + 1),
+                            vertex(x, z + 1)});
+
+    return TriangleMesh(vertices, indices);
+}
+
+// the rays of a 64 x 64 pixel camera looking down at the terrain
+void generateCameraRays(std::size_t size, Vector3SoA &origins,
+                        Vector3SoA &directions) {
+    const float center = 0.5f * static_cast<float>(size);
+
+    for (std::size_t y = 0; y < 64; ++y)
+        for (std::size_t x = 0; x < 64; ++x) {
+            origins.append(Vector3(center, 20.0f, -10.0f));
+            directions.append(Vector3((x - 31.5f) / 64.0f, -0.5f,
+                                      1.0f - (y - 31.5f) / 128.0f));
+        }
+}
+} // namespace
+
+static void BM_TriangleMeshIntersectRay(benchmark::State &state) {
+    const auto mesh = generateTerrain(state.range(0));
+    Vector3SoA origins, directions;
+    generateCameraRays(state.range(0), origins, directions);
+    std::vector<float> distances(origins.size());
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < origins.size(); ++i) {
+            const auto hit =
+                mesh.intersectRay(origins.get(i), directions.get(i));
+            distances[i] = hit ? hit->distance : INFINITY;
+        }
+
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * origins.size());
+}
+BENCHMARK(BM_TriangleMeshIntersectRay)->Arg(256);
+
+static void BM_TriangleMeshIntersectRays(benchmark::State &state) {
+    const auto mesh = generateTerrain(state.range(0));
+    Vector3SoA origins, directions;
+    generateCameraRays(state.range(0), origins, directions);
+    std::vector<TriangleMesh::Hit> hits(origins.size());
+
+    for (auto _ : state) {
+        mesh.intersectRays(origins, directions, hits.data());
+
+        benchmark::DoNotOptimize(hits.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * origins.size());
+}
+BENCHMARK(BM_TriangleMeshIntersectRays)->Arg(256);
+
+static void BM_TriangleMeshBuild(benchmark::State &state) {
+    for (auto _ : state)
+        benchmark::DoNotOptimize(generateTerrain(state.range(0)));
+
+    state.SetItemsProcessed(state.iterations() * 2 * state.range(0) *
+                            state.range(0));
+}
+BENCHMARK(BM_TriangleMeshBuild)->Arg(256);
@@ -0,0 +1,118 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+#include "Vector2.hpp"
+#include "Vector3.hpp"
+#include "Vector4.hpp"
+
+using Calcda::Vector2;
+using Calcda::Vector3;
+using Calcda::Vector4;
+
+namespace {
+std::vector<Vector3> generateRandomVectors(std::size_t count) {
+    std::mt19937 gen(1234);
+    std::uniform_real_distribution<float> distribution(-100.0f, 100.0f);
+
+    std::vector<Vector3> result(count);
+    for (auto &vector : result)
+        vector = Vector3(distribution(gen), distribution(gen),
+                         distribution(gen));
+
+    return result;
+}
+
+template <typename VectorType> VectorType fromVector3(const Vector3 &Value);
+template <> Vector2 fromVector3(const Vector3 &Value) {
+    return Vector2(Value.x, Value.y);
+}
+template <> Vector3 fromVector3(const Vector3 &Value) { return Value; }
+template <> Vector4 fromVector3(const Vector3 &Value) {
+    return Vector4(Value, 1.0f);
+}
+} // namespace
+
+static void BM_Vector3Add(benchmark::State &state) {
+    const auto vectors = generateRandomVectors(state.range(0));
+    std::vector<Vector3> results(vectors.size());
+
+    for (auto _ : state) {
+        for (std::size_t i = 1; i < vectors.size(); ++i)
+            results[i] = vectors[i - 1] + vectors[i];
+
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (vectors.size() - 1));
+}
+BENCHMARK(BM_Vector3Add)->Arg(1 << 16);
+
+static void BM_Vector3Dot(benchmark::State &state) {
+    const auto vectors = generateRandomVectors(state.range(0));
+
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for (std::size_t i = 1; i < vectors.size(); ++i)
+            sum += Vector3::dot(vectors[i - 1], vectors[i]);
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * (vectors.size() - 1));
+}
+BENCHMARK(BM_Vector3Dot)->Arg(1 << 16);
+
+static void BM_Vector3LengthSquared(benchmark::State &state) {
+    const auto vectors = generateRandomVectors(state.range(0));
+    std::vector<float> results(vectors.size());
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < vectors.size(); ++i)
+            results[i] = vectors[i].lengthSquared();
+
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * vectors.size());
+}
+BENCHMARK(BM_Vector3LengthSquared)->Arg(1 << 16);
+
+static void BM_Vector3Lerp(benchmark::State &state) {
+    const auto vectors = generateRandomVectors(state.range(0));
+    std::vector<Vector3> results(vectors.size());
+
+    for (auto _ : state) {
+        for (std::size_t i = 1; i < vectors.size(); ++i)
+            results[i] = Vector3::lerp(vectors[i - 1], vectors[i], 0.25f);
+
+        benchmark::DoNotOptimize(results.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (vectors.size() - 1));
+}
+BENCHMARK(BM_Vector3Lerp)->Arg(1 << 16);
+
+template <typename VectorType>
+static void BM_VectorToString(benchmark::State &state) {
+    std::vector<VectorType> vectors;
+    for (const auto &vector : generateRandomVectors(state.range(0)))
+        vectors.push_back(fromVector3<VectorType>(vector));
+
+    std::size_t length = 0;
+
+    for (auto _ : state) {
+        for (const auto &vector : vectors)
+            length += vector.toString().size();
+
+        benchmark::DoNotOptimize(length);
+    }
+
+    state.SetItemsProcessed(state.iterations() * vectors.size());
+}
+BENCHMARK_TEMPLATE(BM_VectorToString, Vector2)->Arg(1 << 10);
+BENCHMARK_TEMPLATE(BM_VectorToString, Vector3)->Arg(1 << 10);
+BENCHMARK_TEMPLATE(BM_VectorToString, Vector4)->Arg(1 << 10);
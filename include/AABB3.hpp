@@ -0,0 +1,120 @@
+#ifndef CALCDA_AABB3_H
+#define CALCDA_AABB3_H
+
+#include "Intrinsic.hpp"
+
+#include "Matrix4.hpp" // Calcda::Matrix4
+#include "Vector3.hpp" // Calcda::Vector3
+
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <string>
+
+namespace Calcda {
+/**
+ * @brief Class for 3-dimensional axis-aligned bounding boxes
+ *
+ * The corners are padded to 16 bytes each, so the SSE2 and NEON paths load
+ * and store them as whole registers. A box with a minimum above its maximum
+ * on any axis is empty; the default box is the empty box, which merging
+ * leaves unchanged.
+ */
+class alignas(16) AABB3 {
+  public:
+    Vector3 minimum;
+
+    //! @brief Unused, pads the minimum to 16 bytes
+    float padding0;
+
+    Vector3 maximum;
+
+    //! @brief Unused, pads the maximum to 16 bytes
+    float padding1;
+
+  public:
+    // +inf; -inf - Contains nothing
+    static const AABB3 Empty;
+
+  public:
+    constexpr AABB3()
+        : minimum(std::numeric_limits<float>::infinity(),
+                  std::numeric_limits<float>::infinity(),
+                  std::numeric_limits<float>::infinity()),
+          padding0(0.0f),
+          maximum(-std::numeric_limits<float>::infinity(),
+                  -std::numeric_limits<float>::infinity(),
+                  -std::numeric_limits<float>::infinity()),
+          padding1(0.0f) {}
+    constexpr AABB3(Vector3 Minimum, Vector3 Maximum)
+        : minimum(Minimum), padding0(0.0f), maximum(Maximum),
+          padding1(0.0f) {}
+
+    //! @brief Returns the smallest box containing the @c Count points
+    static AABB3 fromPoints(const Vector3 *Points, std::size_t Count);
+
+    //! @brief Returns the box of @c Center +- @c Extent
+    static AABB3 fromCenter(Vector3 Center, Vector3 Extent);
+
+    bool isEmpty() const;
+
+    Vector3 center() const;
+
+    //! @brief Returns half of the size of the box on each axis
+    Vector3 extent() const;
+
+    //! @brief Returns the area of the faces, the cost metric of bounding
+    //! volume hierarchies
+    float surfaceArea() const;
+
+    bool containsPoint(Vector3 Point) const;
+    bool contains(const AABB3 &Other) const;
+    bool intersects(const AABB3 &Other) const;
+
+    //! @brief Returns the smallest box containing both boxes
+    AABB3 merge(const AABB3 &Other) const;
+    AABB3 merge(Vector3 Point) const;
+    AABB3 &selfMerge(const AABB3 &Other);
+    AABB3 &selfMerge(Vector3 Point);
+
+    //! @brief Returns the overlap of the boxes, empty if they are disjoint
+    AABB3 intersection(const AABB3 &Other) const;
+
+    /**
+     * @brief Returns the box of the transformed corners, as in J. Arvo,
+     * Transforming Axis-Aligned Bounding Boxes, Graphics Gems (1990)
+     * @note @c Transform must be affine; its last row is not read
+     */
+    AABB3 transform(const Matrix4 &Transform) const;
+
+    /**
+     * @brief Returns the distance along @c Direction, in units of its length,
+     * where the ray from @c Origin enters the box; 0 if it starts inside,
+     * and none for an empty box
+     * @param MaxDistance Rays are clipped at this distance
+     */
+    std::optional<float>
+    intersectRay(Vector3 Origin, Vector3 Direction,
+                 float MaxDistance = std::numeric_limits<float>::infinity())
+        const;
+
+    /**
+     * @brief Intersects the ray with @c Count boxes, writing the distances
+     * like intersectRay to @c Distances, or infinity for missed boxes
+     *
+     * Tests 4 boxes at a time with SSE2, by transposing them into registers
+     * of x, y and z values.
+     */
+    static void intersectRayBatch(
+        Vector3 Origin, Vector3 Direction, const AABB3 *Boxes,
+        std::size_t Count, float *Distances,
+        float MaxDistance = std::numeric_limits<float>::infinity());
+
+    bool operator==(const AABB3 &Other) const;
+    bool operator!=(const AABB3 &Other) const;
+
+    std::string toString() const;
+};
+} // namespace Calcda
+
+#endif // !CALCDA_AABB3_H
@@ -0,0 +1,120 @@
+#ifndef CALCDA_BOUNDINGVOLUMEHIERARCHY_H
+#define CALCDA_BOUNDINGVOLUMEHIERARCHY_H
+
+#include "Geometry.hpp" // Calcda::Shape, Calcda::LineType
+#include "Vector2.hpp"  // Calcda::Vector2
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace Calcda {
+/**
+ * @brief Bounding volume hierarchy over a collection of shapes
+ *
+ * Built once from the bounding rectangles of the shapes with a binned surface
+ * area heuristic; the queries visit only the subtrees whose rectangles can
+ * contain a result, so they take O(log n) instead of O(n) for spread out
+ * shapes. Results refer to the shapes by their index in the input collection,
+ * in no particular order.
+ *
+ * The hierarchy stores pointers to the shapes, so they must outlive it and
+ * must not move: a vector of shapes must not be resized or destroyed while
+ * the hierarchy is used, and temporary vectors are rejected. Shapes without
+ * a finite bounding rectangle (rays and lines) are tested on every query.
+ */
+class BoundingVolumeHierarchy {
+  public:
+    struct ShapeIntersection {
+        std::size_t shape;
+        Vector2 intersection;
+
+        inline bool operator==(const ShapeIntersection &other) const {
+            return shape == other.shape && intersection == other.intersection;
+        }
+    };
+
+  private:
+    struct Entry {
+        Vector2 xymin;
+        Vector2 xymax;
+        std::size_t shape;
+    };
+
+    /*
+     * Leaves have count > 0 and own m_entries[first, first + count); inner
+     * nodes have count == 0, their left child follows them directly, and
+     * first is the index of the right child.
+     */
+    struct Node {
+        Vector2 xymin;
+        Vector2 xymax;
+        std::uint32_t first;
+        std::uint32_t count;
+    };
+
+    std::vector<const Shape *> m_shapes;
+    std::vector<Node> m_nodes;
+    std::vector<Entry> m_entries;
+    std::vector<Entry> m_unbounded;
+
+  private:
+    void build(std::size_t Node, std::size_t Begin, std::size_t End,
+               unsigned Depth);
+
+  public:
+    BoundingVolumeHierarchy() = default;
+    explicit BoundingVolumeHierarchy(std::vector<const Shape *> Shapes);
+
+    template <typename ShapeType>
+    explicit BoundingVolumeHierarchy(const std::vector<ShapeType> &Shapes)
+        : BoundingVolumeHierarchy(toPointers(Shapes)) {}
+
+    template <typename ShapeType>
+    BoundingVolumeHierarchy(std::vector<ShapeType> &&Shapes) = delete;
+
+    //! @brief Returns the number of shapes in the hierarchy
+    std::size_t size() const;
+
+    //! @brief Returns the shape at @c Index of the input collection
+    const Shape &getShape(std::size_t Index) const;
+
+    //! @brief Returns the indices of the shapes containing @c point
+    std::vector<std::size_t> queryPoint(Vector2 point) const;
+
+    /**
+     * @brief Returns the indices of the shapes whose bounding rectangle
+     * overlaps the rectangle from @c xymin to @c xymax
+     */
+    std::vector<std::size_t> queryRectangle(Vector2 xymin,
+                                            Vector2 xymax) const;
+
+    //! @brief Returns every intersection of the shapes with the line @c a, @c b
+    std::vector<ShapeIntersection>
+    intersectLine(Vector2 a, Vector2 b, LineType type = LineType::LINE) const;
+
+    /**
+     * @brief Returns the intersection closest to @c a, skipping the subtrees
+     * that cannot contain a closer one
+     */
+    std::optional<ShapeIntersection>
+    intersectLineClosest(Vector2 a, Vector2 b,
+                         LineType type = LineType::LINE) const;
+
+  private:
+    template <typename ShapeType>
+    static std::vector<const Shape *>
+    toPointers(const std::vector<ShapeType> &Shapes) {
+        std::vector<const Shape *> result;
+        result.reserve(Shapes.size());
+
+        for (const auto &shape : Shapes)
+            result.push_back(&shape);
+
+        return result;
+    }
+};
+} // namespace Calcda
+
+#endif // !CALCDA_BOUNDINGVOLUMEHIERARCHY_H
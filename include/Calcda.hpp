@@ -1,12 +1,22 @@
 #ifndef CALCDA_H
 #define CALCDA_H
 
+#include "AABB3.hpp"    // Calcda::AABB3
+#include "BoundingVolumeHierarchy.hpp" // Calcda::BoundingVolumeHierarchy
+#include "ConvexHull.hpp" // Calcda::computeConvexHull, Calcda::ConvexHull3
+#include "Frustum.hpp"  // Calcda::Frustum, Calcda::Plane
 #include "Geometry.hpp"
 #include "Integer.hpp"  // Calcda::Integer
 #include "Matrix4.hpp"  // Calcda::Matrix4
+#include "Predicates.hpp" // Calcda::Predicates
 #include "Rotation.hpp" // Calcda::Rotation
+#include "SegmentIntersection.hpp" // Calcda::intersectSegments
+#include "Transform.hpp" // Calcda::Transform
+#include "TransformHierarchy.hpp" // Calcda::TransformHierarchy
+#include "TriangleMesh.hpp" // Calcda::TriangleMesh, Calcda::intersectRayTriangle
 #include "Vector2.hpp"  // Calcda::Vector2
 #include "Vector3.hpp"  // Calcda::Vector3
 #include "Vector4.hpp"  // Calcda::Vector4
+#include "VectorSoA.hpp" // Calcda::Vector2SoA, Calcda::Vector3SoA, Calcda::Vector4SoA
 
 #endif // !CALCDA_H
\ No newline at end of file
@@ -0,0 +1,64 @@
+#ifndef CALCDA_CONVEXHULL_H
+#define CALCDA_CONVEXHULL_H
+
+#include "Geometry.hpp" // Calcda::Polygon
+#include "Vector2.hpp"  // Calcda::Vector2
+#include "Vector3.hpp"  // Calcda::Vector3
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Calcda {
+/**
+ * @brief Returns the convex hull of the points with Andrew's monotone chain
+ *
+ * The hull runs counterclockwise from the leftmost (then lowest) point, and
+ * has no collinear or repeated points; fewer than 3 points remain if the
+ * input is degenerate: the two ends of a line, a single point, or none. The
+ * turns are decided with Predicates::orient2d, so the result is exact.
+ *
+ * Before sorting, the points strictly inside the octagon of the extreme
+ * points along the axes and the diagonals are dropped (the Akl-Toussaint
+ * heuristic), which leaves a small fraction of uniformly spread points. For
+ * large inputs the filter and the sort are spread over @c Threads threads.
+ *
+ * @param Threads Number of threads; 0 uses the hardware concurrency
+ */
+Polygon computeConvexHull(const Vector2 *Points, std::size_t Count,
+                          unsigned int Threads = 0);
+
+Polygon computeConvexHull(const std::vector<Vector2> &Points,
+                          unsigned int Threads = 0);
+
+//! @brief Closed triangle mesh of a 3D convex hull
+struct ConvexHull3 {
+    //! @brief The points on the corners of the hull
+    std::vector<Vector3> vertices;
+
+    /**
+     * @brief Three indices into vertices per triangle, counterclockwise when
+     * seen from outside
+     *
+     * Fits TriangleMesh as it is.
+     */
+    std::vector<std::uint32_t> indices;
+};
+
+/**
+ * @brief Returns the convex hull of the points with the quickhull algorithm
+ *
+ * Flat faces of the hull are split into triangles, and points inside them
+ * may become vertices too. The hull is exact up to the precision of the
+ * input: points closer to a face than a float rounding error of the extent of
+ * the points count as inside. Points that do not span a volume (all coplanar,
+ * collinear, or fewer than 4) give an empty hull.
+ *
+ * @note The indices are 32 bits, so @c Count must be below 2^32
+ */
+ConvexHull3 computeConvexHull(const Vector3 *Points, std::size_t Count);
+
+ConvexHull3 computeConvexHull(const std::vector<Vector3> &Points);
+} // namespace Calcda
+
+#endif // !CALCDA_CONVEXHULL_H
@@ -0,0 +1,79 @@
+#ifndef CALCDA_FRUSTUM_H
+#define CALCDA_FRUSTUM_H
+
+#include "Intrinsic.hpp"
+
+#include "Matrix4.hpp"   // Calcda::Matrix4
+#include "Vector3.hpp"   // Calcda::Vector3
+#include "VectorSoA.hpp" // Calcda::Vector3SoA
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Calcda {
+//! @brief Plane of the points @c p where dot(normal, p) + distance is 0
+struct Plane {
+    Vector3 normal;
+    float distance;
+
+    //! @brief Returns the distance of @c Point from the plane, positive on
+    //! the side @c normal points to; exact if @c normal is normalized
+    float signedDistance(Vector3 Point) const;
+
+    std::string toString() const;
+};
+
+/**
+ * @brief Class for culling with the view volume of a camera
+ *
+ * The planes are extracted from a view-projection matrix, as in G. Gribb, K.
+ * Hartmann, Fast Extraction of Viewing Frustum Planes from the World-View-
+ * Projection Matrix (2001), for column vectors and a clip volume from -w to
+ * w, as built by Matrix4::perspective, frustum, orthographic and lookAt. The
+ * normals point inwards, and are normalized.
+ *
+ * The tests are conservative: a sphere or box outside the frustum, but not
+ * entirely outside one of its planes, near a corner, counts as visible.
+ */
+class Frustum {
+  public:
+    //! @brief Number of planes: left, right, bottom, top, near and far
+    static constexpr std::size_t PlaneCount = 6;
+
+  private:
+    Plane m_planes[PlaneCount];
+
+  public:
+    //! @brief Extracts the planes of @c ViewProjection; with a model matrix
+    //! multiplied in, the tests work in model space
+    explicit Frustum(const Matrix4 &ViewProjection);
+
+    //! @brief Returns the left, right, bottom, top, near or far plane
+    const Plane &getPlane(std::size_t Index) const;
+
+    bool containsPoint(Vector3 Point) const;
+    bool intersectsSphere(Vector3 Center, float Radius) const;
+    bool intersectsBox(Vector3 Min, Vector3 Max) const;
+
+    /**
+     * @brief Tests @c Centers.size() spheres, writing their visibility to @c
+     * Masks, bit @c i % 32 of @c Masks[i / 32] for sphere @c i
+     *
+     * Tests 8 spheres at a time with AVX, or 4 with SSE2. @c Masks must have
+     * room for (size + 31) / 32 words; unused bits are cleared.
+     */
+    void intersectsSpheres(const Vector3SoA &Centers, const float *Radii,
+                           std::uint32_t *Masks) const;
+
+    /**
+     * @brief Tests @c Mins.size() axis-aligned boxes, from @c Mins[i] to @c
+     * Maxs[i], writing their visibility to @c Masks
+     * @see intersectsSpheres
+     */
+    void intersectsBoxes(const Vector3SoA &Mins, const Vector3SoA &Maxs,
+                         std::uint32_t *Masks) const;
+};
+} // namespace Calcda
+
+#endif // !CALCDA_FRUSTUM_H
@@ -2,6 +2,9 @@
 #define CALCDA_GEOMETRY_H
 
 #include "Vector2.hpp"
+#include "VectorSoA.hpp" // Calcda::Vector2SoA
+#include <cstddef>
+#include <cstdint>
 #include <initializer_list>
 #include <optional>
 #include <tuple>
@@ -11,6 +14,125 @@
 namespace Calcda {
 enum class LineType { LINE, RAY, SEGMENT };
 
+//! @brief Intersection of two lines of the batch intersection kernels
+struct LineIntersection {
+    //! @brief Index of the line from the first batch
+    std::size_t first;
+
+    //! @brief Index of the line from the second batch
+    std::size_t second;
+
+    //! @brief Parameter of the intersection along the first line
+    float firstParameter;
+
+    //! @brief Parameter of the intersection along the second line
+    float secondParameter;
+
+    Vector2 intersection;
+};
+
+// the batch kernels and PolygonView read arrays of points as x, y floats
+static_assert(sizeof(Vector2) == 2 * sizeof(float) &&
+                  alignof(Vector2) == alignof(float),
+              "Vector2 must be two packed floats");
+
+/**
+ * @brief Read-only view of contiguous points, like a std::span<const
+ * Vector2>
+ *
+ * It does not own the points, which must outlive it.
+ */
+class PointSpan {
+  private:
+    const Vector2 *m_data;
+    std::size_t m_size;
+
+  public:
+    constexpr PointSpan() : m_data(nullptr), m_size(0) {}
+    constexpr PointSpan(const Vector2 *Data, std::size_t Size)
+        : m_data(Data), m_size(Size) {}
+    PointSpan(const std::vector<Vector2> &Points)
+        : m_data(Points.data()), m_size(Points.size()) {}
+
+    constexpr const Vector2 *data() const { return m_data; }
+    constexpr std::size_t size() const { return m_size; }
+    constexpr bool empty() const { return m_size == 0; }
+
+    constexpr const Vector2 *begin() const { return m_data; }
+    constexpr const Vector2 *end() const { return m_data + m_size; }
+
+    constexpr const Vector2 &operator[](std::size_t Index) const {
+        return m_data[Index];
+    }
+    constexpr const Vector2 &front() const { return m_data[0]; }
+    constexpr const Vector2 &back() const { return m_data[m_size - 1]; }
+
+    //! @brief Copies the points
+    std::vector<Vector2> toVector() const {
+        return std::vector<Vector2>(begin(), end());
+    }
+};
+
+//! @brief Order of the points of a polygon, with the y axis pointing up
+enum class Winding { COUNTERCLOCKWISE, CLOCKWISE, NONE };
+
+//! @brief How the polygon metrics add up the terms of the edges
+enum class Summation {
+    //! @brief Float sums over 4 (SSE2) or 8 (AVX) edges at a time
+    FAST,
+
+    //! @brief Double precision terms, summed with Neumaier's compensated
+    //! summation; for rings of many points, or far from the origin
+    COMPENSATED
+};
+
+//! @brief Measures of a polygon, closed by the edge from its last point to
+//! its first
+struct PolygonMetrics {
+    //! @brief Area, positive if the points are counterclockwise
+    float signedArea;
+
+    /**
+     * @brief Center of mass of the area; the mean of the points if the area
+     * is zero
+     */
+    Vector2 centroid;
+
+    float perimeter;
+
+    inline float getArea() const {
+        return signedArea < 0.0f ? -signedArea : signedArea;
+    }
+
+    inline Winding getWinding() const {
+        return signedArea > 0.0f   ? Winding::COUNTERCLOCKWISE
+               : signedArea < 0.0f ? Winding::CLOCKWISE
+                                   : Winding::NONE;
+    }
+};
+
+/**
+ * @brief Computes the area, centroid and perimeter of the polygon of @c
+ * Points in one pass, with the shoelace formula
+ *
+ * The points are taken relative to the first one, which keeps the products
+ * of the shoelace formula small for polygons far from the origin.
+ */
+PolygonMetrics computePolygonMetrics(PointSpan Points,
+                                     Summation Mode = Summation::FAST);
+
+/**
+ * @brief Computes the metrics of the @c Count polygons of @c Polygons into @c
+ * Out, spreading them over @c Threads threads
+ * @param Threads Number of threads; 0 uses the hardware concurrency
+ * @note The threads are started for each call, and take the polygons in
+ * chunks, so it pays off for many polygons, or many points
+ */
+void computePolygonMetrics(const PointSpan *Polygons, std::size_t Count,
+                           PolygonMetrics *Out,
+                           Summation Mode = Summation::FAST,
+                           unsigned int Threads = 0);
+
 class Shape {
   protected:
     //! @brief Top left corner of the bounding rectangle
@@ -33,6 +155,15 @@ class Shape {
     virtual std::vector<Vector2>
     intersectLine(Vector2 a, Vector2 b,
                   LineType type = LineType::LINE) const = 0;
+
+    /**
+     * @brief Writes the intersection points to @c Out, without allocating
+     * @returns the number of intersections; if it is larger than @c
+     * Capacity, only the first @c Capacity points were written
+     */
+    virtual std::size_t intersectLine(Vector2 a, Vector2 b, LineType type,
+                                      Vector2 *Out,
+                                      std::size_t Capacity) const;
 };
 
 class Line : public Shape {
@@ -43,6 +174,10 @@ class Line : public Shape {
     Vector2 m_end;
     LineType m_type;
 
+  public:
+    //! @brief Maximum number of intersections with a line
+    static constexpr std::size_t MaxIntersections = 1;
+
   public:
     Line(Vector2 begin, Vector2 end, LineType type);
 
@@ -51,6 +186,9 @@ class Line : public Shape {
     virtual std::vector<Vector2>
     intersectLine(Vector2 a, Vector2 b,
                   LineType type = LineType::LINE) const final;
+    virtual std::size_t intersectLine(Vector2 a, Vector2 b, LineType type,
+                                      Vector2 *Out,
+                                      std::size_t Capacity) const final;
     virtual bool isPointInside(Vector2 point) const final;
 
     std::vector<Vector2> intersectLine(const Line &other) const;
@@ -58,6 +196,26 @@ class Line : public Shape {
     static std::optional<Vector2> intersectRaw(Vector2 l1a, Vector2 l1b,
                                                LineType l1t, Vector2 l2a,
                                                Vector2 l2b, LineType l2t);
+
+    /**
+     * @brief Intersects every line of @c First with every line of @c Second,
+     * appending the hits to @c Out, ordered by @c first, then @c second
+     *
+     * Line @c i of a batch goes from @c Batch[2 * i] to @c Batch[2 * i + 1].
+     * The line types are template parameters, so the range checks compile
+     * into the loop, which runs over a whole block of @c Second at once.
+     */
+    template <LineType FirstType, LineType SecondType>
+    static void intersectBatch(const Vector2 *First, std::size_t FirstCount,
+                               const Vector2 *Second, std::size_t SecondCount,
+                               std::vector<LineIntersection> &Out);
+
+    //! @brief Dispatches to the @c intersectBatch of @c FirstType, @c
+    //! SecondType
+    static void intersectBatch(const Vector2 *First, std::size_t FirstCount,
+                               LineType FirstType, const Vector2 *Second,
+                               std::size_t SecondCount, LineType SecondType,
+                               std::vector<LineIntersection> &Out);
 };
 
 class Circle : public Shape {
@@ -67,6 +225,10 @@ class Circle : public Shape {
     Vector2 m_origin;
     float m_radius;
 
+  public:
+    //! @brief Maximum number of intersections with a line
+    static constexpr std::size_t MaxIntersections = 2;
+
   public:
     Circle(Vector2 origin, float radius = 1.0f);
     virtual ~Circle() = default;
@@ -78,8 +240,72 @@ class Circle : public Shape {
     virtual std::vector<Vector2>
     intersectLine(Vector2 a, Vector2 b,
                   LineType type = LineType::LINE) const final;
+    virtual std::size_t intersectLine(Vector2 a, Vector2 b, LineType type,
+                                      Vector2 *Out,
+                                      std::size_t Capacity) const final;
+
+    /**
+     * @brief Tests @c Points.size() points, writing whether they are inside
+     * to @c Masks, bit @c i % 32 of @c Masks[i / 32] for point @c i
+     *
+     * Tests 8 points at a time with AVX, or 4 with SSE2, with the same
+     * comparison as isPointInside. @c Masks must have room for (size + 31) /
+     * 32 words; unused bits are cleared.
+     */
+    void containsPoints(const Vector2SoA &Points, std::uint32_t *Masks) const;
+
+    //! @brief Appends the indices of the points inside to @c Out, in
+    //! increasing order
+    void containsPoints(const Vector2SoA &Points,
+                        std::vector<std::size_t> &Out) const;
+
+    /**
+     * @brief Tests @c Points against each of the @c Count @c Circles, writing
+     * a row of (size + 31) / 32 mask words per circle to @c Masks, in the
+     * layout of containsPoints
+     *
+     * The points are tested in blocks small enough to stay in the L1 cache
+     * while every circle runs over them.
+     */
+    static void containsPoints(const Circle *Circles, std::size_t Count,
+                               const Vector2SoA &Points, std::uint32_t *Masks);
+
+    /**
+     * @brief Intersects every line, from @c Origins[i] along @c
+     * Directions[i], with every circle given by @c Centers and @c Radii,
+     * writing the parameters where it enters and exits the circle to @c
+     * Entries and @c Exits
+     *
+     * Line @c i writes the row of Centers.size() elements starting at @c i *
+     * Centers.size(). The point of parameter @c t is Origins[i] + t *
+     * Directions[i], so segments end at 1. Parameters outside of the line
+     * type, and both parameters of a missed circle, are NaN; a tangent line
+     * enters and exits at the same point. @c EntryPoints and @c ExitPoints
+     * receive the points themselves, NaN where the parameter is, unless they
+     * are null.
+     *
+     * Runs over 8 circles at a time with AVX, or 4 with SSE2. The line type
+     * is a template parameter, so its range check compiles into the loop.
+     */
+    template <LineType Type>
+    static void intersectLines(const Vector2SoA &Origins,
+                               const Vector2SoA &Directions,
+                               const Vector2SoA &Centers, const float *Radii,
+                               float *Entries, float *Exits,
+                               Vector2 *EntryPoints = nullptr,
+                               Vector2 *ExitPoints = nullptr);
+
+    //! @brief Dispatches to the @c intersectLines of @c Type
+    static void intersectLines(const Vector2SoA &Origins,
+                               const Vector2SoA &Directions, LineType Type,
+                               const Vector2SoA &Centers, const float *Radii,
+                               float *Entries, float *Exits,
+                               Vector2 *EntryPoints = nullptr,
+                               Vector2 *ExitPoints = nullptr);
 };
 
+class PolygonView;
+
 class Polygon : public Shape {
     friend struct std::hash<Polygon>;
 
@@ -103,11 +329,27 @@ class Polygon : public Shape {
 
   public:
     Polygon(const std::vector<Vector2> &points);
+    Polygon(std::vector<Vector2> &&points);
     Polygon(const Polygon &other);
+    Polygon(Polygon &&other) noexcept;
     Polygon(std::initializer_list<Vector2> list);
+
+    //! @brief Copies the points of @c view
+    explicit Polygon(const PolygonView &view);
     virtual ~Polygon() = default;
 
-    std::vector<Vector2> getPoints() const;
+    Polygon &operator=(const Polygon &other) = default;
+    Polygon &operator=(Polygon &&other) noexcept = default;
+
+    //! @brief Returns the points, valid until the polygon changes or dies
+    PointSpan getPoints() const;
+
+    //! @brief Returns the area, centroid and perimeter, computed in one pass
+    PolygonMetrics getMetrics(Summation Mode = Summation::FAST) const;
+    float getArea() const;
+    Vector2 getCentroid() const;
+    float getPerimeter() const;
+    Winding getWinding() const;
 
     virtual bool isPointInside(Vector2 point) const override;
 
@@ -117,6 +359,120 @@ class Polygon : public Shape {
     virtual std::vector<Vector2>
     intersectLine(Vector2 a, Vector2 b,
                   LineType type = LineType::LINE) const override;
+
+    /**
+     * @note A polygon has at most as many intersections as edges. If there
+     * are more than @c Capacity, the ones with the smallest parameters along
+     * the line from @c a to @c b are written, in that order; for a LINE,
+     * those are not the nearest to @c a when some hits are behind it.
+     */
+    virtual std::size_t intersectLine(Vector2 a, Vector2 b, LineType type,
+                                      Vector2 *Out,
+                                      std::size_t Capacity) const override;
+};
+
+/**
+ * @brief Polygon over points it does not own, such as a range of a large
+ * shared vertex buffer
+ *
+ * Answers the queries of Polygon without copying the points; only the
+ * bounding rectangle is computed on construction. The points must outlive
+ * the view and must not change while it exists.
+ */
+class PolygonView : public Shape {
+  private:
+    PointSpan m_points;
+
+  public:
+    PolygonView(PointSpan points = {});
+    PolygonView(const Vector2 *points, std::size_t count);
+
+    //! @brief Views @c count points stored as x, y pairs of @c coordinates
+    PolygonView(const float *coordinates, std::size_t count);
+
+    /**
+     * @brief Views the points of @c polygon
+     * @note The view must not outlive @c polygon, so temporaries are
+     * rejected
+     */
+    explicit PolygonView(const Polygon &polygon);
+    PolygonView(Polygon &&polygon) = delete;
+    virtual ~PolygonView() = default;
+
+    PointSpan getPoints() const;
+
+    //! @brief Returns the area, centroid and perimeter, computed in one pass
+    PolygonMetrics getMetrics(Summation Mode = Summation::FAST) const;
+    float getArea() const;
+    Vector2 getCentroid() const;
+    float getPerimeter() const;
+    Winding getWinding() const;
+
+    virtual bool isPointInside(Vector2 point) const override;
+
+    std::vector<Polygon::EdgeIntersection>
+    intersectLineEx(Vector2 a, Vector2 b, LineType type = LineType::LINE) const;
+
+    virtual std::vector<Vector2>
+    intersectLine(Vector2 a, Vector2 b,
+                  LineType type = LineType::LINE) const override;
+
+    /**
+     * @note A polygon has at most as many intersections as edges. If there
+     * are more than @c Capacity, the ones with the smallest parameters along
+     * the line from @c a to @c b are written, in that order; for a LINE,
+     * those are not the nearest to @c a when some hits are behind it.
+     */
+    virtual std::size_t intersectLine(Vector2 a, Vector2 b, LineType type,
+                                      Vector2 *Out,
+                                      std::size_t Capacity) const override;
+};
+
+/**
+ * @brief Polygon with an edge table for fast containment queries
+ *
+ * The plane is split into horizontal slabs at the vertices, and every slab
+ * stores the edges crossing it, ordered from left to right. A query finds the
+ * slab with a binary search, then counts the edges right of the point with
+ * another one, so it takes O(log n) and never allocates. Slabs where edges of
+ * a self-intersecting polygon cross are scanned linearly instead.
+ *
+ * Uses the even-odd rule; points on the bottom and left edges count as
+ * inside, points on the top and right edges do not.
+ */
+class PreparedPolygon : public Polygon {
+  private:
+    struct Edge {
+        float x;
+        float y;
+        float slope;
+
+        inline float xAt(float Y) const { return x + (Y - y) * slope; }
+    };
+
+    //! @brief Lower y of the slabs, followed by the upper y of the last one
+    std::vector<float> m_slabY;
+
+    //! @brief Offsets of the edges of the slabs in m_slabEdges
+    std::vector<std::size_t> m_slabOffsets;
+    std::vector<Edge> m_slabEdges;
+    std::vector<unsigned char> m_slabOrdered;
+
+  private:
+    void prepare();
+
+  public:
+    PreparedPolygon(const std::vector<Vector2> &points);
+    PreparedPolygon(const Polygon &other);
+    PreparedPolygon(Polygon &&other);
+    PreparedPolygon(std::initializer_list<Vector2> list);
+    virtual ~PreparedPolygon() = default;
+
+    virtual bool isPointInside(Vector2 point) const override;
+
+    //! @brief Writes whether each of the @c Count @c Points is inside to @c Out
+    void containsPoints(const Vector2 *Points, bool *Out,
+                        std::size_t Count) const;
 };
 } // namespace Calcda
 
@@ -2,6 +2,7 @@
 #define CALCDA_INTRINSIC_H
 
 #include <cstddef>
+#include <new>
 #include <stdarg.h>
 
 #ifndef CALCDA_NO_IF_CONSTEXPR
@@ -10,6 +11,49 @@
 #define CALCDA_IF_CONSTEXPR if
 #endif
 
+//! @brief Marks a pointer as not aliasing any other pointer in scope
+#define CALCDA_RESTRICT __restrict
+
+/*
+ * With CALCDA_HEADER_ONLY_VECTORS the Vector classes are defined in the
+ * headers, the trivial operations become constexpr, so they can be inlined
+ * and constant-folded without LTO.
+ */
+#ifdef CALCDA_HEADER_ONLY_VECTORS
+#define CALCDA_VECTOR_INLINE inline
+#define CALCDA_VECTOR_CONSTEXPR constexpr
+#else
+#define CALCDA_VECTOR_INLINE
+#define CALCDA_VECTOR_CONSTEXPR
+#endif
+
+/*
+ * SIMD backend selection, based on the target flags of the compiler.
+ * Define CALCDA_NO_SIMD to force the scalar paths; define CALCDA_STRICT_MATH
+ * to keep the SIMD kernels bit-compatible with the scalar paths (no FMA; the
+ * build must also turn off contraction, as the CALCDA_STRICT_MATH option of
+ * CMakeLists.txt does).
+ */
+#ifndef CALCDA_NO_SIMD
+#if defined(__AVX__)
+#define CALCDA_SIMD_AVX
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) ||                                    \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CALCDA_SIMD_SSE2
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define CALCDA_SIMD_NEON
+#endif
+
+#if !defined(CALCDA_STRICT_MATH) &&                                            \
+    (defined(__FMA__) || defined(__ARM_FEATURE_FMA))
+#define CALCDA_SIMD_FMA
+#endif
+#endif // !CALCDA_NO_SIMD
+
 namespace Calcda {
 namespace Internal {
 inline std::size_t hash_combine(std::size_t left, std::size_t right) {
@@ -52,6 +96,43 @@ template <typename... T> inline std::size_t hash_combine(T... hashes) {
 }
 #endif
 
+//! @brief Alignment of the bulk data streams, enough for aligned AVX loads
+constexpr std::size_t SimdAlignment = 32;
+
+//! @brief Allocator returning memory aligned to @c Alignment bytes
+template <typename T, std::size_t Alignment = SimdAlignment>
+struct AlignedAllocator {
+    using value_type = T;
+
+    template <typename U> struct rebind {
+        using other = AlignedAllocator<U, Alignment>;
+    };
+
+    AlignedAllocator() noexcept = default;
+
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment> &) noexcept {}
+
+    T *allocate(std::size_t n) {
+        return static_cast<T *>(
+            ::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+    }
+
+    void deallocate(T *p, std::size_t) noexcept {
+        ::operator delete(p, std::align_val_t(Alignment));
+    }
+
+    template <typename U>
+    bool operator==(const AlignedAllocator<U, Alignment> &) const noexcept {
+        return true;
+    }
+
+    template <typename U>
+    bool operator!=(const AlignedAllocator<U, Alignment> &) const noexcept {
+        return false;
+    }
+};
+
 } // namespace Internal
 } // namespace Calcda
 
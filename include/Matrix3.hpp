@@ -121,6 +121,9 @@ class Matrix3 {
      * @brief Calculates a rotation on @c RotateAxis
      * @param RotateAxis X, Y, or Z axis, for the rotation to be calculated on
      * @param Amount Amount of rotation, in radians
+     * @note Turns clockwise around the axis for column vectors, the opposite
+     * of Quaternion: @c rotation(Axis::Z, Amount) is the transpose of @c
+     * Quaternion::fromAxisAngle(Vector3::UnitZ, Amount).toMatrix3()
      */
     static Matrix3 rotation(Axis RotateAxis, double Amount);
 
@@ -10,148 +10,225 @@
 #include "Vector3.hpp"  // Calcda::Vector3
 #include "Vector4.hpp"  // Calcda::Vector4
 
+#include <optional>
 #include <string>
 
 namespace Calcda {
-//! @brief Class for handling 4x4 matrices
-class Matrix4 {
+/**
+ * @brief Class for handling 4x4 matrices
+ *
+ * Matrix4 holds floats and Matrix4d doubles, for transforms of coordinates
+ * too large for float precision. Both are instantiated in the library, and
+ * the products and batch transforms have SIMD kernels for either width.
+ */
+template <typename T> class BasicMatrix4 {
   public:
     //! @brief Containing union type
     union container_t {
         struct {
-            float m00;
-            float m01;
-            float m02;
-            float m03;
-            float m10;
-            float m11;
-            float m12;
-            float m13;
-            float m20;
-            float m21;
-            float m22;
-            float m23;
-            float m30;
-            float m31;
-            float m32;
-            float m33;
+            T m00;
+            T m01;
+            T m02;
+            T m03;
+            T m10;
+            T m11;
+            T m12;
+            T m13;
+            T m20;
+            T m21;
+            T m22;
+            T m23;
+            T m30;
+            T m31;
+            T m32;
+            T m33;
         };
 
         //! @brief 4 by 4 layout
-        float matrix[4][4];
+        T matrix[4][4];
 
         //! @brief row matrix layout
-        float data[16];
+        T data[16];
     } value;
 
   public:
-    Matrix4();
-    Matrix4(const std::initializer_list<float> &List);
-    Matrix4(const Matrix4 &Other);
-    Matrix4(const Matrix3 &Base);
-    ~Matrix4();
+    BasicMatrix4();
+    BasicMatrix4(const std::initializer_list<T> &List);
+    BasicMatrix4(const BasicMatrix4 &Other);
+    BasicMatrix4(const Matrix3 &Base);
+    ~BasicMatrix4();
+
+    //! @brief Converts the elements of @c Other, e.g. a Matrix4d to a Matrix4
+    template <typename U> explicit BasicMatrix4(const BasicMatrix4<U> &Other) {
+        for (std::size_t index = 0; index < 16; ++index) {
+            value.data[index] = static_cast<T>(Other.value.data[index]);
+        }
+    }
 
     //! @brief Requests the 1st row
-    Vector4 r01() const;
+    BasicVector4<T> r01() const;
 
     //! @brief Requests the 2nd row
-    Vector4 r02() const;
+    BasicVector4<T> r02() const;
 
     //! @brief Requests the 3rd row
-    Vector4 r03() const;
+    BasicVector4<T> r03() const;
 
     //! @brief Requests the 4th row
-    Vector4 r04() const;
+    BasicVector4<T> r04() const;
 
     //! @brief Requests the 1st column
-    Vector4 c01() const;
+    BasicVector4<T> c01() const;
 
     //! @brief Requests the 2nd column
-    Vector4 c02() const;
+    BasicVector4<T> c02() const;
 
     //! @brief Requests the 3rd column
-    Vector4 c03() const;
+    BasicVector4<T> c03() const;
 
     //! @brief Requests the 4th column
-    Vector4 c04() const;
+    BasicVector4<T> c04() const;
 
     //! @brief Returns a pointer to the beginning of the data
-    float *getData();
+    T *getData();
 
     //! @brief Returns a const pointer to the beginning of the data
-    const float *getData() const;
+    const T *getData() const;
 
     //! @brief Multiplies the matrix by @c Other
-    Matrix4 &selfMultiply(const Matrix4 &Other);
+    BasicMatrix4 &selfMultiply(const BasicMatrix4 &Other);
 
     //! @brief Divides the matrix by @c Other (multiplies by the inverse of @c
     //! Other)
-    Matrix4 &selfDivide(const Matrix4 &Other);
+    BasicMatrix4 &selfDivide(const BasicMatrix4 &Other);
 
     //! @brief Calculates the inverse temporal of the current matrix
-    Matrix4 calculateInverseTemporal() const;
+    BasicMatrix4 calculateInverseTemporal() const;
 
     /**
      * @brief Calculates the determinant for the current matrix
      * @param InverseTemporal inverse temporal of the current matrix, optional
      */
-    double calculateDeterminant(Matrix4 *InverseTemporal = nullptr) const;
+    double calculateDeterminant(BasicMatrix4 *InverseTemporal = nullptr) const;
 
     /**
      * @brief Calculates the inverse of the current matrix
      * @param InverseTemporal Optional; inverse temporal of the matrix
      * @param Determinant Optional; determinant of the matrix
      */
-    Matrix4 inverse(Matrix4 *InverseTemporal = nullptr,
-                    double *Determinant = nullptr) const;
+    BasicMatrix4 inverse(BasicMatrix4 *InverseTemporal = nullptr,
+                         double *Determinant = nullptr) const;
+
+    /**
+     * @brief Calculates the inverse in the element precision from the 2x2
+     * sub-determinants, with the SSE2 kernel for floats when available
+     * @note Unchecked; singular matrices give infinite or NaN elements
+     */
+    BasicMatrix4 inverseUnchecked() const;
+
+    //! @brief Calculates the inverse like inverseUnchecked, or returns
+    //! nothing if the matrix is singular
+    std::optional<BasicMatrix4> inverseChecked() const;
+
+    /**
+     * @brief Calculates the inverse of an affine transform, a matrix whose
+     * last row is 0, 0, 0, 1, by inverting the upper 3x3 block
+     * @note Unchecked; the last row is not read
+     */
+    BasicMatrix4 inverseAffine() const;
+
+    /**
+     * @brief Calculates the inverse of a rigid transform, a rotation followed
+     * by a translation, by transposing the rotation
+     * @note Unchecked; the rotation must be orthonormal, without scaling
+     */
+    BasicMatrix4 inverseRigid() const;
 
     //! @brief Returns the current matrix divided by @c Other
-    Matrix4 divide(const Matrix4 &Other) const;
+    BasicMatrix4 divide(const BasicMatrix4 &Other) const;
 
-    //! @brief Returns the current matrix multiplied by @c Other
-    Matrix4 multiply(const Matrix4 &Other) const;
+    /**
+     * @brief Returns the current matrix multiplied by @c Other
+     * @note Uses the AVX, SSE2 or NEON kernel when available; with
+     * @c CALCDA_STRICT_MATH the result is bit-identical to the scalar path
+     */
+    BasicMatrix4 multiply(const BasicMatrix4 &Other) const;
 
     //! @brief Multiplies the current matrix with the vector @c Other, then
     //! returns the vector result
-    Vector4 multiply(const Vector4 &Other) const;
+    BasicVector4<T> multiply(const BasicVector4<T> &Other) const;
+
+    /**
+     * @brief Multiplies the current matrix with @c Count vectors read from @c
+     * In, writing the results to @c Out
+     * @param InStride Distance between two input vectors in bytes, for reading
+     * interleaved vertex buffers; 0 means tightly packed
+     * @param OutStride Distance between two output vectors in bytes; 0 means
+     * tightly packed
+     * @note @c In and @c Out may point to the same buffer, with the same stride
+     */
+    void transformBatch(const BasicVector4<T> *In, BasicVector4<T> *Out,
+                        std::size_t Count, std::size_t InStride = 0,
+                        std::size_t OutStride = 0) const;
+
+    /**
+     * @brief Transforms @c Count points (vectors with an implicit W of 1) read
+     * from @c In, writing the X, Y, Z elements of the results to @c Out
+     * @see transformBatch
+     */
+    void transformPoints(const BasicVector3<T> *In, BasicVector3<T> *Out,
+                         std::size_t Count, std::size_t InStride = 0,
+                         std::size_t OutStride = 0) const;
+
+    /**
+     * @brief Transforms @c Count directions (vectors with an implicit W of 0)
+     * read from @c In, writing the X, Y, Z elements of the results to @c Out
+     * @see transformBatch
+     */
+    void transformDirections(const BasicVector3<T> *In, BasicVector3<T> *Out,
+                             std::size_t Count, std::size_t InStride = 0,
+                             std::size_t OutStride = 0) const;
 
     //! @brief Transposes the current matrix (flips it along its top-left to
     //! bottom-right diagonal)
-    Matrix4 transpose() const;
+    BasicMatrix4 transpose() const;
 
     //! @brief Negates every value in the matrix
-    Matrix4 negate() const;
+    BasicMatrix4 negate() const;
 
-    Matrix4 operator*(const Matrix4 &Other) const;
-    Vector4 operator*(const Vector4 &Other) const;
-    Matrix4 operator/(const Matrix4 &Other) const;
-    Matrix4 operator-() const;
+    BasicMatrix4 operator*(const BasicMatrix4 &Other) const;
+    BasicVector4<T> operator*(const BasicVector4<T> &Other) const;
+    BasicMatrix4 operator/(const BasicMatrix4 &Other) const;
+    BasicMatrix4 operator-() const;
 
-    Matrix4 &operator*=(const Matrix4 &Other);
-    Matrix4 &operator/=(const Matrix4 &Other);
-    Matrix4 &operator=(const Matrix4 &Other);
+    BasicMatrix4 &operator*=(const BasicMatrix4 &Other);
+    BasicMatrix4 &operator/=(const BasicMatrix4 &Other);
+    BasicMatrix4 &operator=(const BasicMatrix4 &Other);
 
-    bool operator==(const Matrix4 &Other) const;
-    bool operator!=(const Matrix4 &Other) const;
+    bool operator==(const BasicMatrix4 &Other) const;
+    bool operator!=(const BasicMatrix4 &Other) const;
 
     /**
      * @brief Calculates a rotation on @c RotateAxis
      * @param RotateAxis X, Y, or Z axis, for the rotation to be calculated on
      * @param Amount Amount of rotation, in radians
+     * @note Turns clockwise around the axis for column vectors, the opposite
+     * of Quaternion: @c rotation(Axis::Z, Amount) is the transpose of @c
+     * Quaternion::fromAxisAngle(Vector3::UnitZ, Amount).toMatrix4()
      */
-    static Matrix4 rotation(Axis RotateAxis, double Amount);
+    static BasicMatrix4 rotation(Axis RotateAxis, double Amount);
 
     //! @brief Transforms the matrix with @c X, @c Y, @c Z
-    static Matrix4 translation(float X, float Y, float Z);
+    static BasicMatrix4 translation(T X, T Y, T Z);
 
     //! @brief Transforms the matrix with @c Point.x, @c Point.y, @c Point.z
-    static Matrix4 translation(Vector3 Point);
+    static BasicMatrix4 translation(BasicVector3<T> Point);
 
     //! @brief Scales the matrix with @c X, @c Y, @c Z
-    static Matrix4 scale(float X, float Y, float Z);
+    static BasicMatrix4 scale(T X, T Y, T Z);
 
     //! @brief Scales the matrix with @c Point.x, @c Point.y, @c Point.z
-    static Matrix4 scale(Vector3 Point);
+    static BasicMatrix4 scale(BasicVector3<T> Point);
 
     /**
      * @brief Returns an orthographic projection matrix.
@@ -165,8 +242,8 @@ class Matrix4 {
      * @param Near Near plane
      * @param Far Far plane
      */
-    static Matrix4 orthographic(float Left, float Right, float Top,
-                                float Bottom, float Near, float Far);
+    static BasicMatrix4 orthographic(T Left, T Right, T Top, T Bottom, T Near,
+                                     T Far);
 
     /**
      * @brief Returns a camera projection
@@ -175,14 +252,15 @@ class Matrix4 {
      * @param Center Position to look at
      * @param Up Up direction
      */
-    static Matrix4 lookAt(Vector3 EyePosition, Vector3 Center, Vector3 Up);
+    static BasicMatrix4 lookAt(BasicVector3<T> EyePosition,
+                               BasicVector3<T> Center, BasicVector3<T> Up);
 
     /**
      * @brief Returns a frustum projection
      * [Viewing frustum](https://en.wikipedia.org/wiki/Viewing_frustum)
      */
-    static Matrix4 frustum(float Left, float Right, float Top, float Bottom,
-                           float Near, float Far);
+    static BasicMatrix4 frustum(T Left, T Right, T Top, T Bottom, T Near,
+                                T Far);
 
     /**
      * @brief Returns a perspective projection, with @c Fov in radians
@@ -192,8 +270,7 @@ class Matrix4 {
      * @param Near Near plane
      * @param Far Far plane
      */
-    static Matrix4 perspective(float Fov, float AspectRatio, float Near,
-                               float Far);
+    static BasicMatrix4 perspective(T Fov, T AspectRatio, T Near, T Far);
 
     /**
      * @brief Returns a perspective projection, with @c Fov in radians, flipped
@@ -204,12 +281,12 @@ class Matrix4 {
      * @param Near Near plane
      * @param Far Far plane
      */
-    static Matrix4 perspectiveFlippedY(float Fov, float AspectRatio, float Near,
-                                       float Far);
+    static BasicMatrix4 perspectiveFlippedY(T Fov, T AspectRatio, T Near,
+                                            T Far);
 
     //! @brief Returns a projection matrix
-    static Matrix4 projection(float Left, float Right, float Top, float Bottom,
-                              float Near, float Far);
+    static BasicMatrix4 projection(T Left, T Right, T Top, T Bottom, T Near,
+                                   T Far);
 
     std::string toString() const;
     std::string toStringO(unsigned int Padding = 0,
@@ -217,9 +294,17 @@ class Matrix4 {
 
     //! @brief Identity matrix, 0 everywhere, except the top-left to
     //! bottom-right diagonal, where it is 1
-    static const Matrix4 Identity;
+    static const BasicMatrix4 Identity;
 };
 
+using Matrix4 = BasicMatrix4<float>;
+using Matrix4d = BasicMatrix4<double>;
+
+#ifndef SWIG
+// instantiated in src/Matrix4.cpp
+extern template class BasicMatrix4<float>;
+extern template class BasicMatrix4<double>;
+#endif
 } // namespace Calcda
 
 #endif // !CALCDA_MATRIX4_H
\ No newline at end of file
@@ -0,0 +1,99 @@
+#ifndef CALCDA_PREDICATES_H
+#define CALCDA_PREDICATES_H
+
+#include "Vector2.hpp" // Calcda::Vector2
+
+#include <cmath>
+#include <cstddef>
+
+namespace Calcda {
+/**
+ * @brief Geometric predicates with exact signs, after J. R. Shewchuk,
+ * Adaptive Precision Floating-Point Arithmetic and Fast Robust Geometric
+ * Predicates (1997)
+ *
+ * Each predicate is first evaluated in double precision, and the result is
+ * returned if it is larger than the error bound of that evaluation; only the
+ * nearly degenerate cases fall back to exact arithmetic on floating-point
+ * expansions. The sign of the result is always exact; its magnitude is an
+ * approximation.
+ *
+ * With CALCDA_ROBUST_PREDICATES defined, the Line tests and intersections
+ * (and the Polygon ones built on them) take their decisions from these.
+ */
+namespace Predicates {
+namespace Internal {
+// error bound of the double precision cross product, relative to the sum of
+// the magnitudes of its two products (Shewchuk's ccwerrboundA)
+constexpr double CrossBound = (3.0 + 16.0 / 9007199254740992.0) /
+                              9007199254740992.0;
+
+/*
+ * Shewchuk's arithmetic on expansions: sums of doubles ordered by increasing
+ * magnitude, without overlapping bits and without zeros, whose sign is the
+ * sign of the last one. The results are written to H, which must hold
+ * ESize + FSize components for a sum and 2 * ESize for a scaling; the
+ * number written is returned.
+ */
+std::size_t expansionSum(std::size_t ESize, const double *E, std::size_t FSize,
+                         const double *F, double *H);
+std::size_t expansionScale(std::size_t ESize, const double *E, double B,
+                           double *H);
+
+//! @brief Approximates the value of an expansion, with its exact sign
+double expansionEstimate(std::size_t ESize, const double *E);
+
+//! @brief Upper bound of the number of components of cross2dExpansion
+constexpr std::size_t CrossExpansionSize = 16;
+
+//! @brief Writes the exact value of cross2d as an expansion to @c H
+std::size_t cross2dExpansion(Vector2 A, Vector2 B, Vector2 C, Vector2 D,
+                             double *H);
+
+//! @brief The exact evaluation of cross2d, for the uncertain cases
+double cross2dExact(Vector2 A, Vector2 B, Vector2 C, Vector2 D);
+} // namespace Internal
+
+/**
+ * @brief Returns the cross product of @c B - @c A and @c D - @c C, with an
+ * exact sign; zero if the directions are parallel
+ *
+ * The double precision evaluation is inline, so the common cases cost about
+ * as much as a plain cross product.
+ */
+inline double cross2d(Vector2 A, Vector2 B, Vector2 C, Vector2 D) {
+    const double left = (static_cast<double>(B.x) - A.x) *
+                        (static_cast<double>(D.y) - C.y),
+                 right = (static_cast<double>(B.y) - A.y) *
+                         (static_cast<double>(D.x) - C.x);
+    const double result = left - right;
+
+    if (std::abs(result) >
+        Internal::CrossBound * (std::abs(left) + std::abs(right)))
+        return result;
+
+    return Internal::cross2dExact(A, B, C, D);
+}
+
+/**
+ * @brief Returns a positive value if @c A, @c B, @c C turn counterclockwise,
+ * a negative one if they turn clockwise, and zero if they are collinear
+ *
+ * The value approximates twice the signed area of the triangle.
+ */
+inline double orient2d(Vector2 A, Vector2 B, Vector2 C) {
+    return cross2d(A, B, A, C);
+}
+
+/**
+ * @brief Returns a positive value if @c D is inside the circle through @c A,
+ * @c B, @c C, a negative one if it is outside, and zero if it is on the
+ * circle
+ * @note @c A, @c B, @c C must turn counterclockwise, otherwise the sign is
+ * reversed
+ */
+double incircle(Vector2 A, Vector2 B, Vector2 C, Vector2 D);
+} // namespace Predicates
+} // namespace Calcda
+
+#endif // !CALCDA_PREDICATES_H
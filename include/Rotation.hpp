@@ -11,6 +11,12 @@
 
 #include "Intrinsic.hpp"
 
+#include "Vector3.hpp" // Calcda::Vector3
+
+#include <cstddef>
+#include <string>
+#include <tuple>
+
 namespace Calcda {
 //! @brief Enumerator for handling axes
 enum class Axis { X, Y, Z };
@@ -19,6 +25,122 @@ namespace Conversion {
 float degreeToRadian(float Degree);
 float radianToDegree(float Radian);
 } // namespace Conversion
+
+class Matrix3;
+template <typename T> class BasicMatrix4;
+using Matrix4 = BasicMatrix4<float>;
+
+/**
+ * @brief Class for rotations as unit quaternions
+ *
+ * Rotations are counterclockwise around the axis, for column vectors: the
+ * matrix of a quaternion rotates a vector @c v as @c rotate(v) does with @c
+ * toMatrix3().multiply(v). A product @c a * b rotates by @c b first, then by
+ * @c a, like the product of their matrices.
+ *
+ * @note Matrix3::rotation and Matrix4::rotation turn the other way, so @c
+ * fromAxisAngle(Vector3::UnitZ, a).toMatrix4() is @c
+ * Matrix4::rotation(Axis::Z, -a), the transpose of @c
+ * Matrix4::rotation(Axis::Z, a)
+ */
+class Quaternion {
+  public:
+    float x;
+    float y;
+    float z;
+    float w;
+
+  public:
+    // 0; 0; 0; 1 - No rotation
+    static const Quaternion Identity;
+
+  public:
+    constexpr Quaternion() : x(0.0f), y(0.0f), z(0.0f), w(1.0f) {}
+    constexpr Quaternion(float X, float Y, float Z, float W)
+        : x(X), y(Y), z(Z), w(W) {}
+
+    /**
+     * @brief Returns the rotation by @c Angle radians around @c RotateAxis
+     * @note @c RotateAxis does not need to be normalized
+     */
+    static Quaternion fromAxisAngle(Vector3 RotateAxis, float Angle);
+
+    //! @brief Returns the rotation of the orthonormal matrix @c Rotation
+    static Quaternion fromMatrix(const Matrix3 &Rotation);
+
+    //! @brief Returns the rotation of the upper 3x3 block of @c Rotation
+    static Quaternion fromMatrix(const Matrix4 &Rotation);
+
+    //! @brief Returns the normalized axis and the angle in radians, between 0
+    //! and 2π; the axis is X if there is no rotation
+    std::tuple<Vector3, float> toAxisAngle() const;
+
+    Matrix3 toMatrix3() const;
+    Matrix4 toMatrix4() const;
+
+    //! @brief Returns the rotation by @c Other, followed by the current one
+    Quaternion multiply(const Quaternion &Other) const;
+    Quaternion &selfMultiply(const Quaternion &Other);
+
+    //! @brief Rotates @c Point; the quaternion must be normalized
+    Vector3 rotate(Vector3 Point) const;
+
+    //! @brief Returns the conjugate, the inverse of a normalized quaternion
+    Quaternion conjugate() const;
+    Quaternion inverse() const;
+
+    float length() const;
+    float lengthSquared() const;
+
+    Quaternion normalize() const;
+    Quaternion &selfNormalize();
+
+    static float dot(const Quaternion &Left, const Quaternion &Right);
+
+    /**
+     * @brief Interpolates linearly, along the shorter arc, then normalizes;
+     * cheaper than slerp, but the angular speed is not constant
+     */
+    static Quaternion nlerp(const Quaternion &From, const Quaternion &To,
+                            float Amount);
+
+    //! @brief Interpolates with constant angular speed, along the shorter arc
+    static Quaternion slerp(const Quaternion &From, const Quaternion &To,
+                            float Amount);
+
+    /**
+     * @brief Writes the slerp of @c From[i] and @c To[i] by @c Amount[i] to
+     * @c Out[i], for @c Count quaternions
+     *
+     * Evaluates sin(tθ) / sin θ with a polynomial in cos θ instead of calling
+     * acos and sin, so the loop vectorizes; the error is about 1e-6 for
+     * normalized inputs. @c Out may alias @c From or @c To.
+     */
+    static void slerpBatch(const Quaternion *From, const Quaternion *To,
+                           const float *Amount, Quaternion *Out,
+                           std::size_t Count);
+
+    Quaternion operator*(const Quaternion &Other) const;
+    Vector3 operator*(Vector3 Point) const;
+    Quaternion operator-() const;
+
+    Quaternion &operator*=(const Quaternion &Other);
+
+    bool operator==(const Quaternion &Other) const;
+    bool operator!=(const Quaternion &Other) const;
+
+    std::string toString() const;
+};
 } // namespace Calcda
 
-#endif // !CALCDA_ROTATION_H
\ No newline at end of file
+namespace std {
+template <> struct hash<Calcda::Quaternion> {
+    size_t operator()(const Calcda::Quaternion &v) const noexcept {
+        return Calcda::Internal::hash_combine(
+            hash<float>()(v.x), hash<float>()(v.y), hash<float>()(v.z),
+            hash<float>()(v.w));
+    }
+};
+} // namespace std
+
+#endif // !CALCDA_ROTATION_H
@@ -0,0 +1,36 @@
+#ifndef CALCDA_SEGMENTINTERSECTION_H
+#define CALCDA_SEGMENTINTERSECTION_H
+
+#include "Geometry.hpp" // Calcda::Line, Calcda::LineIntersection
+#include "Vector2.hpp"  // Calcda::Vector2
+
+#include <cstddef>
+#include <vector>
+
+namespace Calcda {
+/**
+ * @brief Returns every intersection among the segments with a Bentley-Ottmann
+ * sweep
+ *
+ * Takes O((n + k) log n) time for n segments and k intersecting pairs,
+ * instead of the O(n²) of testing every pair. Segment @c i goes from @c
+ * Points[2 * i] to @c Points[2 * i + 1].
+ *
+ * Every intersecting pair is reported once, with @c first < @c second, ordered
+ * by @c first, then @c second. Touching segments intersect: shared endpoints
+ * and endpoints on other segments are reported with a parameter of 0 or 1,
+ * and collinear overlapping segments at the start of the overlap. The
+ * decisions of the sweep are exact, as with Predicates::orient2d, so nearly
+ * collinear segments are neither missed nor merged; only the reported points
+ * and parameters are rounded.
+ */
+std::vector<LineIntersection> intersectSegments(const Vector2 *Points,
+                                                std::size_t Count);
+
+//! @brief Sweeps the points of @c Segments; the line types are ignored, every
+//! line is treated as the segment between its points
+std::vector<LineIntersection>
+intersectSegments(const std::vector<Line> &Segments);
+} // namespace Calcda
+
+#endif // !CALCDA_SEGMENTINTERSECTION_H
@@ -0,0 +1,115 @@
+#ifndef CALCDA_TRANSFORMHIERARCHY_H
+#define CALCDA_TRANSFORMHIERARCHY_H
+
+#include "Matrix4.hpp"   // Calcda::Matrix4
+#include "Transform.hpp" // Calcda::Transform
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace Calcda {
+/**
+ * @brief Class for a scene graph of transforms, stored as flat arrays
+ *
+ * Node @c i has a local matrix, relative to its parent, and a world matrix,
+ * the product of the world matrix of its parent and its local matrix. Parents
+ * are added before their children, so the arrays are in topological order and
+ * one pass from the front updates every world matrix.
+ *
+ * Changing a local matrix marks the node dirty; update recomputes the world
+ * matrices of the dirty nodes and their descendants only, and leaves the rest
+ * of the hierarchy untouched.
+ */
+class TransformHierarchy {
+  public:
+    //! @brief Parent of the roots of the hierarchy
+    static constexpr std::size_t NoParent =
+        std::numeric_limits<std::size_t>::max();
+
+  private:
+    std::vector<std::size_t> m_parents;
+    std::vector<Matrix4> m_locals;
+    std::vector<Matrix4> m_worlds;
+
+    std::vector<std::uint8_t> m_dirty;
+
+    //! @brief Update in which each node was last recomputed
+    std::vector<std::size_t> m_updated;
+    std::size_t m_stamp;
+
+    //! @brief Index of the first dirty node, or the size if there is none
+    std::size_t m_firstDirty;
+
+    //! @brief Nodes above the level split by updateParallel, in order
+    std::vector<std::size_t> m_topNodes;
+
+    /**
+     * @brief Nodes on and below the split level, grouped by their ancestor
+     * on it, each subtree in topological order
+     */
+    std::vector<std::size_t> m_subtreeNodes;
+
+    //! @brief Offsets of the subtrees in m_subtreeNodes, with the end last
+    std::vector<std::size_t> m_subtreeOffsets;
+
+    //! @brief Number of threads the subtrees were split for
+    unsigned int m_subtreeThreads;
+
+  private:
+    void markDirty(std::size_t Node);
+    void buildSubtrees(unsigned int Threads);
+    std::size_t updateNode(std::size_t Node);
+
+  public:
+    TransformHierarchy();
+
+    //! @brief Reserves memory for @c Count nodes
+    void reserve(std::size_t Count);
+
+    /**
+     * @brief Adds a node below @c Parent, or a root, and returns its index
+     * @note @c Parent must have been added already
+     */
+    std::size_t add(const Matrix4 &Local, std::size_t Parent = NoParent);
+    std::size_t add(const Transform &Local, std::size_t Parent = NoParent);
+
+    std::size_t size() const;
+
+    std::size_t getParent(std::size_t Node) const;
+    const Matrix4 &getLocal(std::size_t Node) const;
+
+    //! @brief Returns the world matrix of @c Node as of the last update
+    const Matrix4 &getWorld(std::size_t Node) const;
+
+    //! @brief Sets the local matrix of @c Node, marking it dirty
+    void setLocal(std::size_t Node, const Matrix4 &Local);
+    void setLocal(std::size_t Node, const Transform &Local);
+
+    /**
+     * @brief Recomputes the world matrices of the dirty nodes and their
+     * descendants
+     * @return The number of recomputed nodes
+     */
+    std::size_t update();
+
+    /**
+     * @brief Recomputes the world matrices like update, spreading the
+     * subtrees over @c Threads threads
+     *
+     * The nodes above the first level with at least @c Threads nodes are
+     * recomputed first, on the calling thread; the subtrees below that
+     * level are then shared out, so a single root with many children
+     * parallelizes too.
+     *
+     * @param Threads Number of threads; 0 uses the hardware concurrency
+     * @return The number of recomputed nodes
+     * @note Worth it for large hierarchies with many big subtrees; the
+     * threads are started for each call
+     */
+    std::size_t updateParallel(unsigned int Threads = 0);
+};
+} // namespace Calcda
+
+#endif // !CALCDA_TRANSFORMHIERARCHY_H
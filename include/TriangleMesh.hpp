@@ -0,0 +1,126 @@
+#ifndef CALCDA_TRIANGLEMESH_H
+#define CALCDA_TRIANGLEMESH_H
+
+#include "AABB3.hpp"     // Calcda::AABB3
+#include "Vector3.hpp"   // Calcda::Vector3
+#include "VectorSoA.hpp" // Calcda::Vector3SoA
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <vector>
+
+namespace Calcda {
+//! @brief Where a ray hits a triangle
+struct TriangleHit {
+    //! @brief Distance along the ray direction, in units of its length
+    float distance;
+
+    //! @brief Barycentric weights of the second and third vertex; the first
+    //! weighs 1 - u - v
+    float u;
+    float v;
+};
+
+/**
+ * @brief Intersects the ray from @c Origin along @c Direction with the
+ * triangle @c A, @c B, @c C (Möller-Trumbore)
+ *
+ * Both faces are hit, and the edges count as part of the triangle. Rays in the
+ * plane of the triangle miss it, as do hits past @c MaxDistance.
+ */
+std::optional<TriangleHit> intersectRayTriangle(
+    Vector3 Origin, Vector3 Direction, Vector3 A, Vector3 B, Vector3 C,
+    float MaxDistance = std::numeric_limits<float>::infinity());
+
+/**
+ * @brief Indexed triangle mesh with a bounding volume hierarchy for ray
+ * queries
+ *
+ * Built once with a binned surface area heuristic over the bounding boxes of
+ * the triangles, like BoundingVolumeHierarchy. The mesh keeps its own copy of
+ * the triangles, stored in the order of the leaves as a corner and two edges,
+ * which is what the intersection test reads.
+ *
+ * intersectRays traces coherent rays in packets, 8 at a time with AVX and 4
+ * with SSE2: a node is visited if any ray of the packet hits its box, and
+ * each triangle is tested against the whole packet at once.
+ */
+class TriangleMesh {
+  public:
+    //! @brief Triangle of a missed ray
+    static constexpr std::size_t NoTriangle =
+        std::numeric_limits<std::size_t>::max();
+
+    struct Hit {
+        //! @brief Index of the triangle in the input indices, or NoTriangle
+        std::size_t triangle;
+        float distance;
+        float u;
+        float v;
+    };
+
+  private:
+    struct Triangle {
+        Vector3 corner;
+        Vector3 edge1;
+        Vector3 edge2;
+    };
+
+    /*
+     * Leaves have count > 0 and own m_triangles[first, first + count); inner
+     * nodes have count == 0, their left child follows them directly, first is
+     * the index of the right child, and axis is the axis they are split on.
+     */
+    struct Node {
+        AABB3 bounds;
+        std::uint32_t first;
+        std::uint32_t count;
+        std::uint32_t axis;
+    };
+
+    std::vector<Triangle> m_triangles;
+    std::vector<std::uint32_t> m_indices;
+    std::vector<Node> m_nodes;
+
+  private:
+    void build(std::vector<AABB3> &Bounds, std::size_t Node,
+               std::size_t Begin, std::size_t End, unsigned Depth);
+
+  public:
+    TriangleMesh() = default;
+
+    /**
+     * @param Vertices Positions of the vertices
+     * @param Indices Three vertex indices per triangle
+     */
+    TriangleMesh(const std::vector<Vector3> &Vertices,
+                 const std::vector<std::uint32_t> &Indices);
+
+    std::size_t triangleCount() const;
+
+    //! @brief Returns the bounding box of every triangle
+    AABB3 getBounds() const;
+
+    //! @brief Returns the closest hit of the ray within @c MaxDistance
+    std::optional<Hit>
+    intersectRay(Vector3 Origin, Vector3 Direction,
+                 float MaxDistance = std::numeric_limits<float>::infinity())
+        const;
+
+    /**
+     * @brief Writes the closest hit of every ray to @c Hits, with NoTriangle
+     * and an infinite distance for missed rays
+     *
+     * The rays are traced in packets of consecutive rays, which pays off when
+     * they start close to each other and point in similar directions, like
+     * the rays of neighbouring pixels.
+     */
+    void intersectRays(
+        const Vector3SoA &Origins, const Vector3SoA &Directions, Hit *Hits,
+        float MaxDistance = std::numeric_limits<float>::infinity()) const;
+};
+} // namespace Calcda
+
+#endif // !CALCDA_TRIANGLEMESH_H
@@ -9,130 +9,151 @@
 namespace Calcda {
 /**
  * @brief Class for describing 2 dimensional vectors
+ *
+ * Vector2 holds floats and Vector2d doubles; other element types need
+ * CALCDA_HEADER_ONLY_VECTORS, as only these two are compiled in the library.
+ *
  * @see [Reference:
  * Intrinsics](https://referencesource.microsoft.com/#System.Numerics/System/Numerics/Vector2_Intrinsics.cs)
  * @see [Reference:
  * Vector2](https://referencesource.microsoft.com/#System.Numerics/System/Numerics/Vector2.cs)
  */
-class Vector2 {
+template <typename T> class BasicVector2 {
   public:
-    float x;
-    float y;
+    T x;
+    T y;
 
-    friend class Vector3;
-    friend class Vector4;
+    template <typename> friend class BasicVector3;
+    template <typename> friend class BasicVector4;
 
   public:
     // 0; 0 - Zero vector
-    static const Vector2 Zero;
+    static const BasicVector2 Zero;
 
     // 1; 1 - One vector
-    static const Vector2 One;
+    static const BasicVector2 One;
 
     // 1; 0 - X axisvector
-    static const Vector2 UnitX;
+    static const BasicVector2 UnitX;
 
     // 0; 1 - Y axisvector
-    static const Vector2 UnitY;
+    static const BasicVector2 UnitY;
 
   public:
-    constexpr Vector2() : x(0.0f), y(0.0f) {}
-    constexpr Vector2(const Vector2 &Other) : x(Other.x), y(Other.y) {}
-    constexpr Vector2(float X, float Y) : x(X), y(Y) {}
-    ~Vector2() = default;
+    constexpr BasicVector2() : x(0), y(0) {}
+    constexpr BasicVector2(const BasicVector2 &Other)
+        : x(Other.x), y(Other.y) {}
+    constexpr BasicVector2(T X, T Y) : x(X), y(Y) {}
+    ~BasicVector2() = default;
+
+    //! @brief Converts the elements of @c Other, e.g. a Vector2d to a Vector2
+    template <typename U>
+    explicit constexpr BasicVector2(const BasicVector2<U> &Other)
+        : x(static_cast<T>(Other.x)), y(static_cast<T>(Other.y)) {}
 
     //! @brief Returns the same vector (convinience)
-    Vector2 xy() const;
+    CALCDA_VECTOR_CONSTEXPR BasicVector2 xy() const;
 
     //! @brief Returns the Y and X elements
-    Vector2 yx() const;
+    CALCDA_VECTOR_CONSTEXPR BasicVector2 yx() const;
 
     //! @brief Returns a pointer to the beginning of the data
-    float *getData();
+    CALCDA_VECTOR_CONSTEXPR T *getData();
 
     //! @brief Returns a const pointer to the beginning of the data
-    const float *getData() const;
+    CALCDA_VECTOR_CONSTEXPR const T *getData() const;
 
     //! @brief Adds two vectors together
-    Vector2 &selfAdd(const Vector2 &Other);
+    CALCDA_VECTOR_CONSTEXPR BasicVector2 &selfAdd(const BasicVector2 &Other);
 
     //! @brief Subtracts two vectors
-    Vector2 &selfSubtract(const Vector2 &Other);
+    CALCDA_VECTOR_CONSTEXPR BasicVector2 &
+    selfSubtract(const BasicVector2 &Other);
 
     //! @brief Multiplies two vectors
-    Vector2 &selfMultiply(const Vector2 &Other);
+    CALCDA_VECTOR_CONSTEXPR BasicVector2 &
+    selfMultiply(const BasicVector2 &Other);
 
     //! @brief Divides the elements of the current vector by @c Amount
-    Vector2 &selfDivide(float Amount);
+    CALCDA_VECTOR_CONSTEXPR BasicVector2 &selfDivide(T Amount);
 
     //! @brief Divides two vectors
-    Vector2 &selfDivide(const Vector2 &Other);
+    CALCDA_VECTOR_CONSTEXPR BasicVector2 &selfDivide(const BasicVector2 &Other);
 
     //! @brief Normalizes the current vector
-    Vector2 &selfNormalize();
+    BasicVector2 &selfNormalize();
 
     //! @brief Puts the vector in +X +Y space
-    Vector2 &selfAbsolute();
+    BasicVector2 &selfAbsolute();
 
     //! @brief Sets the X and Y elements to their square roots
-    Vector2 &selfSqrt();
+    BasicVector2 &selfSqrt();
 
     //! @brief Negates the vector
-    Vector2 &selfNegate();
+    CALCDA_VECTOR_CONSTEXPR BasicVector2 &selfNegate();
 
     //! @brief Returns the two vectors added together
-    /* [[nodiscard]] */ Vector2 add(const Vector2 &Other) const;
+    /* [[nodiscard]] */ CALCDA_VECTOR_CONSTEXPR BasicVector2
+    add(const BasicVector2 &Other) const;
 
     //! @brief Returns the two vectors subtracted
-    /* [[nodiscard]] */ Vector2 subtract(const Vector2 &Other) const;
+    /* [[nodiscard]] */ CALCDA_VECTOR_CONSTEXPR BasicVector2
+    subtract(const BasicVector2 &Other) const;
 
     //! @brief Returns the two vectors multiplied
-    /* [[nodiscard]] */ Vector2 multiply(const Vector2 &Other) const;
+    /* [[nodiscard]] */ CALCDA_VECTOR_CONSTEXPR BasicVector2
+    multiply(const BasicVector2 &Other) const;
 
     //! @brief Returns the elements of the current vector divided by @c Amount
-    /* [[nodiscard]] */ Vector2 divide(float Amount) const;
+    /* [[nodiscard]] */ CALCDA_VECTOR_CONSTEXPR BasicVector2
+    divide(T Amount) const;
 
     //! @brief Returns the two vectors divided
-    /* [[nodiscard]] */ Vector2 divide(const Vector2 &Other) const;
+    /* [[nodiscard]] */ CALCDA_VECTOR_CONSTEXPR BasicVector2
+    divide(const BasicVector2 &Other) const;
 
     //! @brief Returns the current vector normalized
-    /* [[nodiscard]] */ Vector2 normalize() const;
+    /* [[nodiscard]] */ BasicVector2 normalize() const;
 
     //! @brief Returns the vector negated
-    /* [[nodiscard]] */ Vector2 negate() const;
-
-    Vector2 operator+(const Vector2 &Other) const;
-    Vector2 operator-(const Vector2 &Other) const;
-    Vector2 operator*(const Vector2 &Other) const;
-    Vector2 operator/(const Vector2 &Other) const;
-    Vector2 operator/(float Amount) const;
-    Vector2 operator-() const;
-
-    Vector2 &operator=(const Vector2 &Other);
-    Vector2 &operator+=(const Vector2 &Other);
-    Vector2 &operator-=(const Vector2 &Other);
-    Vector2 &operator*=(const Vector2 &Other);
-    Vector2 &operator/=(const Vector2 &Other);
-    Vector2 &operator/=(float Amount);
-
-    bool operator==(const Vector2 &Other) const;
-    bool operator!=(const Vector2 &Other) const;
+    /* [[nodiscard]] */ CALCDA_VECTOR_CONSTEXPR BasicVector2 negate() const;
+
+    CALCDA_VECTOR_CONSTEXPR BasicVector2
+    operator+(const BasicVector2 &Other) const;
+    CALCDA_VECTOR_CONSTEXPR BasicVector2
+    operator-(const BasicVector2 &Other) const;
+    CALCDA_VECTOR_CONSTEXPR BasicVector2
+    operator*(const BasicVector2 &Other) const;
+    CALCDA_VECTOR_CONSTEXPR BasicVector2
+    operator/(const BasicVector2 &Other) const;
+    CALCDA_VECTOR_CONSTEXPR BasicVector2 operator/(T Amount) const;
+    CALCDA_VECTOR_CONSTEXPR BasicVector2 operator-() const;
+
+    CALCDA_VECTOR_CONSTEXPR BasicVector2 &operator=(const BasicVector2 &Other);
+    CALCDA_VECTOR_CONSTEXPR BasicVector2 &operator+=(const BasicVector2 &Other);
+    CALCDA_VECTOR_CONSTEXPR BasicVector2 &operator-=(const BasicVector2 &Other);
+    CALCDA_VECTOR_CONSTEXPR BasicVector2 &operator*=(const BasicVector2 &Other);
+    CALCDA_VECTOR_CONSTEXPR BasicVector2 &operator/=(const BasicVector2 &Other);
+    CALCDA_VECTOR_CONSTEXPR BasicVector2 &operator/=(T Amount);
+
+    CALCDA_VECTOR_CONSTEXPR bool operator==(const BasicVector2 &Other) const;
+    CALCDA_VECTOR_CONSTEXPR bool operator!=(const BasicVector2 &Other) const;
 
     //! @brief Returns the vector in +X +Y space
-    Vector2 absolute() const;
+    BasicVector2 absolute() const;
 
     //! @brief Returns the vector with its X and Y elements set to their square
     //! roots
-    Vector2 sqrt() const;
+    BasicVector2 sqrt() const;
 
     //! @brief Returns the distance between @c this and @c Other
-    float distance(const Vector2 &Other) const;
+    T distance(const BasicVector2 &Other) const;
 
     //! @brief Returns the length of the vector
-    float length() const;
+    T length() const;
 
     //! @brief Returns the squared length of the vector
-    float lengthSquared() const;
+    CALCDA_VECTOR_CONSTEXPR T lengthSquared() const;
 
     /**
      * @brief Reflects @c Value on @c Surface
@@ -140,7 +161,8 @@ class Vector2 {
      * [Reference](https://referencesource.microsoft.com/#System.Numerics/System/Numerics/Vector2.cs
      * "Vector2")
      */
-    static Vector2 reflect(const Vector2 &Value, const Vector2 &Surface);
+    static CALCDA_VECTOR_CONSTEXPR BasicVector2
+    reflect(const BasicVector2 &Value, const BasicVector2 &Surface);
 
     /**
      * @brief Sets @c Value between @c min and @c max in 2-dimensional space
@@ -148,8 +170,9 @@ class Vector2 {
      * [Reference](https://referencesource.microsoft.com/#System.Numerics/System/Numerics/Vector2.cs
      * "Vector2")
      */
-    static Vector2 clamp(const Vector2 &Value, const Vector2 &min,
-                         const Vector2 &max);
+    static CALCDA_VECTOR_CONSTEXPR BasicVector2 clamp(const BasicVector2 &Value,
+                                                      const BasicVector2 &min,
+                                                      const BasicVector2 &max);
 
     /**
      * @brief Linear interpolates between @c Value1 and @c Value2, with @c
@@ -158,8 +181,8 @@ class Vector2 {
      * [Reference](https://referencesource.microsoft.com/#System.Numerics/System/Numerics/Vector2.cs
      * "Vector2")
      */
-    static Vector2 lerp(const Vector2 &Value1, const Vector2 &Value2,
-                        float Amount);
+    static CALCDA_VECTOR_CONSTEXPR BasicVector2
+    lerp(const BasicVector2 &Value1, const BasicVector2 &Value2, T Amount);
 
     /**
      * @brief Returns the dot product of @c Value1 and @c Value2
@@ -167,25 +190,29 @@ class Vector2 {
      * [Reference](https://referencesource.microsoft.com/#System.Numerics/System/Numerics/Vector2_Intrinsics.cs
      * "Vector2 Intrinsics")
      */
-    static float dot(const Vector2 &Value1, const Vector2 &Value2);
+    static CALCDA_VECTOR_CONSTEXPR T
+    dot(const BasicVector2 &Value1, const BasicVector2 &Value2);
 
     //! @brief Returns the smaller vector from @c Value1 to @c Value2
-    static Vector2 vmin(const Vector2 &Value1, const Vector2 &Value2);
+    static CALCDA_VECTOR_CONSTEXPR BasicVector2
+    vmin(const BasicVector2 &Value1, const BasicVector2 &Value2);
 
     //! @brief Returns the smaller vector from @c Value1 to @c Value2
-    static Vector2 vmax(const Vector2 &Value1, const Vector2 &Value2);
+    static CALCDA_VECTOR_CONSTEXPR BasicVector2
+    vmax(const BasicVector2 &Value1, const BasicVector2 &Value2);
 
     //! @brief Returns a scalar vector of @c Value
-    static Vector2 scalar(float Value);
+    static CALCDA_VECTOR_CONSTEXPR BasicVector2 scalar(T Value);
 
     template <std::size_t I>
-    inline std::tuple_element_t<I, Vector2> get() const {
+    inline std::tuple_element_t<I, BasicVector2> get() const {
         CALCDA_IF_CONSTEXPR(I == 0)
         return x;
         else return y;
     }
 
-    template <std::size_t I> inline std::tuple_element_t<I, Vector2> &get() {
+    template <std::size_t I>
+    inline std::tuple_element_t<I, BasicVector2> &get() {
         CALCDA_IF_CONSTEXPR(I == 0)
         return x;
         else return y;
@@ -194,23 +221,36 @@ class Vector2 {
     std::string toString() const;
 };
 
+using Vector2 = BasicVector2<float>;
+using Vector2d = BasicVector2<double>;
 using Point2 = Vector2;
+
+#if !defined(CALCDA_HEADER_ONLY_VECTORS) &&                                   \
+    !defined(CALCDA_INSTANTIATE_VECTORS) && !defined(SWIG)
+// instantiated in src/Vector2.cpp
+extern template class BasicVector2<float>;
+extern template class BasicVector2<double>;
+#endif
 } // namespace Calcda
 
 namespace std {
-template <>
-struct tuple_size<Calcda::Vector2> : integral_constant<size_t, 2> {};
+template <typename T>
+struct tuple_size<Calcda::BasicVector2<T>> : integral_constant<size_t, 2> {};
 
-template <size_t I> struct tuple_element<I, Calcda::Vector2> {
-    using type = float;
+template <size_t I, typename T>
+struct tuple_element<I, Calcda::BasicVector2<T>> {
+    using type = T;
 };
 
-template <> struct hash<Calcda::Vector2> {
-    size_t operator()(const Calcda::Vector2 &v) const noexcept {
-        return Calcda::Internal::hash_combine(hash<float>()(v.x),
-                                              hash<float>()(v.y));
+template <typename T> struct hash<Calcda::BasicVector2<T>> {
+    size_t operator()(const Calcda::BasicVector2<T> &v) const noexcept {
+        return Calcda::Internal::hash_combine(hash<T>()(v.x), hash<T>()(v.y));
     }
 };
 } // namespace std
 
+#ifdef CALCDA_HEADER_ONLY_VECTORS
+#include "Vector2.inl"
+#endif
+
 #endif // !CALCDA_VECTOR2_H
\ No newline at end of file
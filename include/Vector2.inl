@@ -0,0 +1,391 @@
+#ifndef CALCDA_VECTOR2_INL
+#define CALCDA_VECTOR2_INL
+
+/*
+ * Definitions of Vector2, included by src/Vector2.cpp, or by Vector2.hpp when
+ * CALCDA_HEADER_ONLY_VECTORS is defined.
+ */
+
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+
+#include "Vector2.hpp"
+
+namespace Calcda {
+
+template <typename T>
+const BasicVector2<T> BasicVector2<T>::Zero = BasicVector2(T(0), T(0));
+template <typename T>
+const BasicVector2<T> BasicVector2<T>::One = BasicVector2(T(1), T(1));
+template <typename T>
+const BasicVector2<T> BasicVector2<T>::UnitX = BasicVector2(T(1), T(0));
+template <typename T>
+const BasicVector2<T> BasicVector2<T>::UnitY = BasicVector2(T(0), T(1));
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector2<T> BasicVector2<T>::xy() const {
+    return BasicVector2(x, y);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector2<T> BasicVector2<T>::yx() const {
+    return BasicVector2(y, x);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR T *BasicVector2<T>::getData() { return &x; }
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR const T *BasicVector2<T>::getData() const { return &x; }
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector2<T> &
+BasicVector2<T>::selfAdd(const BasicVector2 &Other) {
+    x += Other.x;
+    y += Other.y;
+
+    return *this;
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector2<T> &
+BasicVector2<T>::selfSubtract(const BasicVector2 &Other) {
+    x -= Other.x;
+    y -= Other.y;
+
+    return *this;
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector2<T> &
+BasicVector2<T>::selfMultiply(const BasicVector2 &Other) {
+    x *= Other.x;
+    y *= Other.y;
+
+    return *this;
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector2<T> &BasicVector2<T>::selfDivide(T Amount) {
+    T reciprocal = T(1) / Amount;
+
+    x *= reciprocal;
+    y *= reciprocal;
+
+    return *this;
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector2<T> &
+BasicVector2<T>::selfDivide(const BasicVector2 &Other) {
+    x /= Other.x;
+    y /= Other.y;
+
+    return *this;
+}
+
+template <typename T>
+CALCDA_VECTOR_INLINE BasicVector2<T> &BasicVector2<T>::selfNormalize() {
+    T lengthReciprocal = T(1) / std::abs(std::sqrt(x * x + y * y));
+
+    x *= lengthReciprocal;
+    y *= lengthReciprocal;
+
+    return *this;
+}
+
+template <typename T>
+CALCDA_VECTOR_INLINE BasicVector2<T> &BasicVector2<T>::selfAbsolute() {
+    x = std::abs(x);
+    y = std::abs(y);
+
+    return *this;
+}
+
+template <typename T>
+CALCDA_VECTOR_INLINE BasicVector2<T> &BasicVector2<T>::selfSqrt() {
+    x = std::sqrt(x);
+    y = std::sqrt(y);
+
+    return *this;
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector2<T> &BasicVector2<T>::selfNegate() {
+    x = -x;
+    y = -y;
+
+    return *this;
+}
+
+template <typename T>
+/* [[nodiscard]] */ CALCDA_VECTOR_CONSTEXPR BasicVector2<T>
+BasicVector2<T>::add(const BasicVector2 &Other) const {
+    BasicVector2 result;
+
+    result.x = x + Other.x;
+    result.y = y + Other.y;
+
+    return result;
+}
+
+template <typename T>
+/* [[nodiscard]] */ CALCDA_VECTOR_CONSTEXPR BasicVector2<T>
+BasicVector2<T>::subtract(const BasicVector2 &Other) const {
+    BasicVector2 result;
+
+    result.x = x - Other.x;
+    result.y = y - Other.y;
+
+    return result;
+}
+
+template <typename T>
+/* [[nodiscard]] */ CALCDA_VECTOR_CONSTEXPR BasicVector2<T>
+BasicVector2<T>::multiply(const BasicVector2 &Other) const {
+    BasicVector2 result;
+
+    result.x = x * Other.x;
+    result.y = y * Other.y;
+
+    return result;
+}
+
+template <typename T>
+/* [[nodiscard]] */ CALCDA_VECTOR_CONSTEXPR BasicVector2<T>
+BasicVector2<T>::divide(T Amount) const {
+    BasicVector2 result;
+
+    T Reciprocal = T(1) / Amount;
+
+    result.x = x * Reciprocal;
+    result.y = y * Reciprocal;
+
+    return result;
+}
+
+template <typename T>
+/* [[nodiscard]] */ CALCDA_VECTOR_CONSTEXPR BasicVector2<T>
+BasicVector2<T>::divide(const BasicVector2 &Other) const {
+    BasicVector2 result;
+
+    result.x = x / Other.x;
+    result.y = y / Other.y;
+
+    return result;
+}
+
+template <typename T>
+/* [[nodiscard]] */ CALCDA_VECTOR_INLINE BasicVector2<T>
+BasicVector2<T>::normalize() const {
+    BasicVector2 result;
+
+    T LengthReciprocal = T(1) / std::abs(std::sqrt(x * x + y * y));
+
+    result.x = x * LengthReciprocal;
+    result.y = y * LengthReciprocal;
+
+    return result;
+}
+
+template <typename T>
+/* [[nodiscard]] */ CALCDA_VECTOR_CONSTEXPR BasicVector2<T>
+BasicVector2<T>::negate() const {
+    return BasicVector2(-x, -y);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector2<T>
+BasicVector2<T>::operator+(const BasicVector2 &Other) const {
+    return add(Other);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector2<T>
+BasicVector2<T>::operator-(const BasicVector2 &Other) const {
+    return subtract(Other);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector2<T>
+BasicVector2<T>::operator*(const BasicVector2 &Other) const {
+    return multiply(Other);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector2<T>
+BasicVector2<T>::operator/(const BasicVector2 &Other) const {
+    return divide(Other);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector2<T>
+BasicVector2<T>::operator/(T Amount) const {
+    return divide(Amount);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector2<T> BasicVector2<T>::operator-() const {
+    return negate();
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector2<T> &
+BasicVector2<T>::operator=(const BasicVector2 &Other) {
+    x = Other.x;
+    y = Other.y;
+
+    return *this;
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector2<T> &
+BasicVector2<T>::operator+=(const BasicVector2 &Other) {
+    return selfAdd(Other);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector2<T> &
+BasicVector2<T>::operator-=(const BasicVector2 &Other) {
+    return selfSubtract(Other);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector2<T> &
+BasicVector2<T>::operator*=(const BasicVector2 &Other) {
+    return selfMultiply(Other);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector2<T> &
+BasicVector2<T>::operator/=(const BasicVector2 &Other) {
+    return selfDivide(Other);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector2<T> &BasicVector2<T>::operator/=(T Amount) {
+    return selfDivide(Amount);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR bool
+BasicVector2<T>::operator==(const BasicVector2 &Other) const {
+    return (x == Other.x && y == Other.y);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR bool
+BasicVector2<T>::operator!=(const BasicVector2 &Other) const {
+    return (x != Other.x || y != Other.y);
+}
+
+// https://referencesource.microsoft.com/#System.Numerics/System/Numerics/Vector2_Intrinsics.cs
+template <typename T>
+CALCDA_VECTOR_INLINE BasicVector2<T> BasicVector2<T>::absolute() const {
+    BasicVector2 result;
+
+    result.x = std::abs(x);
+    result.y = std::abs(y);
+
+    return result;
+}
+
+template <typename T>
+CALCDA_VECTOR_INLINE BasicVector2<T> BasicVector2<T>::sqrt() const {
+    BasicVector2 result;
+
+    result.x = std::sqrt(x);
+    result.y = std::sqrt(y);
+
+    return result;
+}
+
+template <typename T>
+CALCDA_VECTOR_INLINE T
+BasicVector2<T>::distance(const BasicVector2 &Other) const {
+    return subtract(Other).length();
+}
+
+template <typename T>
+CALCDA_VECTOR_INLINE T BasicVector2<T>::length() const {
+    return std::sqrt(x * x + y * y);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR T BasicVector2<T>::lengthSquared() const {
+    return x * x + y * y;
+}
+
+// https://referencesource.microsoft.com/#System.Numerics/System/Numerics/Vector2.cs
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector2<T>
+BasicVector2<T>::reflect(const BasicVector2 &value,
+                         const BasicVector2 &surface) {
+    T dotProduct = value.x * surface.x + value.y * surface.y;
+
+    return BasicVector2(value.x - T(2) * dotProduct * surface.x,
+                        value.y - T(2) * dotProduct * surface.y);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector2<T>
+BasicVector2<T>::clamp(const BasicVector2 &value, const BasicVector2 &min,
+                       const BasicVector2 &max) {
+    T X = value.x;
+    X = (X > max.x) ? max.x : X;
+    X = (X < min.x) ? min.x : X;
+
+    T Y = value.y;
+    Y = (Y > max.y) ? max.y : Y;
+    Y = (Y < min.y) ? min.y : Y;
+
+    return BasicVector2(X, Y);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector2<T>
+BasicVector2<T>::lerp(const BasicVector2 &value1, const BasicVector2 &value2,
+                      T Amount) {
+    return BasicVector2(value1.x + (value2.x - value1.x) * Amount,
+                        value1.y + (value2.y - value1.y) * Amount);
+}
+
+// https://referencesource.microsoft.com/#System.Numerics/System/Numerics/Vector2_Intrinsics.cs
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR T
+BasicVector2<T>::dot(const BasicVector2 &value1, const BasicVector2 &value2) {
+    return (value1.x * value2.x + value1.y * value2.y);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector2<T>
+BasicVector2<T>::vmin(const BasicVector2 &value1, const BasicVector2 &value2) {
+    return BasicVector2((value1.x < value2.x) ? value1.x : value2.x,
+                        (value1.y < value2.y) ? value1.y : value2.y);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector2<T>
+BasicVector2<T>::vmax(const BasicVector2 &value1, const BasicVector2 &value2) {
+    return BasicVector2((value1.x > value2.x) ? value1.x : value2.x,
+                        (value1.y > value2.y) ? value1.y : value2.y);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector2<T> BasicVector2<T>::scalar(T value) {
+    return BasicVector2(value, value);
+}
+
+template <typename T>
+CALCDA_VECTOR_INLINE std::string BasicVector2<T>::toString() const {
+    std::stringstream Stream;
+
+    Stream << std::fixed << std::setprecision(2) << "<" << x << ", " << y
+           << ">";
+
+    return Stream.str();
+}
+} // namespace Calcda
+
+#endif // !CALCDA_VECTOR2_INL
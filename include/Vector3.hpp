@@ -11,143 +11,164 @@ namespace Calcda {
 /**
  * @brief Class for 3-dimensional vectors
  *
+ * Vector3 holds floats and Vector3d doubles, for coordinates too large for
+ * float precision; the library instantiates both, other element types need
+ * CALCDA_HEADER_ONLY_VECTORS.
+ *
  * @see [Reference:
  * Intrinsics](https://referencesource.microsoft.com/#System.Numerics/System/Numerics/Vector3_Intrinsics.cs),
  * @see [Reference:
  * Vector3](https://referencesource.microsoft.com/#System.Numerics/System/Numerics/Vector3.cs)
  */
-class Vector3 {
+template <typename T> class BasicVector3 {
   public:
-    float x;
-    float y;
-    float z;
+    T x;
+    T y;
+    T z;
 
-    friend class Vector4;
+    template <typename> friend class BasicVector4;
 
   public:
     // 0; 0; 0 - Zero vector
-    static const Vector3 Zero;
+    static const BasicVector3 Zero;
 
     // 1; 1; 1 - "One" vector
-    static const Vector3 One;
+    static const BasicVector3 One;
 
     // 1; 0; 0 - X axis vector
-    static const Vector3 UnitX;
+    static const BasicVector3 UnitX;
 
     // 0; 1; 0 - Y axis vector
-    static const Vector3 UnitY;
+    static const BasicVector3 UnitY;
 
     // 0; 0; 1 - Z axis vector
-    static const Vector3 UnitZ;
+    static const BasicVector3 UnitZ;
 
   public:
-    constexpr Vector3() : x(0.0f), y(0.0f), z(0.0f) {}
-    constexpr Vector3(float X, float Y, float Z) : x(X), y(Y), z(Z) {}
-    constexpr Vector3(Vector2 XY, float Z) : x(XY.x), y(XY.y), z(Z) {}
-    constexpr Vector3(float X, Vector2 YZ) : x(X), y(YZ.x), z(YZ.y) {}
-    constexpr Vector3(const Vector3 &Other)
+    constexpr BasicVector3() : x(0), y(0), z(0) {}
+    constexpr BasicVector3(T X, T Y, T Z) : x(X), y(Y), z(Z) {}
+    constexpr BasicVector3(BasicVector2<T> XY, T Z) : x(XY.x), y(XY.y), z(Z) {}
+    constexpr BasicVector3(T X, BasicVector2<T> YZ) : x(X), y(YZ.x), z(YZ.y) {}
+    constexpr BasicVector3(const BasicVector3 &Other)
         : x(Other.x), y(Other.y), z(Other.z) {}
-    ~Vector3() = default;
+    ~BasicVector3() = default;
+
+    //! @brief Converts the elements of @c Other, e.g. a Vector3d to a Vector3
+    template <typename U>
+    explicit constexpr BasicVector3(const BasicVector3<U> &Other)
+        : x(static_cast<T>(Other.x)), y(static_cast<T>(Other.y)),
+          z(static_cast<T>(Other.z)) {}
 
     //! @brief Returns the X and Y elements
-    Vector2 xy() const;
+    CALCDA_VECTOR_CONSTEXPR BasicVector2<T> xy() const;
 
     //! @brief Returns the Y and Z elements
-    Vector2 yz() const;
+    CALCDA_VECTOR_CONSTEXPR BasicVector2<T> yz() const;
 
     //! @brief Returns the same vector (convinience)
-    Vector3 xyz() const;
+    CALCDA_VECTOR_CONSTEXPR BasicVector3 xyz() const;
 
     //! @brief Returns the Z, Y, X elements
-    Vector3 zyx() const;
+    CALCDA_VECTOR_CONSTEXPR BasicVector3 zyx() const;
 
     //! @brief Returns a pointer to the beginning of the data
-    float *getData();
+    CALCDA_VECTOR_CONSTEXPR T *getData();
 
     //! @brief Returns a const pointer to the beginning of the data
-    const float *getData() const;
+    CALCDA_VECTOR_CONSTEXPR const T *getData() const;
 
     //! @brief Adds the two vectors together
-    Vector3 &selfAdd(const Vector3 &Other);
+    CALCDA_VECTOR_CONSTEXPR BasicVector3 &selfAdd(const BasicVector3 &Other);
 
     //! @brief Subtracts @c Other from the current vector
-    Vector3 &selfSubtract(const Vector3 &Other);
+    CALCDA_VECTOR_CONSTEXPR BasicVector3 &
+    selfSubtract(const BasicVector3 &Other);
 
     //! @brief Multiplies the current vector with @c Other
-    Vector3 &selfMultiply(const Vector3 &Other);
+    CALCDA_VECTOR_CONSTEXPR BasicVector3 &
+    selfMultiply(const BasicVector3 &Other);
 
     //! @brief Divides the elements of the current vector with @c Amount
-    Vector3 &selfDivide(float Amount);
+    CALCDA_VECTOR_CONSTEXPR BasicVector3 &selfDivide(T Amount);
 
     //! @brief Divides the current vector with @c Other
-    Vector3 &selfDivide(const Vector3 &Other);
+    CALCDA_VECTOR_CONSTEXPR BasicVector3 &selfDivide(const BasicVector3 &Other);
 
     //! @brief Normalizes the current vector
-    Vector3 &selfNormalize();
+    BasicVector3 &selfNormalize();
 
     //! @brief Transforms the vector into +X +Y +Z space
-    Vector3 &selfAbsolute();
+    BasicVector3 &selfAbsolute();
 
     //! @brief Transforms the vector to have the values of its elements' square
     //! roots
-    Vector3 &selfSqrt();
+    BasicVector3 &selfSqrt();
 
     //! @brief Negates the vector
-    Vector3 &selfNegate();
+    CALCDA_VECTOR_CONSTEXPR BasicVector3 &selfNegate();
 
     //! @brief Adds the two vectors together
-    /* [[nodiscard]] */ Vector3 add(const Vector3 &Other) const;
+    /* [[nodiscard]] */ CALCDA_VECTOR_CONSTEXPR BasicVector3
+    add(const BasicVector3 &Other) const;
 
     //! @brief Subtracts @c Other from the current vector
-    /* [[nodiscard]] */ Vector3 subtract(const Vector3 &Other) const;
+    /* [[nodiscard]] */ CALCDA_VECTOR_CONSTEXPR BasicVector3
+    subtract(const BasicVector3 &Other) const;
 
     //! @brief Multiplies the current vector with @c Other
-    /* [[nodiscard]] */ Vector3 multiply(const Vector3 &Other) const;
+    /* [[nodiscard]] */ CALCDA_VECTOR_CONSTEXPR BasicVector3
+    multiply(const BasicVector3 &Other) const;
 
     //! @brief Divides the elements of the current vector with @c Amount
-    /* [[nodiscard]] */ Vector3 divide(float Amount) const;
+    /* [[nodiscard]] */ CALCDA_VECTOR_CONSTEXPR BasicVector3
+    divide(T Amount) const;
 
     //! @brief Divides the current vector with @c Other, returns the result
-    /* [[nodiscard]] */ Vector3 divide(const Vector3 &Other) const;
+    /* [[nodiscard]] */ CALCDA_VECTOR_CONSTEXPR BasicVector3
+    divide(const BasicVector3 &Other) const;
 
     //! @brief Normalizes the current vector
-    /* [[nodiscard]] */ Vector3 normalize() const;
+    /* [[nodiscard]] */ BasicVector3 normalize() const;
 
     //! @brief Negates the vector
-    /* [[nodiscard]] */ Vector3 negate() const;
-
-    Vector3 operator+(const Vector3 &Other) const;
-    Vector3 operator-(const Vector3 &Other) const;
-    Vector3 operator*(const Vector3 &Other) const;
-    Vector3 operator/(const Vector3 &Other) const;
-    Vector3 operator/(float Amount) const;
-    Vector3 operator-() const;
-
-    Vector3 &operator=(const Vector3 &Other);
-    Vector3 &operator+=(const Vector3 &Other);
-    Vector3 &operator-=(const Vector3 &Other);
-    Vector3 &operator*=(const Vector3 &Other);
-    Vector3 &operator/=(const Vector3 &Other);
-    Vector3 &operator/=(float Amount);
-
-    bool operator==(const Vector3 &Other) const;
-    bool operator!=(const Vector3 &Other) const;
+    /* [[nodiscard]] */ CALCDA_VECTOR_CONSTEXPR BasicVector3 negate() const;
+
+    CALCDA_VECTOR_CONSTEXPR BasicVector3
+    operator+(const BasicVector3 &Other) const;
+    CALCDA_VECTOR_CONSTEXPR BasicVector3
+    operator-(const BasicVector3 &Other) const;
+    CALCDA_VECTOR_CONSTEXPR BasicVector3
+    operator*(const BasicVector3 &Other) const;
+    CALCDA_VECTOR_CONSTEXPR BasicVector3
+    operator/(const BasicVector3 &Other) const;
+    CALCDA_VECTOR_CONSTEXPR BasicVector3 operator/(T Amount) const;
+    CALCDA_VECTOR_CONSTEXPR BasicVector3 operator-() const;
+
+    CALCDA_VECTOR_CONSTEXPR BasicVector3 &operator=(const BasicVector3 &Other);
+    CALCDA_VECTOR_CONSTEXPR BasicVector3 &operator+=(const BasicVector3 &Other);
+    CALCDA_VECTOR_CONSTEXPR BasicVector3 &operator-=(const BasicVector3 &Other);
+    CALCDA_VECTOR_CONSTEXPR BasicVector3 &operator*=(const BasicVector3 &Other);
+    CALCDA_VECTOR_CONSTEXPR BasicVector3 &operator/=(const BasicVector3 &Other);
+    CALCDA_VECTOR_CONSTEXPR BasicVector3 &operator/=(T Amount);
+
+    CALCDA_VECTOR_CONSTEXPR bool operator==(const BasicVector3 &Other) const;
+    CALCDA_VECTOR_CONSTEXPR bool operator!=(const BasicVector3 &Other) const;
 
     //! @brief Transforms the vector into +X +Y +Z space
-    Vector3 absolute() const;
+    BasicVector3 absolute() const;
 
     //! @brief Returns a vector with the square roots of the current vector's
     //! elements
-    Vector3 sqrt() const;
+    BasicVector3 sqrt() const;
 
     //! @brief distance between the current vector and @c Other
-    float distance(const Vector3 &Other) const;
+    T distance(const BasicVector3 &Other) const;
 
     //! @brief Returns the length of the vector
-    float length() const;
+    T length() const;
 
     //! @brief Returns the squared length of the vector
-    float lengthSquared() const;
+    CALCDA_VECTOR_CONSTEXPR T lengthSquared() const;
 
     // https://referencesource.microsoft.com/#System.Numerics/System/Numerics/Vector3.cs
 
@@ -157,7 +178,8 @@ class Vector3 {
      * [Reference](https://referencesource.microsoft.com/#System.Numerics/System/Numerics/Vector3.cs
      * "Vector3")
      */
-    static Vector3 reflect(const Vector3 &Value, const Vector3 &Surface);
+    static CALCDA_VECTOR_CONSTEXPR BasicVector3
+    reflect(const BasicVector3 &Value, const BasicVector3 &Surface);
 
     /**
      * @brief Clamps @c Value between @c min and @c max
@@ -165,8 +187,9 @@ class Vector3 {
      * [Reference](https://referencesource.microsoft.com/#System.Numerics/System/Numerics/Vector3.cs
      * "Vector3")
      */
-    static Vector3 clamp(const Vector3 &Value, const Vector3 &min,
-                         const Vector3 &max);
+    static CALCDA_VECTOR_CONSTEXPR BasicVector3 clamp(const BasicVector3 &Value,
+                                                      const BasicVector3 &min,
+                                                      const BasicVector3 &max);
 
     /**
      * @brief Linear interpolates between @c Value1 and @c Value2 by @c Amount %
@@ -175,8 +198,8 @@ class Vector3 {
      * [Reference](https://referencesource.microsoft.com/#System.Numerics/System/Numerics/Vector3.cs
      * "Vector3")
      */
-    static Vector3 lerp(const Vector3 &Value1, const Vector3 &Value2,
-                        float Amount);
+    static CALCDA_VECTOR_CONSTEXPR BasicVector3
+    lerp(const BasicVector3 &Value1, const BasicVector3 &Value2, T Amount);
 
     /**
      * @brief Returns the cross product of @c Value1 and @c Value2
@@ -184,7 +207,8 @@ class Vector3 {
      * [Reference](https://referencesource.microsoft.com/#System.Numerics/System/Numerics/Vector3.cs
      * "Vector3")
      */
-    static Vector3 cross(const Vector3 &Value1, const Vector3 &Value2);
+    static CALCDA_VECTOR_CONSTEXPR BasicVector3
+    cross(const BasicVector3 &Value1, const BasicVector3 &Value2);
 
     // https://referencesource.microsoft.com/#System.Numerics/System/Numerics/Vector3_Intrinsics.cs
 
@@ -194,26 +218,30 @@ class Vector3 {
      * [Reference](https://referencesource.microsoft.com/#System.Numerics/System/Numerics/Vector3_Intrinsics.cs
      * "Vector3 Intrinsics")
      */
-    static float dot(const Vector3 &Value1, const Vector3 &Value2);
+    static CALCDA_VECTOR_CONSTEXPR T
+    dot(const BasicVector3 &Value1, const BasicVector3 &Value2);
 
     //! @brief Returns the smaller vector
-    static Vector3 vmin(const Vector3 &Value1, const Vector3 &Value2);
+    static CALCDA_VECTOR_CONSTEXPR BasicVector3
+    vmin(const BasicVector3 &Value1, const BasicVector3 &Value2);
 
     //! @brief Returns the larger vector
-    static Vector3 vmax(const Vector3 &Value1, const Vector3 &Value2);
+    static CALCDA_VECTOR_CONSTEXPR BasicVector3
+    vmax(const BasicVector3 &Value1, const BasicVector3 &Value2);
 
     //! @brief Returns a scalar vector of @c Value
-    static Vector3 scalar(float Value);
+    static CALCDA_VECTOR_CONSTEXPR BasicVector3 scalar(T Value);
 
     template <std::size_t I>
-    inline std::tuple_element_t<I, Vector3> get() const {
+    inline std::tuple_element_t<I, BasicVector3> get() const {
         CALCDA_IF_CONSTEXPR(I == 0)
         return x;
         else CALCDA_IF_CONSTEXPR(I == 1) return y;
         else return z;
     }
 
-    template <std::size_t I> inline std::tuple_element_t<I, Vector3> &get() {
+    template <std::size_t I>
+    inline std::tuple_element_t<I, BasicVector3> &get() {
         CALCDA_IF_CONSTEXPR(I == 0)
         return x;
         else CALCDA_IF_CONSTEXPR(I == 1) return y;
@@ -223,23 +251,37 @@ class Vector3 {
     std::string toString() const;
 };
 
+using Vector3 = BasicVector3<float>;
+using Vector3d = BasicVector3<double>;
 using Point3 = Vector3;
+
+#if !defined(CALCDA_HEADER_ONLY_VECTORS) &&                                   \
+    !defined(CALCDA_INSTANTIATE_VECTORS) && !defined(SWIG)
+// instantiated in src/Vector3.cpp
+extern template class BasicVector3<float>;
+extern template class BasicVector3<double>;
+#endif
 } // namespace Calcda
 
 namespace std {
-template <>
-struct tuple_size<Calcda::Vector3> : integral_constant<size_t, 3> {};
+template <typename T>
+struct tuple_size<Calcda::BasicVector3<T>> : integral_constant<size_t, 3> {};
 
-template <size_t I> struct tuple_element<I, Calcda::Vector3> {
-    using type = float;
+template <size_t I, typename T>
+struct tuple_element<I, Calcda::BasicVector3<T>> {
+    using type = T;
 };
 
-template <> struct hash<Calcda::Vector3> {
-    size_t operator()(const Calcda::Vector3 &v) const noexcept {
+template <typename T> struct hash<Calcda::BasicVector3<T>> {
+    size_t operator()(const Calcda::BasicVector3<T> &v) const noexcept {
         return Calcda::Internal::hash_combine(
-            hash<float>()(v.x), hash<float>()(v.y), hash<float>()(v.z));
+            hash<T>()(v.x), hash<T>()(v.y), hash<T>()(v.z));
     }
 };
 } // namespace std
 
+#ifdef CALCDA_HEADER_ONLY_VECTORS
+#include "Vector3.inl"
+#endif
+
 #endif // !CALCDA_VECTOR3_H
\ No newline at end of file
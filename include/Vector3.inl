@@ -0,0 +1,438 @@
+#ifndef CALCDA_VECTOR3_INL
+#define CALCDA_VECTOR3_INL
+
+/*
+ * Definitions of Vector3, included by src/Vector3.cpp, or by Vector3.hpp when
+ * CALCDA_HEADER_ONLY_VECTORS is defined.
+ */
+
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+
+#include "Vector3.hpp"
+
+namespace Calcda {
+
+template <typename T>
+const BasicVector3<T> BasicVector3<T>::Zero = BasicVector3(T(0), T(0), T(0));
+template <typename T>
+const BasicVector3<T> BasicVector3<T>::One = BasicVector3(T(1), T(1), T(1));
+template <typename T>
+const BasicVector3<T> BasicVector3<T>::UnitX = BasicVector3(T(1), T(0), T(0));
+template <typename T>
+const BasicVector3<T> BasicVector3<T>::UnitY = BasicVector3(T(0), T(1), T(0));
+template <typename T>
+const BasicVector3<T> BasicVector3<T>::UnitZ = BasicVector3(T(0), T(0), T(1));
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector2<T> BasicVector3<T>::xy() const {
+    return BasicVector2<T>(x, y);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector2<T> BasicVector3<T>::yz() const {
+    return BasicVector2<T>(y, z);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector3<T> BasicVector3<T>::xyz() const {
+    return *this;
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector3<T> BasicVector3<T>::zyx() const {
+    return BasicVector3(z, y, x);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR T *BasicVector3<T>::getData() { return &x; }
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR const T *BasicVector3<T>::getData() const { return &x; }
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector3<T> &
+BasicVector3<T>::selfAdd(const BasicVector3 &Other) {
+    x += Other.x;
+    y += Other.y;
+    z += Other.z;
+
+    return *this;
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector3<T> &
+BasicVector3<T>::selfSubtract(const BasicVector3 &Other) {
+    x -= Other.x;
+    y -= Other.y;
+    z -= Other.z;
+
+    return *this;
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector3<T> &
+BasicVector3<T>::selfMultiply(const BasicVector3 &Other) {
+    x *= Other.x;
+    y *= Other.y;
+    z *= Other.z;
+
+    return *this;
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector3<T> &BasicVector3<T>::selfDivide(T Amount) {
+    T reciprocal = T(1) / Amount;
+
+    x *= reciprocal;
+    y *= reciprocal;
+    z *= reciprocal;
+
+    return *this;
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector3<T> &
+BasicVector3<T>::selfDivide(const BasicVector3 &Other) {
+    x /= Other.x;
+    y /= Other.y;
+    z /= Other.z;
+
+    return *this;
+}
+
+template <typename T>
+CALCDA_VECTOR_INLINE BasicVector3<T> &BasicVector3<T>::selfNormalize() {
+    T length = std::abs(std::sqrt(x * x + y * y));
+
+    x /= length;
+    y /= length;
+    z /= length;
+
+    return *this;
+}
+
+template <typename T>
+CALCDA_VECTOR_INLINE BasicVector3<T> &BasicVector3<T>::selfAbsolute() {
+    x = std::abs(x);
+    y = std::abs(y);
+    y = std::abs(z);
+
+    return *this;
+}
+
+template <typename T>
+CALCDA_VECTOR_INLINE BasicVector3<T> &BasicVector3<T>::selfSqrt() {
+    x = std::sqrt(x);
+    y = std::sqrt(y);
+    z = std::sqrt(z);
+
+    return *this;
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector3<T> &BasicVector3<T>::selfNegate() {
+    x = -x;
+    y = -y;
+    z = -z;
+
+    return *this;
+}
+
+template <typename T>
+/* [[nodiscard]] */ CALCDA_VECTOR_CONSTEXPR BasicVector3<T>
+BasicVector3<T>::add(const BasicVector3 &Other) const {
+    BasicVector3 result;
+
+    result.x = x + Other.x;
+    result.y = y + Other.y;
+    result.z = z + Other.z;
+
+    return result;
+}
+
+template <typename T>
+/* [[nodiscard]] */ CALCDA_VECTOR_CONSTEXPR BasicVector3<T>
+BasicVector3<T>::subtract(const BasicVector3 &Other) const {
+    BasicVector3 result;
+
+    result.x = x - Other.x;
+    result.y = y - Other.y;
+    result.z = z - Other.z;
+
+    return result;
+}
+
+template <typename T>
+/* [[nodiscard]] */ CALCDA_VECTOR_CONSTEXPR BasicVector3<T>
+BasicVector3<T>::multiply(const BasicVector3 &Other) const {
+    BasicVector3 result;
+
+    result.x = x * Other.x;
+    result.y = y * Other.y;
+    result.z = z * Other.z;
+
+    return result;
+}
+
+template <typename T>
+/* [[nodiscard]] */ CALCDA_VECTOR_CONSTEXPR BasicVector3<T>
+BasicVector3<T>::divide(T Amount) const {
+    BasicVector3 result;
+
+    T reciprocal = T(1) / Amount;
+
+    result.x = x * reciprocal;
+    result.y = y * reciprocal;
+    result.z = z * reciprocal;
+
+    return result;
+}
+
+template <typename T>
+/* [[nodiscard]] */ CALCDA_VECTOR_CONSTEXPR BasicVector3<T>
+BasicVector3<T>::divide(const BasicVector3 &Other) const {
+    BasicVector3 result;
+
+    result.x = x / Other.x;
+    result.y = y / Other.y;
+    result.z = z / Other.z;
+
+    return result;
+}
+
+template <typename T>
+/* [[nodiscard]] */ CALCDA_VECTOR_INLINE BasicVector3<T>
+BasicVector3<T>::normalize() const {
+    BasicVector3 result;
+
+    T LengthReciprocal = T(1) / std::sqrt(x * x + y * y + z * z);
+
+    result.x = x * LengthReciprocal;
+    result.y = y * LengthReciprocal;
+    result.z = z * LengthReciprocal;
+
+    return result;
+}
+
+template <typename T>
+/* [[nodiscard]] */ CALCDA_VECTOR_CONSTEXPR BasicVector3<T>
+BasicVector3<T>::negate() const {
+    return BasicVector3(-x, -y, -z);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector3<T>
+BasicVector3<T>::operator+(const BasicVector3 &Other) const {
+    return add(Other);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector3<T>
+BasicVector3<T>::operator-(const BasicVector3 &Other) const {
+    return subtract(Other);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector3<T>
+BasicVector3<T>::operator*(const BasicVector3 &Other) const {
+    return multiply(Other);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector3<T>
+BasicVector3<T>::operator/(const BasicVector3 &Other) const {
+    return divide(Other);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector3<T>
+BasicVector3<T>::operator/(T Amount) const {
+    return divide(Amount);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector3<T> BasicVector3<T>::operator-() const {
+    return negate();
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector3<T> &
+BasicVector3<T>::operator=(const BasicVector3 &Other) {
+    x = Other.x;
+    y = Other.y;
+    z = Other.z;
+
+    return *this;
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector3<T> &
+BasicVector3<T>::operator+=(const BasicVector3 &Other) {
+    return selfAdd(Other);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector3<T> &
+BasicVector3<T>::operator-=(const BasicVector3 &Other) {
+    return selfSubtract(Other);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector3<T> &
+BasicVector3<T>::operator*=(const BasicVector3 &Other) {
+    return selfMultiply(Other);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector3<T> &
+BasicVector3<T>::operator/=(const BasicVector3 &Other) {
+    return selfDivide(Other);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector3<T> &BasicVector3<T>::operator/=(T Amount) {
+    return selfDivide(Amount);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR bool
+BasicVector3<T>::operator==(const BasicVector3 &Other) const {
+    return (x == Other.x && y == Other.y && z == Other.z);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR bool
+BasicVector3<T>::operator!=(const BasicVector3 &Other) const {
+    return (x != Other.x || y != Other.y || z != Other.z);
+}
+
+// https://referencesource.microsoft.com/#System.Numerics/System/Numerics/Vector2_Intrinsics.cs
+template <typename T>
+CALCDA_VECTOR_INLINE BasicVector3<T> BasicVector3<T>::absolute() const {
+    BasicVector3 result;
+
+    result.x = std::abs(x);
+    result.y = std::abs(y);
+    result.z = std::abs(z);
+
+    return result;
+}
+
+template <typename T>
+CALCDA_VECTOR_INLINE BasicVector3<T> BasicVector3<T>::sqrt() const {
+    BasicVector3 result;
+
+    result.x = std::sqrt(x);
+    result.y = std::sqrt(y);
+    result.z = std::sqrt(z);
+
+    return result;
+}
+
+template <typename T>
+CALCDA_VECTOR_INLINE T
+BasicVector3<T>::distance(const BasicVector3 &Other) const {
+    return subtract(Other).length();
+}
+
+template <typename T>
+CALCDA_VECTOR_INLINE T BasicVector3<T>::length() const {
+    return std::sqrt(x * x + y * y + z * z);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR T BasicVector3<T>::lengthSquared() const {
+    return x * x + y * y + z * z;
+}
+
+// https://referencesource.microsoft.com/#System.Numerics/System/Numerics/Vector3.cs
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector3<T>
+BasicVector3<T>::reflect(const BasicVector3 &Value,
+                         const BasicVector3 &Surface) {
+    T dotProduct =
+        Value.x * Surface.x + Value.y * Surface.y + Value.z * Surface.z;
+
+    return BasicVector3(Value.x - T(2) * dotProduct * Surface.x,
+                        Value.y - T(2) * dotProduct * Surface.y,
+                        Value.z - T(2) * dotProduct * Surface.z);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector3<T>
+BasicVector3<T>::clamp(const BasicVector3 &Value, const BasicVector3 &min,
+                       const BasicVector3 &max) {
+    T X = Value.x;
+    X = (X > max.x) ? max.x : X;
+    X = (X < min.x) ? min.x : X;
+
+    T Y = Value.y;
+    Y = (Y > max.y) ? max.y : Y;
+    Y = (Y < min.y) ? min.y : Y;
+
+    T Z = Value.z;
+    Z = (Z > max.z) ? max.z : Z;
+    Z = (Z < min.z) ? min.z : Z;
+
+    return BasicVector3(X, Y, Z);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector3<T>
+BasicVector3<T>::lerp(const BasicVector3 &Value1, const BasicVector3 &Value2,
+                      T Amount) {
+    return BasicVector3(Value1.x + (Value2.x - Value1.x) * Amount,
+                        Value1.y + (Value2.y - Value1.y) * Amount,
+                        Value1.z + (Value2.z - Value1.z) * Amount);
+}
+
+// https://referencesource.microsoft.com/#System.Numerics/System/Numerics/Vector2_Intrinsics.cs
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR T
+BasicVector3<T>::dot(const BasicVector3 &Value1, const BasicVector3 &Value2) {
+    return (Value1.x * Value2.x + Value1.y * Value2.y + Value1.z * Value2.z);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector3<T>
+BasicVector3<T>::cross(const BasicVector3 &Value1, const BasicVector3 &Value2) {
+    return BasicVector3(Value1.y * Value2.z - Value1.z * Value2.y,
+                        Value1.z * Value2.x - Value1.x * Value2.z,
+                        Value1.x * Value2.y - Value1.y * Value2.x);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector3<T>
+BasicVector3<T>::vmin(const BasicVector3 &Value1, const BasicVector3 &Value2) {
+    return BasicVector3((Value1.x < Value2.x) ? Value1.x : Value2.x,
+                        (Value1.y < Value2.y) ? Value1.y : Value2.y,
+                        (Value1.z < Value2.z) ? Value1.z : Value2.z);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector3<T>
+BasicVector3<T>::vmax(const BasicVector3 &Value1, const BasicVector3 &Value2) {
+    return BasicVector3((Value1.x < Value2.x) ? Value1.x : Value2.x,
+                        (Value1.y < Value2.y) ? Value1.y : Value2.y,
+                        (Value1.z < Value2.z) ? Value1.z : Value2.z);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector3<T> BasicVector3<T>::scalar(T Value) {
+    return BasicVector3(Value, Value, Value);
+}
+
+template <typename T>
+CALCDA_VECTOR_INLINE std::string BasicVector3<T>::toString() const {
+    std::stringstream stream;
+
+    stream << std::fixed << std::setprecision(2) << "<" << x << ", " << y
+           << ", " << z << ">";
+
+    return stream.str();
+}
+} // namespace Calcda
+
+#endif // !CALCDA_VECTOR3_INL
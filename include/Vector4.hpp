@@ -12,158 +12,178 @@ namespace Calcda {
 
 /**
  * @brief Class for 4-dimensional vectors
+ *
+ * Vector4 holds floats and Vector4d doubles, see BasicVector3.
+ *
  * @see [Reference:
  * Intrinsics](https://referencesource.microsoft.com/#System.Numerics/System/Numerics/Vector4_Intrinsics.cs)
  * @see [Reference:
  * Vector4](https://referencesource.microsoft.com/#System.Numerics/System/Numerics/Vector4.cs)
  */
-class Vector4 {
+template <typename T> class BasicVector4 {
   public:
-    float x;
-    float y;
-    float z;
-    float w;
+    T x;
+    T y;
+    T z;
+    T w;
 
   public:
     // 0; 0; 0; 0 - Zero vector
-    static const Vector4 Zero;
+    static const BasicVector4 Zero;
 
     // 1; 1; 1; 1 - "One" vector
-    static const Vector4 One;
+    static const BasicVector4 One;
 
     // 1; 0; 0; 0 - X axis vector
-    static const Vector4 UnitX;
+    static const BasicVector4 UnitX;
 
     // 0; 1; 0; 0 - Y axis vector
-    static const Vector4 UnitY;
+    static const BasicVector4 UnitY;
 
     // 0; 0; 1; 0 - Z axis vector
-    static const Vector4 UnitZ;
+    static const BasicVector4 UnitZ;
 
     // 0; 0; 0; 1 - W axis vector
-    static const Vector4 UnitW;
+    static const BasicVector4 UnitW;
 
   public:
-    constexpr Vector4() : x(0.0f), y(0.0f), z(0.0f), w(0.0f) {}
-    constexpr Vector4(float X, float Y, float Z, float W)
+    constexpr BasicVector4() : x(0), y(0), z(0), w(0) {}
+    constexpr BasicVector4(T X, T Y, T Z, T W)
         : x(X), y(Y), z(Z), w(W) {}
-    constexpr Vector4(Vector2 XY, Vector2 ZW)
+    constexpr BasicVector4(BasicVector2<T> XY, BasicVector2<T> ZW)
         : x(XY.x), y(XY.y), z(ZW.x), w(ZW.y) {}
-    constexpr Vector4(Vector3 XYZ, float W)
+    constexpr BasicVector4(BasicVector3<T> XYZ, T W)
         : x(XYZ.x), y(XYZ.y), z(XYZ.z), w(W) {}
-    constexpr Vector4(float X, Vector3 YZW)
+    constexpr BasicVector4(T X, BasicVector3<T> YZW)
         : x(X), y(YZW.x), z(YZW.y), w(YZW.z) {}
-    constexpr Vector4(const Vector4 &Other)
+    constexpr BasicVector4(const BasicVector4 &Other)
         : x(Other.x), y(Other.y), z(Other.z), w(Other.w) {}
-    ~Vector4() = default;
+    ~BasicVector4() = default;
+
+    //! @brief Converts the elements of @c Other, e.g. a Vector4d to a Vector4
+    template <typename U>
+    explicit constexpr BasicVector4(const BasicVector4<U> &Other)
+        : x(static_cast<T>(Other.x)), y(static_cast<T>(Other.y)),
+          z(static_cast<T>(Other.z)), w(static_cast<T>(Other.w)) {}
 
     //! @brief Returns the X and Y elements
-    Vector2 xy() const;
+    CALCDA_VECTOR_CONSTEXPR BasicVector2<T> xy() const;
 
     //! @brief Returns the Y and Z elements
-    Vector2 yz() const;
+    CALCDA_VECTOR_CONSTEXPR BasicVector2<T> yz() const;
 
     //! @brief Returns the Z and W elements
-    Vector2 zw() const;
+    CALCDA_VECTOR_CONSTEXPR BasicVector2<T> zw() const;
 
     //! @brief Returns the X, Y and Z elements
-    Vector3 xyz() const;
+    CALCDA_VECTOR_CONSTEXPR BasicVector3<T> xyz() const;
 
     //! @brief Returns the Y, Z and W elements
-    Vector3 yzw() const;
+    CALCDA_VECTOR_CONSTEXPR BasicVector3<T> yzw() const;
 
     //! @brief Returns the same vector
-    Vector4 xyzw() const;
+    CALCDA_VECTOR_CONSTEXPR BasicVector4 xyzw() const;
 
     //! @brief Returns the W, Z, Y, and X elements
-    Vector4 wzyx() const;
+    CALCDA_VECTOR_CONSTEXPR BasicVector4 wzyx() const;
 
     //! @brief Returns a pointer to the beginning of the data
-    float *getData();
+    CALCDA_VECTOR_CONSTEXPR T *getData();
 
     //! @brief Returns a const pointer to the beginning of the data
-    const float *getData() const;
+    CALCDA_VECTOR_CONSTEXPR const T *getData() const;
 
     //! @brief Adds the two vectors together
-    Vector4 &selfAdd(const Vector4 &Other);
+    CALCDA_VECTOR_CONSTEXPR BasicVector4 &selfAdd(const BasicVector4 &Other);
 
     //! @brief Subtracts @c Other from the current vector
-    Vector4 &selfSubtract(const Vector4 &Other);
+    CALCDA_VECTOR_CONSTEXPR BasicVector4 &
+    selfSubtract(const BasicVector4 &Other);
 
     //! @brief Multiplies the current vector with @c Other
-    Vector4 &selfMultiply(const Vector4 &Other);
+    CALCDA_VECTOR_CONSTEXPR BasicVector4 &
+    selfMultiply(const BasicVector4 &Other);
 
     //! @brief Divides the elements of the current vector with @c Amount
-    Vector4 &selfDivide(float Amount);
+    CALCDA_VECTOR_CONSTEXPR BasicVector4 &selfDivide(T Amount);
 
     //! @brief Divides the current vector with @c Other
-    Vector4 &selfDivide(const Vector4 &Other);
+    CALCDA_VECTOR_CONSTEXPR BasicVector4 &selfDivide(const BasicVector4 &Other);
 
     //! @brief Normalizes the current vector
-    Vector4 &selfNormalize();
+    BasicVector4 &selfNormalize();
 
     //! @brief Transforms the vector to +X, +Y, +Z, +W space
-    Vector4 &selfAbsolute();
+    BasicVector4 &selfAbsolute();
 
     //! @brief Sets the elements to their squares
-    Vector4 &selfSqrt();
+    BasicVector4 &selfSqrt();
 
     //! @brief Negates the vector
-    Vector4 &selfNegate();
+    CALCDA_VECTOR_CONSTEXPR BasicVector4 &selfNegate();
 
     //! @brief Adds the two vectors together
-    /* [[nodiscard]] */ Vector4 add(const Vector4 &Other) const;
+    /* [[nodiscard]] */ CALCDA_VECTOR_CONSTEXPR BasicVector4
+    add(const BasicVector4 &Other) const;
 
     //! @brief Subtracts @c Other from the current vector
-    /* [[nodiscard]] */ Vector4 subtract(const Vector4 &Other) const;
+    /* [[nodiscard]] */ CALCDA_VECTOR_CONSTEXPR BasicVector4
+    subtract(const BasicVector4 &Other) const;
 
     //! @brief Multiplies the current vector with @c Other
-    /* [[nodiscard]] */ Vector4 multiply(const Vector4 &Other) const;
+    /* [[nodiscard]] */ CALCDA_VECTOR_CONSTEXPR BasicVector4
+    multiply(const BasicVector4 &Other) const;
 
     //! @brief Divides the elements of the current vector with @c Amount
-    /* [[nodiscard]] */ Vector4 divide(float Amount) const;
+    /* [[nodiscard]] */ CALCDA_VECTOR_CONSTEXPR BasicVector4
+    divide(T Amount) const;
 
     //! @brief Divides the current vector with @c Other, returns the result
-    /* [[nodiscard]] */ Vector4 divide(const Vector4 &Other) const;
+    /* [[nodiscard]] */ CALCDA_VECTOR_CONSTEXPR BasicVector4
+    divide(const BasicVector4 &Other) const;
 
     //! @brief Normalizes the current vector
-    /* [[nodiscard]] */ Vector4 normalize() const;
+    /* [[nodiscard]] */ BasicVector4 normalize() const;
 
     //! @brief Negates the vector
-    /* [[nodiscard]] */ Vector4 negate() const;
-
-    Vector4 operator+(const Vector4 &Other) const;
-    Vector4 operator-(const Vector4 &Other) const;
-    Vector4 operator*(const Vector4 &Other) const;
-    Vector4 operator/(const Vector4 &Other) const;
-    Vector4 operator/(float Amount) const;
-    Vector4 operator-() const;
-
-    Vector4 &operator=(const Vector4 &Other);
-    Vector4 &operator+=(const Vector4 &Other);
-    Vector4 &operator-=(const Vector4 &Other);
-    Vector4 &operator*=(const Vector4 &Other);
-    Vector4 &operator/=(const Vector4 &Other);
-    Vector4 &operator/=(float Amount);
-
-    bool operator==(const Vector4 &Other) const;
-    bool operator!=(const Vector4 &Other) const;
+    /* [[nodiscard]] */ CALCDA_VECTOR_CONSTEXPR BasicVector4 negate() const;
+
+    CALCDA_VECTOR_CONSTEXPR BasicVector4
+    operator+(const BasicVector4 &Other) const;
+    CALCDA_VECTOR_CONSTEXPR BasicVector4
+    operator-(const BasicVector4 &Other) const;
+    CALCDA_VECTOR_CONSTEXPR BasicVector4
+    operator*(const BasicVector4 &Other) const;
+    CALCDA_VECTOR_CONSTEXPR BasicVector4
+    operator/(const BasicVector4 &Other) const;
+    CALCDA_VECTOR_CONSTEXPR BasicVector4 operator/(T Amount) const;
+    CALCDA_VECTOR_CONSTEXPR BasicVector4 operator-() const;
+
+    CALCDA_VECTOR_CONSTEXPR BasicVector4 &operator=(const BasicVector4 &Other);
+    CALCDA_VECTOR_CONSTEXPR BasicVector4 &operator+=(const BasicVector4 &Other);
+    CALCDA_VECTOR_CONSTEXPR BasicVector4 &operator-=(const BasicVector4 &Other);
+    CALCDA_VECTOR_CONSTEXPR BasicVector4 &operator*=(const BasicVector4 &Other);
+    CALCDA_VECTOR_CONSTEXPR BasicVector4 &operator/=(const BasicVector4 &Other);
+    CALCDA_VECTOR_CONSTEXPR BasicVector4 &operator/=(T Amount);
+
+    CALCDA_VECTOR_CONSTEXPR bool operator==(const BasicVector4 &Other) const;
+    CALCDA_VECTOR_CONSTEXPR bool operator!=(const BasicVector4 &Other) const;
 
     //! @brief Transforms the vector to +X, +Y, +Z, +W space, returns it
-    Vector4 absolute() const;
+    BasicVector4 absolute() const;
 
     //! @brief Returns a vector with the square roots of the current vector's
     //! elements
-    Vector4 sqrt() const;
+    BasicVector4 sqrt() const;
 
     //! @brief distance between the current vector and @c Other
-    float distance(const Vector4 &Other) const;
+    T distance(const BasicVector4 &Other) const;
 
     //! @brief Returns the length of the vector
-    float length() const;
+    T length() const;
 
     //! @brief Returns the squared length of the vector
-    float lengthSquared() const;
+    CALCDA_VECTOR_CONSTEXPR T lengthSquared() const;
 
     /**
      * @brief Reflects @c Value on @c Surface
@@ -172,7 +192,8 @@ class Vector4 {
      * "Vector4")
      * @see [Stack Exchange](https://math.stackexchange.com/a/13266)
      */
-    static Vector4 reflect(const Vector4 &Value, const Vector4 &Surface);
+    static CALCDA_VECTOR_CONSTEXPR BasicVector4
+    reflect(const BasicVector4 &Value, const BasicVector4 &Surface);
 
     /**
      * @brief Clamps @c Value between @c min and @c max
@@ -180,8 +201,9 @@ class Vector4 {
      * [Reference](https://referencesource.microsoft.com/#System.Numerics/System/Numerics/Vector4.cs
      * "Vector4")
      */
-    static Vector4 clamp(const Vector4 &Value, const Vector4 &min,
-                         const Vector4 &max);
+    static CALCDA_VECTOR_CONSTEXPR BasicVector4 clamp(const BasicVector4 &Value,
+                                                      const BasicVector4 &min,
+                                                      const BasicVector4 &max);
 
     /**
      * @brief Linear interpolates between @c Value1 and @c Value2 by @c Amount %
@@ -190,8 +212,8 @@ class Vector4 {
      * [Reference](https://referencesource.microsoft.com/#System.Numerics/System/Numerics/Vector4.cs
      * "Vector4")
      */
-    static Vector4 lerp(const Vector4 &Value1, const Vector4 &Value2,
-                        float Amount);
+    static CALCDA_VECTOR_CONSTEXPR BasicVector4
+    lerp(const BasicVector4 &Value1, const BasicVector4 &Value2, T Amount);
 
     /**
      * @brief Returns the dot product of @c Value1 and @c Value2
@@ -199,19 +221,22 @@ class Vector4 {
      * [Reference](https://referencesource.microsoft.com/#System.Numerics/System/Numerics/Vector4_Intrinsics.cs
      * "Vector4 Intrinsics")
      */
-    static float dot(const Vector4 &Value1, const Vector4 &Value2);
+    static CALCDA_VECTOR_CONSTEXPR T
+    dot(const BasicVector4 &Value1, const BasicVector4 &Value2);
 
     //! @brief Returns the smaller vector
-    static Vector4 vmin(const Vector4 &Value1, const Vector4 &Value2);
+    static CALCDA_VECTOR_CONSTEXPR BasicVector4
+    vmin(const BasicVector4 &Value1, const BasicVector4 &Value2);
 
     //! @brief Returns the larger vector
-    static Vector4 vmax(const Vector4 &Value1, const Vector4 &Value2);
+    static CALCDA_VECTOR_CONSTEXPR BasicVector4
+    vmax(const BasicVector4 &Value1, const BasicVector4 &Value2);
 
     //! @brief Returns a scalar of @c Value
-    static Vector4 scalar(float Value);
+    static CALCDA_VECTOR_CONSTEXPR BasicVector4 scalar(T Value);
 
     template <std::size_t I>
-    inline std::tuple_element_t<I, Vector4> get() const {
+    inline std::tuple_element_t<I, BasicVector4> get() const {
         CALCDA_IF_CONSTEXPR(I == 0)
         return x;
         else CALCDA_IF_CONSTEXPR(I == 1) return y;
@@ -219,7 +244,8 @@ class Vector4 {
         else return w;
     }
 
-    template <std::size_t I> inline std::tuple_element_t<I, Vector4> &get() {
+    template <std::size_t I>
+    inline std::tuple_element_t<I, BasicVector4> &get() {
         CALCDA_IF_CONSTEXPR(I == 0)
         return x;
         else CALCDA_IF_CONSTEXPR(I == 1) return y;
@@ -230,24 +256,37 @@ class Vector4 {
     std::string toString() const;
 };
 
+using Vector4 = BasicVector4<float>;
+using Vector4d = BasicVector4<double>;
 using Point4 = Vector4;
+
+#if !defined(CALCDA_HEADER_ONLY_VECTORS) &&                                   \
+    !defined(CALCDA_INSTANTIATE_VECTORS) && !defined(SWIG)
+// instantiated in src/Vector4.cpp
+extern template class BasicVector4<float>;
+extern template class BasicVector4<double>;
+#endif
 } // namespace Calcda
 
 namespace std {
-template <>
-struct tuple_size<Calcda::Vector4> : integral_constant<size_t, 4> {};
+template <typename T>
+struct tuple_size<Calcda::BasicVector4<T>> : integral_constant<size_t, 4> {};
 
-template <size_t I> struct tuple_element<I, Calcda::Vector4> {
-    using type = float;
+template <size_t I, typename T>
+struct tuple_element<I, Calcda::BasicVector4<T>> {
+    using type = T;
 };
 
-template <> struct hash<Calcda::Vector4> {
-    size_t operator()(const Calcda::Vector4 &v) const noexcept {
+template <typename T> struct hash<Calcda::BasicVector4<T>> {
+    size_t operator()(const Calcda::BasicVector4<T> &v) const noexcept {
         return Calcda::Internal::hash_combine(
-            hash<float>()(v.x), hash<float>()(v.y), hash<float>()(v.z),
-            hash<float>()(v.w));
+            hash<T>()(v.x), hash<T>()(v.y), hash<T>()(v.z), hash<T>()(v.w));
     }
 };
 } // namespace std
 
+#ifdef CALCDA_HEADER_ONLY_VECTORS
+#include "Vector4.inl"
+#endif
+
 #endif // !CALCDA_VECTOR4_H
\ No newline at end of file
@@ -0,0 +1,479 @@
+#ifndef CALCDA_VECTOR4_INL
+#define CALCDA_VECTOR4_INL
+
+/*
+ * Definitions of Vector4, included by src/Vector4.cpp, or by Vector4.hpp when
+ * CALCDA_HEADER_ONLY_VECTORS is defined.
+ */
+
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+
+#include "Vector4.hpp"
+
+namespace Calcda {
+template <typename T>
+const BasicVector4<T> BasicVector4<T>::Zero =
+    BasicVector4(T(0), T(0), T(0), T(0));
+template <typename T>
+const BasicVector4<T> BasicVector4<T>::One =
+    BasicVector4(T(1), T(1), T(1), T(1));
+template <typename T>
+const BasicVector4<T> BasicVector4<T>::UnitX =
+    BasicVector4(T(1), T(0), T(0), T(0));
+template <typename T>
+const BasicVector4<T> BasicVector4<T>::UnitY =
+    BasicVector4(T(0), T(1), T(0), T(0));
+template <typename T>
+const BasicVector4<T> BasicVector4<T>::UnitZ =
+    BasicVector4(T(0), T(0), T(1), T(0));
+template <typename T>
+const BasicVector4<T> BasicVector4<T>::UnitW =
+    BasicVector4(T(0), T(0), T(0), T(1));
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector2<T> BasicVector4<T>::xy() const {
+    return BasicVector2<T>(x, y);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector2<T> BasicVector4<T>::yz() const {
+    return BasicVector2<T>(y, z);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector2<T> BasicVector4<T>::zw() const {
+    return BasicVector2<T>(z, w);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector3<T> BasicVector4<T>::xyz() const {
+    return BasicVector3<T>(x, y, z);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector3<T> BasicVector4<T>::yzw() const {
+    return BasicVector3<T>(y, z, w);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector4<T> BasicVector4<T>::xyzw() const {
+    return *this;
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector4<T> BasicVector4<T>::wzyx() const {
+    return BasicVector4(w, z, y, x);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR T *BasicVector4<T>::getData() { return &x; }
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR const T *BasicVector4<T>::getData() const { return &x; }
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector4<T> &
+BasicVector4<T>::selfAdd(const BasicVector4 &Other) {
+    x += Other.x;
+    y += Other.y;
+    z += Other.z;
+    w += Other.w;
+
+    return *this;
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector4<T> &
+BasicVector4<T>::selfSubtract(const BasicVector4 &Other) {
+    x -= Other.x;
+    y -= Other.y;
+    z -= Other.z;
+    w -= Other.w;
+
+    return *this;
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector4<T> &
+BasicVector4<T>::selfMultiply(const BasicVector4 &Other) {
+    x *= Other.x;
+    y *= Other.y;
+    z *= Other.z;
+    w *= Other.w;
+
+    return *this;
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector4<T> &BasicVector4<T>::selfDivide(T Amount) {
+    T reciprocal = T(1) / Amount;
+
+    x *= reciprocal;
+    y *= reciprocal;
+    z *= reciprocal;
+    w *= reciprocal;
+
+    return *this;
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector4<T> &
+BasicVector4<T>::selfDivide(const BasicVector4 &Other) {
+    x /= Other.x;
+    y /= Other.y;
+    z /= Other.z;
+    w /= Other.w;
+
+    return *this;
+}
+
+template <typename T>
+CALCDA_VECTOR_INLINE BasicVector4<T> &BasicVector4<T>::selfNormalize() {
+    T length = std::abs(std::sqrt(x * x + y * y));
+
+    x /= length;
+    y /= length;
+    z /= length;
+    w /= length;
+
+    return *this;
+}
+
+template <typename T>
+CALCDA_VECTOR_INLINE BasicVector4<T> &BasicVector4<T>::selfAbsolute() {
+    x = std::abs(x);
+    y = std::abs(y);
+    y = std::abs(z);
+    w = std::abs(w);
+
+    return *this;
+}
+
+template <typename T>
+CALCDA_VECTOR_INLINE BasicVector4<T> &BasicVector4<T>::selfSqrt() {
+    x = std::sqrt(x);
+    y = std::sqrt(y);
+    z = std::sqrt(z);
+    w = std::sqrt(w);
+
+    return *this;
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector4<T> &BasicVector4<T>::selfNegate() {
+    x = -x;
+    y = -y;
+    z = -z;
+    w = -w;
+
+    return *this;
+}
+
+template <typename T>
+/* [[nodiscard]] */ CALCDA_VECTOR_CONSTEXPR BasicVector4<T>
+BasicVector4<T>::add(const BasicVector4 &Other) const {
+    BasicVector4 result;
+
+    result.x = x + Other.x;
+    result.y = y + Other.y;
+    result.z = z + Other.z;
+    result.w = w + Other.w;
+
+    return result;
+}
+
+template <typename T>
+/* [[nodiscard]] */ CALCDA_VECTOR_CONSTEXPR BasicVector4<T>
+BasicVector4<T>::subtract(const BasicVector4 &Other) const {
+    BasicVector4 result;
+
+    result.x = x - Other.x;
+    result.y = y - Other.y;
+    result.z = z - Other.z;
+    result.w = w - Other.w;
+
+    return result;
+}
+
+template <typename T>
+/* [[nodiscard]] */ CALCDA_VECTOR_CONSTEXPR BasicVector4<T>
+BasicVector4<T>::multiply(const BasicVector4 &Other) const {
+    BasicVector4 result;
+
+    result.x = x * Other.x;
+    result.y = y * Other.y;
+    result.z = z * Other.z;
+    result.w = w * Other.w;
+
+    return result;
+}
+
+template <typename T>
+/* [[nodiscard]] */ CALCDA_VECTOR_CONSTEXPR BasicVector4<T>
+BasicVector4<T>::divide(T Amount) const {
+    BasicVector4 result;
+
+    T reciprocal = T(1) / Amount;
+
+    result.x = x * reciprocal;
+    result.y = y * reciprocal;
+    result.z = z * reciprocal;
+    result.w = w * reciprocal;
+
+    return result;
+}
+
+template <typename T>
+/* [[nodiscard]] */ CALCDA_VECTOR_CONSTEXPR BasicVector4<T>
+BasicVector4<T>::divide(const BasicVector4 &Other) const {
+    BasicVector4 result;
+
+    result.x = x / Other.x;
+    result.y = y / Other.y;
+    result.z = z / Other.z;
+    result.w = w / Other.w;
+
+    return result;
+}
+
+template <typename T>
+/* [[nodiscard]] */ CALCDA_VECTOR_INLINE BasicVector4<T>
+BasicVector4<T>::normalize() const {
+    BasicVector4 result;
+
+    T LengthReciprocal = T(1) / std::sqrt(x * x + y * y + z * z + w * w);
+
+    result.x = x * LengthReciprocal;
+    result.y = y * LengthReciprocal;
+    result.z = z * LengthReciprocal;
+    result.w = w * LengthReciprocal;
+
+    return result;
+}
+
+template <typename T>
+/* [[nodiscard]] */ CALCDA_VECTOR_CONSTEXPR BasicVector4<T>
+BasicVector4<T>::negate() const {
+    return BasicVector4(-x, -y, -z, -w);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector4<T>
+BasicVector4<T>::operator+(const BasicVector4 &Other) const {
+    return add(Other);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector4<T>
+BasicVector4<T>::operator-(const BasicVector4 &Other) const {
+    return subtract(Other);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector4<T>
+BasicVector4<T>::operator*(const BasicVector4 &Other) const {
+    return multiply(Other);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector4<T>
+BasicVector4<T>::operator/(const BasicVector4 &Other) const {
+    return divide(Other);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector4<T>
+BasicVector4<T>::operator/(T Amount) const {
+    return divide(Amount);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector4<T> BasicVector4<T>::operator-() const {
+    return negate();
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector4<T> &
+BasicVector4<T>::operator=(const BasicVector4 &Other) {
+    x = Other.x;
+    y = Other.y;
+    z = Other.z;
+    w = Other.w;
+
+    return *this;
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector4<T> &
+BasicVector4<T>::operator+=(const BasicVector4 &Other) {
+    return selfAdd(Other);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector4<T> &
+BasicVector4<T>::operator-=(const BasicVector4 &Other) {
+    return selfSubtract(Other);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector4<T> &
+BasicVector4<T>::operator*=(const BasicVector4 &Other) {
+    return selfMultiply(Other);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector4<T> &
+BasicVector4<T>::operator/=(const BasicVector4 &Other) {
+    return selfDivide(Other);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector4<T> &BasicVector4<T>::operator/=(T Amount) {
+    return selfDivide(Amount);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR bool
+BasicVector4<T>::operator==(const BasicVector4 &Other) const {
+    return (x == Other.x && y == Other.y && z == Other.z && w == Other.w);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR bool
+BasicVector4<T>::operator!=(const BasicVector4 &Other) const {
+    return (x != Other.x || y != Other.y || z != Other.z || w != Other.w);
+}
+
+// https://referencesource.microsoft.com/#System.Numerics/System/Numerics/Vector2_Intrinsics.cs
+template <typename T>
+CALCDA_VECTOR_INLINE BasicVector4<T> BasicVector4<T>::absolute() const {
+    BasicVector4 result;
+
+    result.x = std::abs(x);
+    result.y = std::abs(y);
+    result.z = std::abs(z);
+    result.w = std::abs(w);
+
+    return result;
+}
+
+template <typename T>
+CALCDA_VECTOR_INLINE BasicVector4<T> BasicVector4<T>::sqrt() const {
+    BasicVector4 result;
+
+    result.x = std::sqrt(x);
+    result.y = std::sqrt(y);
+    result.z = std::sqrt(z);
+    result.w = std::sqrt(w);
+
+    return result;
+}
+
+template <typename T>
+CALCDA_VECTOR_INLINE T
+BasicVector4<T>::distance(const BasicVector4 &Other) const {
+    return subtract(Other).length();
+}
+
+template <typename T>
+CALCDA_VECTOR_INLINE T BasicVector4<T>::length() const {
+    return std::sqrt(x * x + y * y + z * z + w * w);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR T BasicVector4<T>::lengthSquared() const {
+    return x * x + y * y + z * z + w * w;
+}
+
+// https://referencesource.microsoft.com/#System.Numerics/System/Numerics/Vector4.cs
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector4<T>
+BasicVector4<T>::reflect(const BasicVector4 &Value,
+                         const BasicVector4 &Surface) {
+    T DotProduct = Value.x * Surface.x + Value.y * Surface.y +
+                       Value.z * Surface.z + Value.w * Surface.w;
+
+    return BasicVector4(Value.x - T(2) * DotProduct * Surface.x,
+                        Value.y - T(2) * DotProduct * Surface.y,
+                        Value.z - T(2) * DotProduct * Surface.z,
+                        Value.w - T(2) * DotProduct * Surface.w);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector4<T>
+BasicVector4<T>::clamp(const BasicVector4 &Value, const BasicVector4 &min,
+                       const BasicVector4 &max) {
+    T X = Value.x;
+    X = (X > max.x) ? max.x : X;
+    X = (X < min.x) ? min.x : X;
+
+    T Y = Value.y;
+    Y = (Y > max.y) ? max.y : Y;
+    Y = (Y < min.y) ? min.y : Y;
+
+    T Z = Value.z;
+    Z = (Z > max.z) ? max.z : Z;
+    Z = (Z < min.z) ? min.z : Z;
+
+    T W = Value.w;
+    W = (W > max.w) ? max.w : W;
+    W = (W < min.w) ? min.w : W;
+
+    return BasicVector4(X, Y, Z, W);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector4<T>
+BasicVector4<T>::lerp(const BasicVector4 &Value1, const BasicVector4 &Value2,
+                      T Amount) {
+    return BasicVector4(Value1.x + (Value2.x - Value1.x) * Amount,
+                        Value1.y + (Value2.y - Value1.y) * Amount,
+                        Value1.z + (Value2.z - Value1.z) * Amount,
+                        Value1.w + (Value2.w - Value1.w) * Amount);
+}
+
+// https://referencesource.microsoft.com/#System.Numerics/System/Numerics/Vector2_Intrinsics.cs
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR T
+BasicVector4<T>::dot(const BasicVector4 &Value1, const BasicVector4 &Value2) {
+    return (Value1.x * Value2.x + Value1.y * Value2.y + Value1.z * Value2.z +
+            Value1.w * Value2.w);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector4<T>
+BasicVector4<T>::vmin(const BasicVector4 &Value1, const BasicVector4 &Value2) {
+    return BasicVector4((Value1.x < Value2.x) ? Value1.x : Value2.x,
+                        (Value1.y < Value2.y) ? Value1.y : Value2.y,
+                        (Value1.z < Value2.z) ? Value1.z : Value2.z,
+                        (Value1.w < Value2.w) ? Value1.w : Value2.w);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector4<T>
+BasicVector4<T>::vmax(const BasicVector4 &Value1, const BasicVector4 &Value2) {
+    return BasicVector4((Value1.x < Value2.x) ? Value1.x : Value2.x,
+                        (Value1.y < Value2.y) ? Value1.y : Value2.y,
+                        (Value1.z < Value2.z) ? Value1.z : Value2.z,
+                        (Value1.w < Value2.w) ? Value1.w : Value2.w);
+}
+
+template <typename T>
+CALCDA_VECTOR_CONSTEXPR BasicVector4<T> BasicVector4<T>::scalar(T Value) {
+    return BasicVector4(Value, Value, Value, Value);
+}
+
+template <typename T>
+CALCDA_VECTOR_INLINE std::string BasicVector4<T>::toString() const {
+    std::stringstream stream;
+
+    stream << std::fixed << std::setprecision(2) << "<" << x << ", " << y
+           << ", " << z << ", " << w << ">";
+
+    return stream.str();
+}
+} // namespace Calcda
+
+#endif // !CALCDA_VECTOR4_INL
@@ -0,0 +1,228 @@
+#ifndef CALCDA_VECTORSOA_H
+#define CALCDA_VECTORSOA_H
+
+#include "Intrinsic.hpp"
+#include "Vector2.hpp" // Calcda::Vector2
+#include "Vector3.hpp" // Calcda::Vector3
+#include "Vector4.hpp" // Calcda::Vector4
+
+#include <cstddef>
+#include <vector>
+
+namespace Calcda {
+//! @brief Aligned stream of floats, used by the structure-of-arrays containers
+using FloatStream = std::vector<float, Internal::AlignedAllocator<float>>;
+
+/**
+ * @brief Structure-of-arrays container of 2-dimensional vectors
+ * @see Vector3SoA
+ */
+class Vector2SoA {
+  public:
+    FloatStream x;
+    FloatStream y;
+
+  public:
+    Vector2SoA() = default;
+    explicit Vector2SoA(std::size_t Size);
+    Vector2SoA(const std::vector<Vector2> &Vectors);
+    Vector2SoA(const Vector2 *Vectors, std::size_t Count);
+
+    //! @brief Returns the number of vectors stored
+    std::size_t size() const;
+
+    //! @brief Resizes every stream to @c Size elements
+    void resize(std::size_t Size);
+
+    //! @brief Reserves space for @c Size elements in every stream
+    void reserve(std::size_t Size);
+
+    //! @brief Appends @c Value to the end of the streams
+    void append(const Vector2 &Value);
+
+    //! @brief Returns the vector at @c Index
+    Vector2 get(std::size_t Index) const;
+
+    //! @brief Sets the vector at @c Index to @c Value
+    void set(std::size_t Index, const Vector2 &Value);
+
+    //! @brief Converts the container to an array of @c Vector2
+    std::vector<Vector2> toVector() const;
+
+    //! @brief Writes the lengths of the vectors to @c Out
+    void length(float *Out) const;
+
+    //! @brief Writes the squared lengths of the vectors to @c Out
+    void lengthSquared(float *Out) const;
+
+    //! @brief Normalizes every vector in the container
+    Vector2SoA &selfNormalize();
+
+    //! @brief Writes the dot products of @c Value1 and @c Value2 to @c Out
+    static void dot(const Vector2SoA &Value1, const Vector2SoA &Value2,
+                    float *Out);
+
+    //! @brief Linear interpolates between @c Value1 and @c Value2 by @c Amount
+    static void lerp(const Vector2SoA &Value1, const Vector2SoA &Value2,
+                     float Amount, Vector2SoA &Out);
+
+    //! @brief Clamps every vector of @c Value between @c min and @c max
+    static void clamp(const Vector2SoA &Value, const Vector2 &min,
+                      const Vector2 &max, Vector2SoA &Out);
+
+    //! @brief Writes the element-wise smaller vectors to @c Out
+    static void vmin(const Vector2SoA &Value1, const Vector2SoA &Value2,
+                     Vector2SoA &Out);
+
+    //! @brief Writes the element-wise larger vectors to @c Out
+    static void vmax(const Vector2SoA &Value1, const Vector2SoA &Value2,
+                     Vector2SoA &Out);
+};
+
+/**
+ * @brief Structure-of-arrays container of 3-dimensional vectors
+ *
+ * The elements are stored in separate, aligned @c x, @c y, @c z streams, so
+ * the bulk operations work on full SIMD registers. The bulk operations
+ * mirror the @c Vector3 API; the operands of a binary operation must have the
+ * same size, and the outputs must have room for that many elements. Unless
+ * noted otherwise, the output may be one of the operands.
+ */
+class Vector3SoA {
+  public:
+    FloatStream x;
+    FloatStream y;
+    FloatStream z;
+
+  public:
+    Vector3SoA() = default;
+    explicit Vector3SoA(std::size_t Size);
+    Vector3SoA(const std::vector<Vector3> &Vectors);
+    Vector3SoA(const Vector3 *Vectors, std::size_t Count);
+
+    //! @brief Returns the number of vectors stored
+    std::size_t size() const;
+
+    //! @brief Resizes every stream to @c Size elements
+    void resize(std::size_t Size);
+
+    //! @brief Reserves space for @c Size elements in every stream
+    void reserve(std::size_t Size);
+
+    //! @brief Appends @c Value to the end of the streams
+    void append(const Vector3 &Value);
+
+    //! @brief Returns the vector at @c Index
+    Vector3 get(std::size_t Index) const;
+
+    //! @brief Sets the vector at @c Index to @c Value
+    void set(std::size_t Index, const Vector3 &Value);
+
+    //! @brief Converts the container to an array of @c Vector3
+    std::vector<Vector3> toVector() const;
+
+    //! @brief Writes the lengths of the vectors to @c Out
+    void length(float *Out) const;
+
+    //! @brief Writes the squared lengths of the vectors to @c Out
+    void lengthSquared(float *Out) const;
+
+    //! @brief Normalizes every vector in the container
+    Vector3SoA &selfNormalize();
+
+    //! @brief Writes the dot products of @c Value1 and @c Value2 to @c Out
+    static void dot(const Vector3SoA &Value1, const Vector3SoA &Value2,
+                    float *Out);
+
+    //! @brief Writes the cross products of @c Value1 and @c Value2 to @c Out,
+    //! which must not be one of the operands
+    static void cross(const Vector3SoA &Value1, const Vector3SoA &Value2,
+                      Vector3SoA &Out);
+
+    //! @brief Linear interpolates between @c Value1 and @c Value2 by @c Amount
+    static void lerp(const Vector3SoA &Value1, const Vector3SoA &Value2,
+                     float Amount, Vector3SoA &Out);
+
+    //! @brief Clamps every vector of @c Value between @c min and @c max
+    static void clamp(const Vector3SoA &Value, const Vector3 &min,
+                      const Vector3 &max, Vector3SoA &Out);
+
+    //! @brief Writes the element-wise smaller vectors to @c Out
+    static void vmin(const Vector3SoA &Value1, const Vector3SoA &Value2,
+                     Vector3SoA &Out);
+
+    //! @brief Writes the element-wise larger vectors to @c Out
+    static void vmax(const Vector3SoA &Value1, const Vector3SoA &Value2,
+                     Vector3SoA &Out);
+};
+
+/**
+ * @brief Structure-of-arrays container of 4-dimensional vectors
+ * @see Vector3SoA
+ */
+class Vector4SoA {
+  public:
+    FloatStream x;
+    FloatStream y;
+    FloatStream z;
+    FloatStream w;
+
+  public:
+    Vector4SoA() = default;
+    explicit Vector4SoA(std::size_t Size);
+    Vector4SoA(const std::vector<Vector4> &Vectors);
+    Vector4SoA(const Vector4 *Vectors, std::size_t Count);
+
+    //! @brief Returns the number of vectors stored
+    std::size_t size() const;
+
+    //! @brief Resizes every stream to @c Size elements
+    void resize(std::size_t Size);
+
+    //! @brief Reserves space for @c Size elements in every stream
+    void reserve(std::size_t Size);
+
+    //! @brief Appends @c Value to the end of the streams
+    void append(const Vector4 &Value);
+
+    //! @brief Returns the vector at @c Index
+    Vector4 get(std::size_t Index) const;
+
+    //! @brief Sets the vector at @c Index to @c Value
+    void set(std::size_t Index, const Vector4 &Value);
+
+    //! @brief Converts the container to an array of @c Vector4
+    std::vector<Vector4> toVector() const;
+
+    //! @brief Writes the lengths of the vectors to @c Out
+    void length(float *Out) const;
+
+    //! @brief Writes the squared lengths of the vectors to @c Out
+    void lengthSquared(float *Out) const;
+
+    //! @brief Normalizes every vector in the container
+    Vector4SoA &selfNormalize();
+
+    //! @brief Writes the dot products of @c Value1 and @c Value2 to @c Out
+    static void dot(const Vector4SoA &Value1, const Vector4SoA &Value2,
+                    float *Out);
+
+    //! @brief Linear interpolates between @c Value1 and @c Value2 by @c Amount
+    static void lerp(const Vector4SoA &Value1, const Vector4SoA &Value2,
+                     float Amount, Vector4SoA &Out);
+
+    //! @brief Clamps every vector of @c Value between @c min and @c max
+    static void clamp(const Vector4SoA &Value, const Vector4 &min,
+                      const Vector4 &max, Vector4SoA &Out);
+
+    //! @brief Writes the element-wise smaller vectors to @c Out
+    static void vmin(const Vector4SoA &Value1, const Vector4SoA &Value2,
+                     Vector4SoA &Out);
+
+    //! @brief Writes the element-wise larger vectors to @c Out
+    static void vmax(const Vector4SoA &Value1, const Vector4SoA &Value2,
+                     Vector4SoA &Out);
+};
+} // namespace Calcda
+
+#endif // !CALCDA_VECTORSOA_H
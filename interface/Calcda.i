@@ -8,55 +8,63 @@
 	#include "../include/Vector4.hpp"
 	#include "../include/Matrix3.hpp"
 	#include "../include/Matrix4.hpp"
+	#include "../include/Frustum.hpp"
+	#include "../include/AABB3.hpp"
 	#include "../include/Geometry.hpp"
+	#include "../include/Predicates.hpp"
+	#include "../include/ConvexHull.hpp"
+	#include "../include/SegmentIntersection.hpp"
+	#include "../include/TriangleMesh.hpp"
 	#include "../include/Rotation.hpp"
+	#include "../include/Transform.hpp"
+	#include "../include/TransformHierarchy.hpp"
 	#include "../include/Integer.hpp"
 %}
 
-%nspace Calcda::Vector2;
-%nspace Calcda::Vector3;
-%nspace Calcda::Vector4;
+%nspace Calcda::BasicVector2;
+%nspace Calcda::BasicVector3;
+%nspace Calcda::BasicVector4;
 %nspace Calcda::Matrix3;
-%nspace Calcda::Matrix4;
-
-%ignore Calcda::Vector2::operator*;
-%ignore Calcda::Vector2::operator*=;
-%ignore Calcda::Vector2::operator+;
-%ignore Calcda::Vector2::operator+=;
-%ignore Calcda::Vector2::operator-;
-%ignore Calcda::Vector2::operator-=;
-%ignore Calcda::Vector2::operator/;
-%ignore Calcda::Vector2::operator/=;
-%ignore Calcda::Vector2::operator=;
-%ignore Calcda::Vector2::operator==;
-%ignore Calcda::Vector2::operator!=;
-%ignore Calcda::Vector2::getData() const;
-
-%ignore Calcda::Vector3::operator*;
-%ignore Calcda::Vector3::operator*=;
-%ignore Calcda::Vector3::operator+;
-%ignore Calcda::Vector3::operator+=;
-%ignore Calcda::Vector3::operator-;
-%ignore Calcda::Vector3::operator-=;
-%ignore Calcda::Vector3::operator/;
-%ignore Calcda::Vector3::operator/=;
-%ignore Calcda::Vector3::operator=;
-%ignore Calcda::Vector3::operator==;
-%ignore Calcda::Vector3::operator!=;
-%ignore Calcda::Vector3::getData() const;
-
-%ignore Calcda::Vector4::operator*;
-%ignore Calcda::Vector4::operator*=;
-%ignore Calcda::Vector4::operator+;
-%ignore Calcda::Vector4::operator+=;
-%ignore Calcda::Vector4::operator-;
-%ignore Calcda::Vector4::operator-=;
-%ignore Calcda::Vector4::operator/;
-%ignore Calcda::Vector4::operator/=;
-%ignore Calcda::Vector4::operator=;
-%ignore Calcda::Vector4::operator==;
-%ignore Calcda::Vector4::operator!=;
-%ignore Calcda::Vector4::getData() const;
+%nspace Calcda::BasicMatrix4;
+
+%ignore Calcda::BasicVector2::operator*;
+%ignore Calcda::BasicVector2::operator*=;
+%ignore Calcda::BasicVector2::operator+;
+%ignore Calcda::BasicVector2::operator+=;
+%ignore Calcda::BasicVector2::operator-;
+%ignore Calcda::BasicVector2::operator-=;
+%ignore Calcda::BasicVector2::operator/;
+%ignore Calcda::BasicVector2::operator/=;
+%ignore Calcda::BasicVector2::operator=;
+%ignore Calcda::BasicVector2::operator==;
+%ignore Calcda::BasicVector2::operator!=;
+%ignore Calcda::BasicVector2::getData() const;
+
+%ignore Calcda::BasicVector3::operator*;
+%ignore Calcda::BasicVector3::operator*=;
+%ignore Calcda::BasicVector3::operator+;
+%ignore Calcda::BasicVector3::operator+=;
+%ignore Calcda::BasicVector3::operator-;
+%ignore Calcda::BasicVector3::operator-=;
+%ignore Calcda::BasicVector3::operator/;
+%ignore Calcda::BasicVector3::operator/=;
+%ignore Calcda::BasicVector3::operator=;
+%ignore Calcda::BasicVector3::operator==;
+%ignore Calcda::BasicVector3::operator!=;
+%ignore Calcda::BasicVector3::getData() const;
+
+%ignore Calcda::BasicVector4::operator*;
+%ignore Calcda::BasicVector4::operator*=;
+%ignore Calcda::BasicVector4::operator+;
+%ignore Calcda::BasicVector4::operator+=;
+%ignore Calcda::BasicVector4::operator-;
+%ignore Calcda::BasicVector4::operator-=;
+%ignore Calcda::BasicVector4::operator/;
+%ignore Calcda::BasicVector4::operator/=;
+%ignore Calcda::BasicVector4::operator=;
+%ignore Calcda::BasicVector4::operator==;
+%ignore Calcda::BasicVector4::operator!=;
+%ignore Calcda::BasicVector4::getData() const;
 
 %ignore Calcda::Matrix3::operator*;
 %ignore Calcda::Matrix3::operator*=;
@@ -71,20 +79,68 @@
 %ignore Calcda::Matrix3::operator!=;
 %ignore Calcda::Matrix3::getData() const;
 
-%ignore Calcda::Matrix4::operator*;
-%ignore Calcda::Matrix4::operator*=;
-%ignore Calcda::Matrix4::operator+;
-%ignore Calcda::Matrix4::operator+=;
-%ignore Calcda::Matrix4::operator-;
-%ignore Calcda::Matrix4::operator-=;
-%ignore Calcda::Matrix4::operator/;
-%ignore Calcda::Matrix4::operator/=;
-%ignore Calcda::Matrix4::operator=;
-%ignore Calcda::Matrix4::operator==;
-%ignore Calcda::Matrix4::operator!=;
-%ignore Calcda::Matrix4::getData() const;
+%ignore Calcda::BasicMatrix4::operator*;
+%ignore Calcda::BasicMatrix4::operator*=;
+%ignore Calcda::BasicMatrix4::operator+;
+%ignore Calcda::BasicMatrix4::operator+=;
+%ignore Calcda::BasicMatrix4::operator-;
+%ignore Calcda::BasicMatrix4::operator-=;
+%ignore Calcda::BasicMatrix4::operator/;
+%ignore Calcda::BasicMatrix4::operator/=;
+%ignore Calcda::BasicMatrix4::operator=;
+%ignore Calcda::BasicMatrix4::operator==;
+%ignore Calcda::BasicMatrix4::operator!=;
+%ignore Calcda::BasicMatrix4::getData() const;
+%ignore Calcda::BasicMatrix4::inverseChecked;
+
+%ignore Calcda::Quaternion::operator*;
+%ignore Calcda::Quaternion::operator*=;
+%ignore Calcda::Quaternion::operator-;
+%ignore Calcda::Quaternion::operator==;
+%ignore Calcda::Quaternion::operator!=;
+%ignore Calcda::Quaternion::toAxisAngle;
+%ignore Calcda::Quaternion::slerpBatch;
+
+%ignore Calcda::Frustum::intersectsSpheres;
+%ignore Calcda::Frustum::intersectsBoxes;
+
+%ignore Calcda::AABB3::operator==;
+%ignore Calcda::AABB3::operator!=;
+%ignore Calcda::AABB3::fromPoints;
+%ignore Calcda::AABB3::intersectRayBatch;
+
+%ignore Calcda::TriangleMesh::intersectRays;
+
+%ignore Calcda::Transform::operator*;
+%ignore Calcda::Transform::operator*=;
+%ignore Calcda::Transform::operator==;
+%ignore Calcda::Transform::operator!=;
 
 %ignore Calcda::Polygon::Polygon(std::initializer_list<Vector2>);
+%ignore Calcda::PreparedPolygon::PreparedPolygon(std::initializer_list<Vector2>);
+%ignore Calcda::Polygon::Polygon(std::vector<Vector2> &&);
+%ignore Calcda::Polygon::Polygon(Polygon &&);
+%ignore Calcda::Polygon::operator=;
+%ignore Calcda::PreparedPolygon::PreparedPolygon(Polygon &&);
+%ignore Calcda::PolygonView::PolygonView(const float *, std::size_t);
+%ignore Calcda::PointSpan::operator[];
+%ignore Calcda::computePolygonMetrics(const PointSpan *, std::size_t, PolygonMetrics *, Summation, unsigned int);
+%ignore Calcda::Circle::containsPoints;
+%ignore Calcda::Circle::intersectLines;
+%ignore Calcda::PreparedPolygon::containsPoints;
+%ignore Calcda::Shape::intersectLine(Vector2, Vector2, LineType, Vector2 *, std::size_t) const;
+%ignore Calcda::Line::intersectLine(Vector2, Vector2, LineType, Vector2 *, std::size_t) const;
+%ignore Calcda::Circle::intersectLine(Vector2, Vector2, LineType, Vector2 *, std::size_t) const;
+%ignore Calcda::Polygon::intersectLine(Vector2, Vector2, LineType, Vector2 *, std::size_t) const;
+%ignore Calcda::PolygonView::intersectLine(Vector2, Vector2, LineType, Vector2 *, std::size_t) const;
+
+%ignore Calcda::Predicates::Internal::expansionSum;
+%ignore Calcda::Predicates::Internal::expansionScale;
+%ignore Calcda::Predicates::Internal::expansionEstimate;
+%ignore Calcda::Predicates::Internal::cross2dExpansion;
+%ignore Calcda::intersectSegments(const Vector2 *, std::size_t);
+%ignore Calcda::computeConvexHull(const Vector2 *, std::size_t, unsigned int);
+%ignore Calcda::computeConvexHull(const Vector3 *, std::size_t);
 
 %include "../include/Intrinsic.hpp"
 %include "../include/Vector2.hpp"
@@ -92,6 +148,23 @@
 %include "../include/Vector4.hpp"
 %include "../include/Matrix3.hpp"
 %include "../include/Matrix4.hpp"
+%include "../include/Frustum.hpp"
+%include "../include/AABB3.hpp"
 %include "../include/Geometry.hpp"
+%include "../include/Predicates.hpp"
+%include "../include/ConvexHull.hpp"
+%include "../include/SegmentIntersection.hpp"
+%include "../include/TriangleMesh.hpp"
 %include "../include/Rotation.hpp"
-%include "../include/Integer.hpp"
\ No newline at end of file
+%include "../include/Transform.hpp"
+%include "../include/TransformHierarchy.hpp"
+%include "../include/Integer.hpp"
+
+%template(Vector2) Calcda::BasicVector2<float>;
+%template(Vector2d) Calcda::BasicVector2<double>;
+%template(Vector3) Calcda::BasicVector3<float>;
+%template(Vector3d) Calcda::BasicVector3<double>;
+%template(Vector4) Calcda::BasicVector4<float>;
+%template(Vector4d) Calcda::BasicVector4<double>;
+%template(Matrix4) Calcda::BasicMatrix4<float>;
+%template(Matrix4d) Calcda::BasicMatrix4<double>;
\ No newline at end of file
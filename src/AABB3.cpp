@@ -0,0 +1,311 @@
+#include "AABB3.hpp"
+
+#include "Slab.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <sstream>
+
+#if defined(CALCDA_SIMD_SSE2)
+#include <immintrin.h>
+#elif defined(CALCDA_SIMD_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace Calcda {
+
+// the SIMD paths read each corner as 4 floats, and the boxes 8 floats apart
+static_assert(sizeof(AABB3) == 8 * sizeof(float) &&
+                  offsetof(AABB3, maximum) == 4 * sizeof(float),
+              "AABB3 must be two padded corners");
+
+namespace {
+using Internal::component;
+using Internal::slabInverse;
+
+/*
+ * The corners with the smaller of the minimums and the larger of the
+ * maximums; swapping the operations gives the intersection. Result may alias
+ * either box, and is written in place, as copying a box copies its Vector3s
+ * through their out-of-line assignment
+ */
+template <bool Merge>
+void combine(const AABB3 &Left, const AABB3 &Right, AABB3 &Result) {
+
+#if defined(CALCDA_SIMD_SSE2)
+    const __m128 leftMinimum = _mm_load_ps(&Left.minimum.x),
+                 leftMaximum = _mm_load_ps(&Left.maximum.x),
+                 rightMinimum = _mm_load_ps(&Right.minimum.x),
+                 rightMaximum = _mm_load_ps(&Right.maximum.x);
+
+    _mm_store_ps(&Result.minimum.x,
+                 Merge ? _mm_min_ps(leftMinimum, rightMinimum)
+                       : _mm_max_ps(leftMinimum, rightMinimum));
+    _mm_store_ps(&Result.maximum.x,
+                 Merge ? _mm_max_ps(leftMaximum, rightMaximum)
+                       : _mm_min_ps(leftMaximum, rightMaximum));
+#elif defined(CALCDA_SIMD_NEON)
+    const float32x4_t leftMinimum = vld1q_f32(&Left.minimum.x),
+                      leftMaximum = vld1q_f32(&Left.maximum.x),
+                      rightMinimum = vld1q_f32(&Right.minimum.x),
+                      rightMaximum = vld1q_f32(&Right.maximum.x);
+
+    vst1q_f32(&Result.minimum.x, Merge
+                                     ? vminq_f32(leftMinimum, rightMinimum)
+                                     : vmaxq_f32(leftMinimum, rightMinimum));
+    vst1q_f32(&Result.maximum.x, Merge
+                                     ? vmaxq_f32(leftMaximum, rightMaximum)
+                                     : vminq_f32(leftMaximum, rightMaximum));
+#else
+    const auto lower = [](float a, float b) {
+        return Merge ? std::min(a, b) : std::max(a, b);
+    };
+    const auto upper = [](float a, float b) {
+        return Merge ? std::max(a, b) : std::min(a, b);
+    };
+
+    Result.minimum.x = lower(Left.minimum.x, Right.minimum.x);
+    Result.minimum.y = lower(Left.minimum.y, Right.minimum.y);
+    Result.minimum.z = lower(Left.minimum.z, Right.minimum.z);
+    Result.maximum.x = upper(Left.maximum.x, Right.maximum.x);
+    Result.maximum.y = upper(Left.maximum.y, Right.maximum.y);
+    Result.maximum.z = upper(Left.maximum.z, Right.maximum.z);
+#endif
+}
+
+#if defined(CALCDA_SIMD_SSE2)
+/*
+ * Slab test of 4 boxes, with their corners transposed into registers of x,
+ * y and z values. Like intersectRay, the axes where the direction is zero
+ * only test whether the origin is within the slab
+ */
+__m128 intersectRay4(const AABB3 *Boxes, const __m128 (&Origin)[3],
+                     const __m128 (&Inverse)[3], const bool (&Parallel)[3],
+                     __m128 MaxDistance) {
+    const float *data = &Boxes[0].minimum.x;
+
+    __m128 minimum[4] = {_mm_load_ps(data), _mm_load_ps(data + 8),
+                         _mm_load_ps(data + 16), _mm_load_ps(data + 24)};
+    __m128 maximum[4] = {_mm_load_ps(data + 4), _mm_load_ps(data + 12),
+                         _mm_load_ps(data + 20), _mm_load_ps(data + 28)};
+    _MM_TRANSPOSE4_PS(minimum[0], minimum[1], minimum[2], minimum[3]);
+    _MM_TRANSPOSE4_PS(maximum[0], maximum[1], maximum[2], maximum[3]);
+
+    // an empty box has an inverted slab, which would turn into an infinite
+    // one once t1 and t2 are sorted
+    __m128 hit = _mm_castsi128_ps(_mm_set1_epi32(-1));
+    __m128 entry = _mm_setzero_ps(), exit = MaxDistance;
+    for (unsigned axis = 0; axis < 3; ++axis) {
+        hit = _mm_and_ps(hit, _mm_cmple_ps(minimum[axis], maximum[axis]));
+
+        if (Parallel[axis]) {
+            const __m128 inside =
+                _mm_and_ps(_mm_cmple_ps(minimum[axis], Origin[axis]),
+                           _mm_cmple_ps(Origin[axis], maximum[axis]));
+            exit = _mm_or_ps(_mm_and_ps(inside, exit),
+                             _mm_andnot_ps(inside, _mm_set1_ps(-INFINITY)));
+            continue;
+        }
+
+        const __m128 t1 = _mm_mul_ps(_mm_sub_ps(minimum[axis], Origin[axis]),
+                                     Inverse[axis]),
+                     t2 = _mm_mul_ps(_mm_sub_ps(maximum[axis], Origin[axis]),
+                                     Inverse[axis]);
+
+        entry = _mm_max_ps(entry, _mm_min_ps(t1, t2));
+        exit = _mm_min_ps(exit, _mm_max_ps(t1, t2));
+    }
+
+    hit = _mm_and_ps(hit, _mm_cmple_ps(entry, exit));
+    return _mm_or_ps(_mm_and_ps(hit, entry),
+                     _mm_andnot_ps(hit, _mm_set1_ps(INFINITY)));
+}
+#endif
+} // namespace
+
+const AABB3 AABB3::Empty = AABB3();
+
+/* static */ AABB3 AABB3::fromPoints(const Vector3 *Points,
+                                     std::size_t Count) {
+    AABB3 result;
+    for (std::size_t i = 0; i < Count; ++i)
+        result.selfMerge(Points[i]);
+
+    return result;
+}
+
+/* static */ AABB3 AABB3::fromCenter(Vector3 Center, Vector3 Extent) {
+    return AABB3(Center - Extent, Center + Extent);
+}
+
+bool AABB3::isEmpty() const {
+    return minimum.x > maximum.x || minimum.y > maximum.y ||
+           minimum.z > maximum.z;
+}
+
+Vector3 AABB3::center() const {
+    return Vector3(0.5f * (minimum.x + maximum.x),
+                   0.5f * (minimum.y + maximum.y),
+                   0.5f * (minimum.z + maximum.z));
+}
+
+Vector3 AABB3::extent() const {
+    return Vector3(0.5f * (maximum.x - minimum.x),
+                   0.5f * (maximum.y - minimum.y),
+                   0.5f * (maximum.z - minimum.z));
+}
+
+float AABB3::surfaceArea() const {
+    if (isEmpty())
+        return 0.0f;
+
+    const float x = maximum.x - minimum.x, y = maximum.y - minimum.y,
+                z = maximum.z - minimum.z;
+    return 2.0f * (x * y + y * z + z * x);
+}
+
+bool AABB3::containsPoint(Vector3 Point) const {
+    return minimum.x <= Point.x && Point.x <= maximum.x &&
+           minimum.y <= Point.y && Point.y <= maximum.y &&
+           minimum.z <= Point.z && Point.z <= maximum.z;
+}
+
+bool AABB3::contains(const AABB3 &Other) const {
+    return minimum.x <= Other.minimum.x && Other.maximum.x <= maximum.x &&
+           minimum.y <= Other.minimum.y && Other.maximum.y <= maximum.y &&
+           minimum.z <= Other.minimum.z && Other.maximum.z <= maximum.z;
+}
+
+bool AABB3::intersects(const AABB3 &Other) const {
+    return minimum.x <= Other.maximum.x && Other.minimum.x <= maximum.x &&
+           minimum.y <= Other.maximum.y && Other.minimum.y <= maximum.y &&
+           minimum.z <= Other.maximum.z && Other.minimum.z <= maximum.z;
+}
+
+AABB3 AABB3::merge(const AABB3 &Other) const {
+    AABB3 result;
+    combine<true>(*this, Other, result);
+    return result;
+}
+
+AABB3 AABB3::merge(Vector3 Point) const {
+    AABB3 result;
+    combine<true>(*this, AABB3(Point, Point), result);
+    return result;
+}
+
+AABB3 &AABB3::selfMerge(const AABB3 &Other) {
+    combine<true>(*this, Other, *this);
+    return *this;
+}
+
+AABB3 &AABB3::selfMerge(Vector3 Point) {
+    combine<true>(*this, AABB3(Point, Point), *this);
+    return *this;
+}
+
+AABB3 AABB3::intersection(const AABB3 &Other) const {
+    AABB3 result;
+    combine<false>(*this, Other, result);
+    return result.isEmpty() ? Empty : result;
+}
+
+AABB3 AABB3::transform(const Matrix4 &Transform) const {
+    if (isEmpty())
+        return Empty;
+
+    // the center moves with the matrix; the extent grows by the absolute
+    // values of the rotation and scaling
+    const auto &m = Transform.value.matrix;
+    const Vector3 c = center(), e = extent();
+
+    float newCenter[3], newExtent[3];
+    for (std::size_t row = 0; row < 3; ++row) {
+        newCenter[row] =
+            m[row][0] * c.x + m[row][1] * c.y + m[row][2] * c.z + m[row][3];
+        newExtent[row] = std::abs(m[row][0]) * e.x +
+                         std::abs(m[row][1]) * e.y + std::abs(m[row][2]) * e.z;
+    }
+
+    return fromCenter(Vector3(newCenter[0], newCenter[1], newCenter[2]),
+                      Vector3(newExtent[0], newExtent[1], newExtent[2]));
+}
+
+std::optional<float> AABB3::intersectRay(Vector3 Origin, Vector3 Direction,
+                                         float MaxDistance) const {
+    if (isEmpty())
+        return std::nullopt;
+
+    float entry = 0.0f, exit = MaxDistance;
+
+    for (unsigned axis = 0; axis < 3; ++axis) {
+        const float o = component(Origin, axis),
+                    d = component(Direction, axis),
+                    low = component(minimum, axis),
+                    high = component(maximum, axis);
+
+        if (d == 0.0f) {
+            if (o < low || o > high)
+                return std::nullopt;
+            continue;
+        }
+
+        const float inverse = slabInverse(d);
+        float t1 = (low - o) * inverse, t2 = (high - o) * inverse;
+        if (t1 > t2)
+            std::swap(t1, t2);
+
+        entry = std::max(entry, t1);
+        exit = std::min(exit, t2);
+    }
+
+    if (entry > exit)
+        return std::nullopt;
+
+    return entry;
+}
+
+/* static */ void AABB3::intersectRayBatch(Vector3 Origin, Vector3 Direction,
+                                           const AABB3 *Boxes,
+                                           std::size_t Count, float *Distances,
+                                           float MaxDistance) {
+    std::size_t i = 0;
+
+#if defined(CALCDA_SIMD_SSE2)
+    const __m128 origin[3] = {_mm_set1_ps(Origin.x), _mm_set1_ps(Origin.y),
+                              _mm_set1_ps(Origin.z)};
+    const __m128 inverse[3] = {_mm_set1_ps(slabInverse(Direction.x)),
+                               _mm_set1_ps(slabInverse(Direction.y)),
+                               _mm_set1_ps(slabInverse(Direction.z))};
+    const bool parallel[3] = {Direction.x == 0.0f, Direction.y == 0.0f,
+                              Direction.z == 0.0f};
+    const __m128 maxDistance = _mm_set1_ps(MaxDistance);
+
+    for (; i + 4 <= Count; i += 4)
+        _mm_storeu_ps(Distances + i, intersectRay4(Boxes + i, origin, inverse,
+                                                   parallel, maxDistance));
+#endif
+
+    for (; i < Count; ++i) {
+        const auto distance =
+            Boxes[i].intersectRay(Origin, Direction, MaxDistance);
+        Distances[i] = distance ? *distance : INFINITY;
+    }
+}
+
+bool AABB3::operator==(const AABB3 &Other) const {
+    return minimum == Other.minimum && maximum == Other.maximum;
+}
+
+bool AABB3::operator!=(const AABB3 &Other) const { return !(*this == Other); }
+
+std::string AABB3::toString() const {
+    std::stringstream stream;
+
+    stream << "minimum: " << minimum.toString()
+           << ", maximum: " << maximum.toString();
+
+    return stream.str();
+}
+} // namespace Calcda
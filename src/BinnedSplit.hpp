@@ -0,0 +1,58 @@
+#ifndef CALCDA_BINNEDSPLIT_H
+#define CALCDA_BINNEDSPLIT_H
+
+#include <cstddef>
+#include <limits>
+
+namespace Calcda {
+namespace Internal {
+/*
+ * Binned surface area heuristic of the bounding volume hierarchies: given the
+ * bounds and counts of the bins along the split axis, returns the first bin
+ * of the right side of the cheapest split, or 0 if every split leaves one
+ * side empty. Merge merges two bounds, and Cost is the measure of one; Total
+ * is the sum of the counts
+ */
+template <typename Bounds, std::size_t BinCount, typename MergeFunction,
+          typename CostFunction>
+std::size_t bestBinnedSplit(const Bounds (&Bins)[BinCount],
+                            const std::size_t (&Counts)[BinCount],
+                            std::size_t Total, MergeFunction Merge,
+                            CostFunction Cost) {
+    // cost of the right side of every split, swept from the right
+    float rightCost[BinCount] = {};
+    Bounds right{};
+    std::size_t rightCount = 0;
+    for (std::size_t i = BinCount - 1; i > 0; --i) {
+        if (Counts[i]) {
+            right = rightCount ? Merge(right, Bins[i]) : Bins[i];
+            rightCount += Counts[i];
+        }
+        rightCost[i] = rightCount ? Cost(right) * rightCount : 0.0f;
+    }
+
+    Bounds left{};
+    std::size_t leftCount = 0, bestSplit = 0;
+    float bestCost = std::numeric_limits<float>::infinity();
+    for (std::size_t i = 1; i < BinCount; ++i) {
+        if (Counts[i - 1]) {
+            left = leftCount ? Merge(left, Bins[i - 1]) : Bins[i - 1];
+            leftCount += Counts[i - 1];
+        }
+
+        if (leftCount == 0 || leftCount == Total)
+            continue;
+
+        const float cost = Cost(left) * leftCount + rightCost[i];
+        if (cost < bestCost) {
+            bestCost = cost;
+            bestSplit = i;
+        }
+    }
+
+    return bestSplit;
+}
+} // namespace Internal
+} // namespace Calcda
+
+#endif // !CALCDA_BINNEDSPLIT_H
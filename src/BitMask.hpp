@@ -0,0 +1,35 @@
+#ifndef CALCDA_BITMASK_H
+#define CALCDA_BITMASK_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace Calcda {
+namespace Internal {
+/*
+ * Writes the bits of Count objects to Masks, one per object and 32 per word,
+ * for the batch tests of Frustum and Circle. Block returns the bits of
+ * BlockWidth objects starting at an index, and Single the bit of one object,
+ * for the objects left over; BlockWidth divides 32, so no block spans two
+ * words
+ */
+template <std::size_t BlockWidth, typename BlockFunction,
+          typename SingleFunction>
+void writeMasks(std::size_t Count, std::uint32_t *Masks, BlockFunction Block,
+                SingleFunction Single) {
+    static_assert(32 % BlockWidth == 0, "a block must not span two words");
+
+    std::fill(Masks, Masks + (Count + 31) / 32, 0U);
+
+    std::size_t i = 0;
+    for (; i + BlockWidth <= Count; i += BlockWidth)
+        Masks[i / 32] |= static_cast<std::uint32_t>(Block(i)) << (i % 32);
+
+    for (; i < Count; ++i)
+        Masks[i / 32] |= static_cast<std::uint32_t>(Single(i)) << (i % 32);
+}
+} // namespace Internal
+} // namespace Calcda
+
+#endif // !CALCDA_BITMASK_H
@@ -0,0 +1,463 @@
+#include "BoundingVolumeHierarchy.hpp"
+
+#include "BinnedSplit.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Calcda {
+
+namespace {
+constexpr std::size_t MaxLeafSize = 4;
+constexpr std::size_t BinCount = 16;
+
+/*
+ * Past this depth the nodes are split at the median instead of the cheapest
+ * bin, which bounds the depth of the tree, so the queries can use a fixed
+ * size stack.
+ */
+constexpr unsigned MaxHeuristicDepth = 32;
+constexpr std::size_t StackSize = 64;
+
+constexpr std::size_t InlineIntersections = 8;
+
+// Only shapes with more intersections than InlineIntersections allocate
+template <typename Function>
+void forEachIntersection(const Shape &shape, Vector2 a, Vector2 b,
+                         LineType type, Function function) {
+    Vector2 points[InlineIntersections];
+    const auto count =
+        shape.intersectLine(a, b, type, points, InlineIntersections);
+
+    if (count <= InlineIntersections) {
+        for (std::size_t i = 0; i < count; ++i)
+            function(points[i]);
+        return;
+    }
+
+    for (const auto &point : shape.intersectLine(a, b, type))
+        function(point);
+}
+
+float component(Vector2 value, unsigned axis) {
+    return axis == 0 ? value.x : value.y;
+}
+
+// The 2-dimensional surface area heuristic weighs by the perimeter
+float halfPerimeter(Vector2 xymin, Vector2 xymax) {
+    const auto extent = xymax - xymin;
+    return extent.x + extent.y;
+}
+
+bool overlaps(Vector2 xymin1, Vector2 xymax1, Vector2 xymin2, Vector2 xymax2) {
+    return xymin1.x <= xymax2.x && xymin2.x <= xymax1.x &&
+           xymin1.y <= xymax2.y && xymin2.y <= xymax1.y;
+}
+
+bool contains(Vector2 xymin, Vector2 xymax, Vector2 point) {
+    return xymin.x <= point.x && point.x <= xymax.x && xymin.y <= point.y &&
+           point.y <= xymax.y;
+}
+
+struct LineQuery {
+    Vector2 origin;
+    Vector2 direction;
+    float tmin;
+    float tmax;
+
+    LineQuery(Vector2 a, Vector2 b, LineType type)
+        : origin(a), direction(b - a),
+          tmin(type == LineType::LINE ? -INFINITY : 0.0f),
+          tmax(type == LineType::SEGMENT ? 1.0f : INFINITY) {}
+
+    /*
+     * Clips the parameter range of the line to the rectangle (slab test);
+     * returns false if the line misses it.
+     */
+    bool clip(Vector2 xymin, Vector2 xymax, float &entry, float &exit) const {
+        entry = tmin;
+        exit = tmax;
+
+        for (unsigned axis = 0; axis < 2; ++axis) {
+            const float o = component(origin, axis),
+                        d = component(direction, axis),
+                        low = component(xymin, axis),
+                        high = component(xymax, axis);
+
+            if (d == 0.0f) {
+                if (o < low || o > high)
+                    return false;
+                continue;
+            }
+
+            const float inverse = 1.0f / d;
+            float t1 = (low - o) * inverse, t2 = (high - o) * inverse;
+            if (t1 > t2)
+                std::swap(t1, t2);
+
+            entry = std::max(entry, t1);
+            exit = std::min(exit, t2);
+        }
+
+        return entry <= exit;
+    }
+
+    //! Distance of the rectangle from the origin, in units of the direction
+    bool rectangleDistance(Vector2 xymin, Vector2 xymax, float &result) const {
+        float entry, exit;
+        if (!clip(xymin, xymax, entry, exit))
+            return false;
+
+        result = entry > 0.0f ? entry : (exit < 0.0f ? -exit : 0.0f);
+        return true;
+    }
+
+    float pointDistance(Vector2 point) const {
+        const float lengthSquared = direction.lengthSquared();
+        return lengthSquared == 0.0f
+                   ? 0.0f
+                   : std::abs(Vector2::dot(point - origin, direction)) /
+                         lengthSquared;
+    }
+};
+} // namespace
+
+BoundingVolumeHierarchy::BoundingVolumeHierarchy(
+    std::vector<const Shape *> Shapes)
+    : m_shapes(std::move(Shapes)) {
+    m_entries.reserve(m_shapes.size());
+
+    for (std::size_t i = 0; i < m_shapes.size(); ++i) {
+        const auto [a, b] = m_shapes[i]->getBoundingRectangle();
+        const Entry entry = {Vector2::vmin(a, b), Vector2::vmax(a, b), i};
+
+        if (std::isfinite(entry.xymin.x) && std::isfinite(entry.xymin.y) &&
+            std::isfinite(entry.xymax.x) && std::isfinite(entry.xymax.y))
+            m_entries.push_back(entry);
+        else
+            m_unbounded.push_back(entry);
+    }
+
+    if (m_entries.empty())
+        return;
+
+    m_nodes.reserve(2 * m_entries.size());
+    m_nodes.push_back({});
+    build(0, 0, m_entries.size(), 0);
+}
+
+/* private */ void BoundingVolumeHierarchy::build(std::size_t Node,
+                                                  std::size_t Begin,
+                                                  std::size_t End,
+                                                  unsigned Depth) {
+    Vector2 xymin = m_entries[Begin].xymin, xymax = m_entries[Begin].xymax;
+    Vector2 cmin = (xymin + xymax) * Vector2::scalar(0.5f), cmax = cmin;
+
+    for (std::size_t i = Begin + 1; i < End; ++i) {
+        const auto &entry = m_entries[i];
+        const auto centroid =
+            (entry.xymin + entry.xymax) * Vector2::scalar(0.5f);
+
+        xymin = Vector2::vmin(xymin, entry.xymin);
+        xymax = Vector2::vmax(xymax, entry.xymax);
+        cmin = Vector2::vmin(cmin, centroid);
+        cmax = Vector2::vmax(cmax, centroid);
+    }
+
+    m_nodes[Node].xymin = xymin;
+    m_nodes[Node].xymax = xymax;
+
+    const std::size_t count = End - Begin;
+    if (count <= MaxLeafSize) {
+        m_nodes[Node].first = static_cast<std::uint32_t>(Begin);
+        m_nodes[Node].count = static_cast<std::uint32_t>(count);
+        return;
+    }
+
+    const auto cextent = cmax - cmin;
+    const unsigned axis = cextent.x >= cextent.y ? 0 : 1;
+    const float low = component(cmin, axis),
+                extent = component(cextent, axis);
+
+    const auto centroidOf = [axis](const Entry &entry) {
+        return 0.5f * (component(entry.xymin, axis) +
+                       component(entry.xymax, axis));
+    };
+
+    std::size_t middle = Begin + count / 2;
+
+    if (extent > 0.0f && Depth < MaxHeuristicDepth) {
+        const float scale = static_cast<float>(BinCount) / extent;
+        const auto binOf = [&](const Entry &entry) {
+            const auto bin =
+                static_cast<std::size_t>((centroidOf(entry) - low) * scale);
+            return std::min(bin, BinCount - 1);
+        };
+
+        struct Bounds {
+            Vector2 xymin, xymax;
+        } bins[BinCount];
+        std::size_t binCounts[BinCount] = {};
+
+        for (std::size_t i = Begin; i < End; ++i) {
+            const auto bin = binOf(m_entries[i]);
+            const auto &entry = m_entries[i];
+
+            bins[bin].xymin = binCounts[bin]
+                                  ? Vector2::vmin(bins[bin].xymin, entry.xymin)
+                                  : entry.xymin;
+            bins[bin].xymax = binCounts[bin]
+                                  ? Vector2::vmax(bins[bin].xymax, entry.xymax)
+                                  : entry.xymax;
+            ++binCounts[bin];
+        }
+
+        const auto bestSplit = Internal::bestBinnedSplit(
+            bins, binCounts, count,
+            [](const Bounds &a, const Bounds &b) {
+                return Bounds{Vector2::vmin(a.xymin, b.xymin),
+                              Vector2::vmax(a.xymax, b.xymax)};
+            },
+            [](const Bounds &bounds) {
+                return halfPerimeter(bounds.xymin, bounds.xymax);
+            });
+
+        if (bestSplit != 0) {
+            middle = static_cast<std::size_t>(
+                std::partition(m_entries.begin() + Begin,
+                               m_entries.begin() + End,
+                               [&](const Entry &entry) {
+                                   return binOf(entry) < bestSplit;
+                               }) -
+                m_entries.begin());
+        }
+    } else if (extent > 0.0f) {
+        std::nth_element(m_entries.begin() + Begin, m_entries.begin() + middle,
+                         m_entries.begin() + End,
+                         [&](const Entry &a, const Entry &b) {
+                             return centroidOf(a) < centroidOf(b);
+                         });
+    }
+
+    const std::size_t left = m_nodes.size();
+    m_nodes.push_back({});
+    build(left, Begin, middle, Depth + 1);
+
+    const std::size_t right = m_nodes.size();
+    m_nodes.push_back({});
+    build(right, middle, End, Depth + 1);
+
+    m_nodes[Node].first = static_cast<std::uint32_t>(right);
+    m_nodes[Node].count = 0;
+}
+
+std::size_t BoundingVolumeHierarchy::size() const { return m_shapes.size(); }
+
+const Shape &BoundingVolumeHierarchy::getShape(std::size_t Index) const {
+    return *m_shapes.at(Index);
+}
+
+std::vector<std::size_t>
+BoundingVolumeHierarchy::queryPoint(Vector2 point) const {
+    std::vector<std::size_t> result;
+
+    for (const auto &entry : m_unbounded)
+        if (m_shapes[entry.shape]->isPointInside(point))
+            result.push_back(entry.shape);
+
+    if (m_nodes.empty())
+        return result;
+
+    std::uint32_t stack[StackSize];
+    std::size_t top = 0;
+    stack[top++] = 0;
+
+    while (top > 0) {
+        const std::uint32_t index = stack[--top];
+        const auto &node = m_nodes[index];
+
+        if (!contains(node.xymin, node.xymax, point))
+            continue;
+
+        if (node.count == 0) {
+            stack[top++] = index + 1;
+            stack[top++] = node.first;
+            continue;
+        }
+
+        for (std::uint32_t i = node.first; i < node.first + node.count; ++i) {
+            const auto &entry = m_entries[i];
+            if (contains(entry.xymin, entry.xymax, point) &&
+                m_shapes[entry.shape]->isPointInside(point))
+                result.push_back(entry.shape);
+        }
+    }
+
+    return result;
+}
+
+std::vector<std::size_t>
+BoundingVolumeHierarchy::queryRectangle(Vector2 xymin, Vector2 xymax) const {
+    std::vector<std::size_t> result;
+
+    for (const auto &entry : m_unbounded)
+        if (overlaps(entry.xymin, entry.xymax, xymin, xymax))
+            result.push_back(entry.shape);
+
+    if (m_nodes.empty())
+        return result;
+
+    std::uint32_t stack[StackSize];
+    std::size_t top = 0;
+    stack[top++] = 0;
+
+    while (top > 0) {
+        const std::uint32_t index = stack[--top];
+        const auto &node = m_nodes[index];
+
+        if (!overlaps(node.xymin, node.xymax, xymin, xymax))
+            continue;
+
+        if (node.count == 0) {
+            stack[top++] = index + 1;
+            stack[top++] = node.first;
+            continue;
+        }
+
+        for (std::uint32_t i = node.first; i < node.first + node.count; ++i) {
+            const auto &entry = m_entries[i];
+            if (overlaps(entry.xymin, entry.xymax, xymin, xymax))
+                result.push_back(entry.shape);
+        }
+    }
+
+    return result;
+}
+
+std::vector<BoundingVolumeHierarchy::ShapeIntersection>
+BoundingVolumeHierarchy::intersectLine(Vector2 a, Vector2 b,
+                                       LineType type) const {
+    std::vector<ShapeIntersection> result;
+
+    const auto collect = [&](std::size_t shape) {
+        forEachIntersection(*m_shapes[shape], a, b, type,
+                            [&](Vector2 point) {
+                                result.push_back({shape, point});
+                            });
+    };
+
+    for (const auto &entry : m_unbounded)
+        collect(entry.shape);
+
+    if (m_nodes.empty())
+        return result;
+
+    const LineQuery query(a, b, type);
+    float entryParameter, exitParameter;
+
+    std::uint32_t stack[StackSize];
+    std::size_t top = 0;
+    stack[top++] = 0;
+
+    while (top > 0) {
+        const std::uint32_t index = stack[--top];
+        const auto &node = m_nodes[index];
+
+        if (!query.clip(node.xymin, node.xymax, entryParameter, exitParameter))
+            continue;
+
+        if (node.count == 0) {
+            stack[top++] = index + 1;
+            stack[top++] = node.first;
+            continue;
+        }
+
+        for (std::uint32_t i = node.first; i < node.first + node.count; ++i) {
+            const auto &entry = m_entries[i];
+            if (query.clip(entry.xymin, entry.xymax, entryParameter,
+                           exitParameter))
+                collect(entry.shape);
+        }
+    }
+
+    return result;
+}
+
+std::optional<BoundingVolumeHierarchy::ShapeIntersection>
+BoundingVolumeHierarchy::intersectLineClosest(Vector2 a, Vector2 b,
+                                              LineType type) const {
+    const LineQuery query(a, b, type);
+
+    std::optional<ShapeIntersection> result;
+    float closest = INFINITY;
+
+    const auto test = [&](std::size_t shape) {
+        forEachIntersection(*m_shapes[shape], a, b, type, [&](Vector2 point) {
+            const float distance = query.pointDistance(point);
+            if (distance < closest) {
+                closest = distance;
+                result = ShapeIntersection{shape, point};
+            }
+        });
+    };
+
+    for (const auto &entry : m_unbounded)
+        test(entry.shape);
+
+    if (m_nodes.empty())
+        return result;
+
+    std::uint32_t stack[StackSize];
+    float stackDistance[StackSize];
+    std::size_t top = 0;
+
+    float distance;
+    if (!query.rectangleDistance(m_nodes[0].xymin, m_nodes[0].xymax, distance))
+        return result;
+
+    stack[top] = 0;
+    stackDistance[top++] = distance;
+
+    while (top > 0) {
+        --top;
+        if (stackDistance[top] > closest)
+            continue;
+
+        const auto &node = m_nodes[stack[top]];
+
+        if (node.count == 0) {
+            // visit the nearer child first, it may prune the other one
+            const std::uint32_t children[2] = {stack[top] + 1, node.first};
+            float distances[2];
+            bool hits[2];
+
+            for (unsigned i = 0; i < 2; ++i)
+                hits[i] = query.rectangleDistance(m_nodes[children[i]].xymin,
+                                         m_nodes[children[i]].xymax,
+                                         distances[i]);
+
+            const unsigned nearer =
+                (hits[0] && hits[1]) ? (distances[1] < distances[0] ? 1 : 0)
+                                     : (hits[0] ? 0 : 1);
+
+            for (unsigned i : {1 - nearer, nearer}) {
+                if (hits[i] && distances[i] <= closest) {
+                    stack[top] = children[i];
+                    stackDistance[top++] = distances[i];
+                }
+            }
+            continue;
+        }
+
+        for (std::uint32_t i = node.first; i < node.first + node.count; ++i) {
+            const auto &entry = m_entries[i];
+            if (query.rectangleDistance(entry.xymin, entry.xymax, distance) &&
+                distance <= closest)
+                test(entry.shape);
+        }
+    }
+
+    return result;
+}
+
+} // namespace Calcda
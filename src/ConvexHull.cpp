@@ -0,0 +1,676 @@
+#include "ConvexHull.hpp"
+#include "Predicates.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <thread>
+
+#if defined(CALCDA_SIMD_AVX) || defined(CALCDA_SIMD_SSE2)
+#include <immintrin.h>
+#endif
+
+namespace Calcda {
+
+#pragma region ConvexHull2
+
+namespace {
+// below this many points the threads cost more than they save
+constexpr std::size_t MinParallelPoints = 1 << 16;
+
+/*
+ * A plain copy of a point for sorting; the assignments of Vector2 are not
+ * inlined outside of the library sources that instantiate them
+ */
+struct Point {
+    float x;
+    float y;
+
+    // the order of the monotone chain: left to right, then bottom to top
+    inline bool operator<(const Point &other) const {
+        return x < other.x || (x == other.x && y < other.y);
+    }
+
+    inline bool operator==(const Point &other) const {
+        return x == other.x && y == other.y;
+    }
+
+    inline Vector2 toVector() const { return Vector2(x, y); }
+};
+
+inline double orientation(const Point &a, const Point &b, const Point &c) {
+    return Predicates::orient2d(a.toVector(), b.toVector(), c.toVector());
+}
+
+/*
+ * Runs Work(index, count) for every index below count, each on its own
+ * thread; the calling thread takes index 0
+ */
+template <typename Function>
+void runParallel(unsigned int Count, const Function &Work) {
+    std::vector<std::thread> threads;
+    threads.reserve(Count - 1);
+    for (unsigned int i = 1; i < Count; ++i)
+        threads.emplace_back([&Work, i, Count]() { Work(i, Count); });
+
+    Work(0, Count);
+    for (auto &thread : threads)
+        thread.join();
+}
+
+inline std::size_t partBegin(std::size_t Size, unsigned int Part,
+                             unsigned int Parts) {
+    return Size * Part / Parts;
+}
+
+/*
+ * The points with the smallest y, largest x - y, largest x, largest x + y,
+ * and so on counterclockwise; ties keep the first point
+ */
+struct Extremes {
+    Vector2 points[8];
+
+    explicit Extremes(Vector2 Point) {
+        std::fill(std::begin(points), std::end(points), Point);
+    }
+
+    inline void add(Vector2 Point) {
+        const float sum = Point.x + Point.y, difference = Point.x - Point.y;
+
+        if (Point.y < points[0].y)
+            points[0] = Point;
+        if (difference > points[1].x - points[1].y)
+            points[1] = Point;
+        if (Point.x > points[2].x)
+            points[2] = Point;
+        if (sum > points[3].x + points[3].y)
+            points[3] = Point;
+        if (Point.y > points[4].y)
+            points[4] = Point;
+        if (difference < points[5].x - points[5].y)
+            points[5] = Point;
+        if (Point.x < points[6].x)
+            points[6] = Point;
+        if (sum < points[7].x + points[7].y)
+            points[7] = Point;
+    }
+
+    inline void add(const Extremes &Other) {
+        for (const auto &point : Other.points)
+            add(point);
+    }
+};
+
+/*
+ * The octagon of the extreme points, without repeated corners; the points
+ * strictly left of each of its edges are strictly inside the hull of the
+ * corners, so they cannot be corners of the hull themselves. That holds even
+ * if rounding x + y or x - y picked a point short of the true extreme, and
+ * the octagon is not convex.
+ *
+ * The sides are tested in float, all 8 at once, with a margin far above the
+ * rounding errors instead of with orient2d: the points too close to a side
+ * to tell are kept, which is always safe. Coordinates large enough for the
+ * products to overflow turn the filter off.
+ */
+class OctagonFilter {
+  private:
+    /*
+     * Side i is the line ex * y - ey * x = c, with the inside left of it;
+     * missing sides hold every point inside
+     */
+    alignas(Internal::SimdAlignment) float m_ex[8] = {};
+    alignas(Internal::SimdAlignment) float m_ey[8] = {};
+    alignas(Internal::SimdAlignment) float m_c[8] = {-1.0f, -1.0f, -1.0f,
+                                                     -1.0f, -1.0f, -1.0f,
+                                                     -1.0f, -1.0f};
+    alignas(Internal::SimdAlignment) float m_margin[8] = {};
+    bool m_empty = true;
+
+  public:
+    explicit OctagonFilter(const Extremes &Extremes) {
+        Vector2 corners[8];
+        std::size_t count = 0;
+        for (const auto &point : Extremes.points)
+            if (count == 0 || corners[count - 1] != point)
+                corners[count++] = point;
+
+        while (count > 1 && corners[count - 1] == corners[0])
+            --count;
+        if (count < 3)
+            return;
+
+        float largest = 0.0f;
+        for (std::size_t i = 0; i < count; ++i)
+            largest = std::max({largest, std::abs(corners[i].x),
+                                std::abs(corners[i].y)});
+
+        for (std::size_t i = 0, j = count - 1; i < count; j = i++) {
+            const double ex = static_cast<double>(corners[i].x) - corners[j].x,
+                         ey = static_cast<double>(corners[i].y) - corners[j].y;
+            const double c = ex * corners[j].y - ey * corners[j].x;
+            const double magnitude =
+                (std::abs(ex) + std::abs(ey)) * largest + std::abs(c);
+            if (magnitude > 1e-3 * std::numeric_limits<float>::max())
+                return;
+
+            m_ex[i] = static_cast<float>(ex);
+            m_ey[i] = static_cast<float>(ey);
+            m_c[i] = static_cast<float>(c);
+            m_margin[i] = static_cast<float>(1e-5 * magnitude);
+        }
+
+        m_empty = false;
+    }
+
+    //! @brief Whether the point is certainly strictly inside the octagon
+    inline bool contains(Vector2 Point) const {
+        if (m_empty)
+            return false;
+
+#if defined(CALCDA_SIMD_AVX)
+        const __m256 x = _mm256_set1_ps(Point.x), y = _mm256_set1_ps(Point.y);
+        const __m256 side = _mm256_sub_ps(
+            _mm256_sub_ps(_mm256_mul_ps(_mm256_load_ps(m_ex), y),
+                          _mm256_mul_ps(_mm256_load_ps(m_ey), x)),
+            _mm256_load_ps(m_c));
+
+        return _mm256_movemask_ps(_mm256_cmp_ps(
+                   side, _mm256_load_ps(m_margin), _CMP_GT_OQ)) == 0xFF;
+#elif defined(CALCDA_SIMD_SSE2)
+        const __m128 x = _mm_set1_ps(Point.x), y = _mm_set1_ps(Point.y);
+        const __m128 low = _mm_sub_ps(
+                         _mm_sub_ps(_mm_mul_ps(_mm_load_ps(m_ex), y),
+                                    _mm_mul_ps(_mm_load_ps(m_ey), x)),
+                         _mm_load_ps(m_c)),
+                     high = _mm_sub_ps(
+                         _mm_sub_ps(_mm_mul_ps(_mm_load_ps(m_ex + 4), y),
+                                    _mm_mul_ps(_mm_load_ps(m_ey + 4), x)),
+                         _mm_load_ps(m_c + 4));
+
+        return _mm_movemask_ps(_mm_and_ps(
+                   _mm_cmpgt_ps(low, _mm_load_ps(m_margin)),
+                   _mm_cmpgt_ps(high, _mm_load_ps(m_margin + 4)))) == 0xF;
+#else
+        bool inside = true;
+        for (std::size_t i = 0; i < 8; ++i)
+            inside &= m_ex[i] * Point.y - m_ey[i] * Point.x - m_c[i] >
+                      m_margin[i];
+
+        return inside;
+#endif
+    }
+};
+
+/*
+ * Sorts every part on its own thread, then merges neighbouring parts in
+ * rounds, the merges of a round in parallel
+ */
+void sortParallel(std::vector<Point> &Points, unsigned int Threads) {
+    const std::size_t size = Points.size();
+
+    runParallel(Threads, [&](unsigned int part, unsigned int parts) {
+        std::sort(Points.begin() + partBegin(size, part, parts),
+                  Points.begin() + partBegin(size, part + 1, parts));
+    });
+
+    for (unsigned int width = 1; width < Threads; width *= 2) {
+        const unsigned int merges = (Threads + 2 * width - 1) / (2 * width);
+
+        runParallel(merges, [&](unsigned int merge, unsigned int) {
+            const unsigned int first = 2 * width * merge;
+            const unsigned int middle = std::min(first + width, Threads),
+                               last = std::min(first + 2 * width, Threads);
+
+            std::inplace_merge(Points.begin() + partBegin(size, first, Threads),
+                               Points.begin() +
+                                   partBegin(size, middle, Threads),
+                               Points.begin() + partBegin(size, last, Threads));
+        });
+    }
+}
+
+// Andrew's monotone chain over sorted points without repeats
+std::vector<Vector2> monotoneChain(const std::vector<Point> &Points) {
+    std::vector<Point> hull(2 * Points.size());
+    std::size_t size = 0;
+
+    // the lower hull left to right, then the upper one back
+    for (std::size_t i = 0; i < Points.size(); ++i) {
+        while (size >= 2 &&
+               orientation(hull[size - 2], hull[size - 1], Points[i]) <= 0.0)
+            --size;
+        hull[size++] = Points[i];
+    }
+
+    for (std::size_t i = Points.size() - 1, lower = size + 1; i-- > 0;) {
+        while (size >= lower &&
+               orientation(hull[size - 2], hull[size - 1], Points[i]) <= 0.0)
+            --size;
+        hull[size++] = Points[i];
+    }
+
+    // the upper hull ends on the first point again
+    if (Points.size() > 1)
+        --size;
+
+    std::vector<Vector2> result;
+    result.reserve(size);
+    for (std::size_t i = 0; i < size; ++i)
+        result.emplace_back(hull[i].x, hull[i].y);
+    return result;
+}
+} // namespace
+
+Polygon computeConvexHull(const Vector2 *Points, std::size_t Count,
+                          unsigned int Threads) {
+    if (Count == 0)
+        return Polygon(std::vector<Vector2>());
+
+    if (Threads == 0)
+        Threads = std::max(1U, std::thread::hardware_concurrency());
+    if (Count < MinParallelPoints)
+        Threads = 1;
+
+    std::vector<Extremes> extremes(Threads, Extremes(Points[0]));
+    runParallel(Threads, [&](unsigned int part, unsigned int parts) {
+        for (std::size_t i = partBegin(Count, part, parts),
+                         end = partBegin(Count, part + 1, parts);
+             i < end; ++i)
+            extremes[part].add(Points[i]);
+    });
+
+    for (unsigned int i = 1; i < Threads; ++i)
+        extremes[0].add(extremes[i]);
+
+    const OctagonFilter octagon(extremes[0]);
+
+    // the points outside the octagon, each part kept by its own thread
+    std::vector<std::vector<Point>> kept(Threads);
+    runParallel(Threads, [&](unsigned int part, unsigned int parts) {
+        for (std::size_t i = partBegin(Count, part, parts),
+                         end = partBegin(Count, part + 1, parts);
+             i < end; ++i)
+            if (!octagon.contains(Points[i]))
+                kept[part].push_back({Points[i].x, Points[i].y});
+    });
+
+    std::vector<Point> candidates = std::move(kept[0]);
+    for (unsigned int i = 1; i < Threads; ++i)
+        candidates.insert(candidates.end(), kept[i].begin(), kept[i].end());
+
+    if (candidates.size() < MinParallelPoints)
+        Threads = 1;
+    sortParallel(candidates, Threads);
+    candidates.erase(std::unique(candidates.begin(), candidates.end()),
+                     candidates.end());
+
+    return Polygon(monotoneChain(candidates));
+}
+
+Polygon computeConvexHull(const std::vector<Vector2> &Points,
+                          unsigned int Threads) {
+    return computeConvexHull(Points.data(), Points.size(), Threads);
+}
+
+// ConvexHull2
+#pragma endregion
+
+#pragma region ConvexHull3
+
+namespace {
+//! Index of no face, or of a point that is not a vertex of the hull yet
+constexpr std::uint32_t NoIndex = std::numeric_limits<std::uint32_t>::max();
+
+struct Point3 {
+    double x;
+    double y;
+    double z;
+
+    Point3(double X, double Y, double Z) : x(X), y(Y), z(Z) {}
+    Point3(const Vector3 &Point) : x(Point.x), y(Point.y), z(Point.z) {}
+
+    inline Point3 operator-(const Point3 &other) const {
+        return {x - other.x, y - other.y, z - other.z};
+    }
+
+    inline double dot(const Point3 &other) const {
+        return x * other.x + y * other.y + z * other.z;
+    }
+
+    inline Point3 cross(const Point3 &other) const {
+        return {y * other.z - z * other.y, z * other.x - x * other.z,
+                x * other.y - y * other.x};
+    }
+};
+
+struct HullFace {
+    //! @brief Counterclockwise seen from outside
+    std::uint32_t vertices[3];
+
+    //! @brief The face across the edge from vertices[i] to vertices[i + 1]
+    std::uint32_t neighbours[3];
+
+    //! @brief Unit normal and distance of the plane from the origin
+    Point3 normal;
+    double offset;
+
+    //! @brief The points above the face, and the highest of them
+    std::vector<std::uint32_t> outside;
+    std::uint32_t furthest;
+    double furthestDistance;
+
+    bool alive;
+
+    //! @brief The step that last found the face visible
+    std::uint32_t visited;
+
+    HullFace(const Vector3 *Points, std::uint32_t A, std::uint32_t B,
+             std::uint32_t C)
+        : vertices{A, B, C}, neighbours{NoIndex, NoIndex, NoIndex},
+          normal(0.0, 0.0, 0.0), offset(0.0), furthest(0),
+          furthestDistance(0.0), alive(true), visited(0) {
+        const Point3 a = Points[A], b = Points[B], c = Points[C];
+        const Point3 cross = (b - a).cross(c - a);
+        const double length = std::sqrt(cross.dot(cross));
+
+        // a degenerate face keeps a zero normal, and nothing is above it
+        if (length > 0.0) {
+            normal = Point3(cross.x / length, cross.y / length,
+                            cross.z / length);
+            offset = normal.dot(Point3((a.x + b.x + c.x) / 3.0,
+                                       (a.y + b.y + c.y) / 3.0,
+                                       (a.z + b.z + c.z) / 3.0));
+        }
+    }
+
+    inline double distance(const Point3 &Point) const {
+        return normal.dot(Point) - offset;
+    }
+};
+
+/*
+ * Starts from a tetrahedron of extreme points, and gives every point outside
+ * it to a face it is above. Then, while a face has points above it, adds the
+ * highest of them: the faces it sees are replaced by a cone from the point to
+ * their boundary, the horizon, and their points are given to the new faces.
+ */
+class Quickhull {
+  private:
+    struct HorizonEdge {
+        std::uint32_t face;
+        unsigned edge;
+    };
+
+    const Vector3 *m_points;
+    std::uint32_t m_count;
+    double m_tolerance;
+
+    std::vector<HullFace> m_faces;
+    std::uint32_t m_step = 0;
+
+    // scratch space of addPoint
+    std::vector<std::uint32_t> m_visible;
+    std::vector<HorizonEdge> m_horizon;
+
+  private:
+    bool makeTetrahedron();
+    void assign(std::uint32_t Point, std::uint32_t FirstFace);
+    void findHorizon(std::uint32_t Face, std::uint32_t Eye);
+    void addPoint(std::uint32_t Face);
+
+  public:
+    Quickhull(const Vector3 *Points, std::uint32_t Count)
+        : m_points(Points), m_count(Count), m_tolerance(0.0) {}
+
+    ConvexHull3 build();
+};
+
+bool Quickhull::makeTetrahedron() {
+    // the points with the smallest and largest x, y and z
+    std::uint32_t extremes[6] = {0, 0, 0, 0, 0, 0};
+    double extent = 0.0;
+
+    for (std::uint32_t i = 0; i < m_count; ++i) {
+        const Vector3 &point = m_points[i];
+        for (unsigned axis = 0; axis < 3; ++axis) {
+            const float value = point.getData()[axis];
+            if (value < m_points[extremes[2 * axis]].getData()[axis])
+                extremes[2 * axis] = i;
+            if (value > m_points[extremes[2 * axis + 1]].getData()[axis])
+                extremes[2 * axis + 1] = i;
+        }
+    }
+
+    for (unsigned axis = 0; axis < 3; ++axis) {
+        const float smallest = m_points[extremes[2 * axis]].getData()[axis],
+                    largest = m_points[extremes[2 * axis + 1]].getData()[axis];
+        extent += std::max(std::abs(smallest), std::abs(largest));
+    }
+
+    m_tolerance = 3.0 * std::numeric_limits<float>::epsilon() * extent;
+
+    // the two extremes furthest apart
+    std::uint32_t a = 0, b = 0;
+    double longest = 0.0;
+    for (unsigned i = 0; i < 6; ++i)
+        for (unsigned j = i + 1; j < 6; ++j) {
+            const Point3 difference =
+                Point3(m_points[extremes[j]]) - Point3(m_points[extremes[i]]);
+            if (difference.dot(difference) > longest) {
+                longest = difference.dot(difference);
+                a = extremes[i];
+                b = extremes[j];
+            }
+        }
+
+    if (std::sqrt(longest) <= m_tolerance)
+        return false;
+
+    // the point furthest from their line
+    const Point3 origin = m_points[a], direction = Point3(m_points[b]) - origin;
+    std::uint32_t c = 0;
+    double widest = 0.0;
+    for (std::uint32_t i = 0; i < m_count; ++i) {
+        const Point3 cross = direction.cross(Point3(m_points[i]) - origin);
+        if (cross.dot(cross) > widest) {
+            widest = cross.dot(cross);
+            c = i;
+        }
+    }
+
+    if (std::sqrt(widest / direction.dot(direction)) <= m_tolerance)
+        return false;
+
+    // the point furthest from their plane
+    const HullFace base(m_points, a, b, c);
+    std::uint32_t d = 0;
+    double highest = 0.0;
+    for (std::uint32_t i = 0; i < m_count; ++i) {
+        const double distance = std::abs(base.distance(m_points[i]));
+        if (distance > highest) {
+            highest = distance;
+            d = i;
+        }
+    }
+
+    if (highest <= m_tolerance)
+        return false;
+
+    // the base faces away from the apex
+    if (base.distance(m_points[d]) > 0.0)
+        std::swap(b, c);
+
+    m_faces.emplace_back(m_points, a, b, c);
+    m_faces.emplace_back(m_points, b, a, d);
+    m_faces.emplace_back(m_points, c, b, d);
+    m_faces.emplace_back(m_points, a, c, d);
+
+    // every edge is shared with the face that runs it the other way
+    for (auto &face : m_faces)
+        for (unsigned edge = 0; edge < 3; ++edge)
+            for (std::uint32_t other = 0; other < m_faces.size(); ++other)
+                for (unsigned otherEdge = 0; otherEdge < 3; ++otherEdge)
+                    if (face.vertices[edge] ==
+                            m_faces[other].vertices[(otherEdge + 1) % 3] &&
+                        face.vertices[(edge + 1) % 3] ==
+                            m_faces[other].vertices[otherEdge])
+                        face.neighbours[edge] = other;
+
+    return true;
+}
+
+// gives the point to the first face from FirstFace on that it is above
+void Quickhull::assign(std::uint32_t Point, std::uint32_t FirstFace) {
+    const Point3 point = m_points[Point];
+
+    for (std::uint32_t i = FirstFace; i < m_faces.size(); ++i) {
+        HullFace &face = m_faces[i];
+        const double distance = face.distance(point);
+
+        if (distance > m_tolerance) {
+            if (face.outside.empty() || distance > face.furthestDistance) {
+                face.furthest = Point;
+                face.furthestDistance = distance;
+            }
+
+            face.outside.push_back(Point);
+            return;
+        }
+    }
+}
+
+/*
+ * Collects the faces visible from the eye, starting from Face, and the edges
+ * of the horizon in order around the eye: a depth-first search over the
+ * neighbours that crosses every edge it reaches in the order of the faces
+ */
+void Quickhull::findHorizon(std::uint32_t Face, std::uint32_t Eye) {
+    struct Frame {
+        std::uint32_t face;
+        unsigned edge;
+        unsigned remaining;
+    };
+
+    const Point3 eye = m_points[Eye];
+    std::vector<Frame> stack = {{Face, 0, 3}};
+
+    m_visible.assign(1, Face);
+    m_horizon.clear();
+    m_faces[Face].visited = m_step;
+
+    while (!stack.empty()) {
+        Frame &top = stack.back();
+        if (top.remaining == 0) {
+            stack.pop_back();
+            continue;
+        }
+
+        const std::uint32_t face = top.face;
+        const unsigned edge = top.edge;
+        top.edge = (edge + 1) % 3;
+        --top.remaining;
+
+        const std::uint32_t neighbour = m_faces[face].neighbours[edge];
+        HullFace &other = m_faces[neighbour];
+        if (other.visited == m_step)
+            continue;
+
+        if (other.distance(eye) > 0.0) {
+            other.visited = m_step;
+            m_visible.push_back(neighbour);
+
+            // continue after the edge back to the face
+            unsigned back = 0;
+            while (other.neighbours[back] != face)
+                ++back;
+            stack.push_back({neighbour, (back + 1) % 3, 2});
+        } else {
+            m_horizon.push_back({face, edge});
+        }
+    }
+}
+
+void Quickhull::addPoint(std::uint32_t Face) {
+    const std::uint32_t eye = m_faces[Face].furthest;
+
+    ++m_step;
+    findHorizon(Face, eye);
+
+    // a cone of faces from the horizon to the eye
+    const auto first = static_cast<std::uint32_t>(m_faces.size());
+    const auto count = static_cast<std::uint32_t>(m_horizon.size());
+
+    for (std::uint32_t i = 0; i < count; ++i) {
+        const HorizonEdge &edge = m_horizon[i];
+        const HullFace &visible = m_faces[edge.face];
+        const std::uint32_t a = visible.vertices[edge.edge],
+                            b = visible.vertices[(edge.edge + 1) % 3],
+                            outside = visible.neighbours[edge.edge];
+
+        HullFace &cone = m_faces.emplace_back(m_points, a, b, eye);
+        cone.neighbours[0] = outside;
+        cone.neighbours[1] = first + (i + 1) % count;
+        cone.neighbours[2] = first + (i + count - 1) % count;
+
+        for (auto &neighbour : m_faces[outside].neighbours)
+            if (neighbour == edge.face)
+                neighbour = first + i;
+    }
+
+    for (const std::uint32_t visible : m_visible) {
+        std::vector<std::uint32_t> outside;
+        outside.swap(m_faces[visible].outside);
+        m_faces[visible].alive = false;
+
+        for (const std::uint32_t point : outside)
+            if (point != eye)
+                assign(point, first);
+    }
+}
+
+ConvexHull3 Quickhull::build() {
+    if (m_count < 4 || !makeTetrahedron())
+        return {};
+
+    for (std::uint32_t i = 0; i < m_count; ++i)
+        assign(i, 0);
+
+    // the faces made by addPoint come after the current one
+    for (std::uint32_t face = 0; face < m_faces.size(); ++face)
+        if (m_faces[face].alive && !m_faces[face].outside.empty())
+            addPoint(face);
+
+    ConvexHull3 hull;
+    std::vector<std::uint32_t> remap(m_count, NoIndex);
+
+    for (const auto &face : m_faces) {
+        if (!face.alive)
+            continue;
+
+        for (const std::uint32_t vertex : face.vertices) {
+            if (remap[vertex] == NoIndex) {
+                remap[vertex] =
+                    static_cast<std::uint32_t>(hull.vertices.size());
+                hull.vertices.push_back(m_points[vertex]);
+            }
+
+            hull.indices.push_back(remap[vertex]);
+        }
+    }
+
+    return hull;
+}
+} // namespace
+
+ConvexHull3 computeConvexHull(const Vector3 *Points, std::size_t Count) {
+    return Quickhull(Points, static_cast<std::uint32_t>(Count)).build();
+}
+
+ConvexHull3 computeConvexHull(const std::vector<Vector3> &Points) {
+    return computeConvexHull(Points.data(), Points.size());
+}
+
+// ConvexHull3
+#pragma endregion
+} // namespace Calcda
@@ -0,0 +1,250 @@
+#include "Frustum.hpp"
+
+#include "BitMask.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+#if defined(CALCDA_SIMD_AVX) || defined(CALCDA_SIMD_SSE2)
+#include <immintrin.h>
+#endif
+
+namespace Calcda {
+
+namespace {
+/*
+ * The batch tests run the planes over a block of objects in SIMD registers,
+ * and turn the comparisons into mask bits; the objects left over, and every
+ * object without SSE2, go through the scalar tests
+ */
+#if defined(CALCDA_SIMD_AVX)
+constexpr std::size_t BlockWidth = 8;
+#elif defined(CALCDA_SIMD_SSE2)
+constexpr std::size_t BlockWidth = 4;
+#else
+constexpr std::size_t BlockWidth = 1;
+#endif
+
+//! @brief Streams of the box corner farthest along each plane normal
+struct BoxCorners {
+    const float *x[Frustum::PlaneCount];
+    const float *y[Frustum::PlaneCount];
+    const float *z[Frustum::PlaneCount];
+};
+
+inline bool sphereVisible(const Plane *Planes, float x, float y, float z,
+                          float Radius) {
+    bool visible = true;
+    for (std::size_t i = 0; i < Frustum::PlaneCount; ++i)
+        visible &= Planes[i].normal.x * x + Planes[i].normal.y * y +
+                       Planes[i].normal.z * z + Planes[i].distance >=
+                   -Radius;
+
+    return visible;
+}
+
+inline bool boxVisible(const Plane *Planes, const BoxCorners &Corners,
+                       std::size_t Index) {
+    bool visible = true;
+    for (std::size_t i = 0; i < Frustum::PlaneCount; ++i)
+        visible &= Planes[i].normal.x * Corners.x[i][Index] +
+                       Planes[i].normal.y * Corners.y[i][Index] +
+                       Planes[i].normal.z * Corners.z[i][Index] +
+                       Planes[i].distance >=
+                   0.0f;
+
+    return visible;
+}
+
+#if defined(CALCDA_SIMD_AVX)
+inline __m256 planeDistance(const Plane &plane, __m256 x, __m256 y,
+                            __m256 z) {
+    return _mm256_add_ps(
+        _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(plane.normal.x), x),
+                      _mm256_mul_ps(_mm256_set1_ps(plane.normal.y), y)),
+        _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(plane.normal.z), z),
+                      _mm256_set1_ps(plane.distance)));
+}
+
+unsigned sphereBlock(const Plane *Planes, const float *x, const float *y,
+                     const float *z, const float *Radii) {
+    const __m256 cx = _mm256_loadu_ps(x), cy = _mm256_loadu_ps(y),
+                 cz = _mm256_loadu_ps(z);
+    const __m256 limit = _mm256_sub_ps(_mm256_setzero_ps(),
+                                       _mm256_loadu_ps(Radii));
+
+    __m256 visible = _mm256_cmp_ps(planeDistance(Planes[0], cx, cy, cz),
+                                   limit, _CMP_GE_OQ);
+    for (std::size_t i = 1; i < Frustum::PlaneCount; ++i)
+        visible = _mm256_and_ps(
+            visible, _mm256_cmp_ps(planeDistance(Planes[i], cx, cy, cz), limit,
+                                   _CMP_GE_OQ));
+
+    return static_cast<unsigned>(_mm256_movemask_ps(visible));
+}
+
+unsigned boxBlock(const Plane *Planes, const BoxCorners &Corners,
+                  std::size_t Index) {
+    __m256 visible = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+    for (std::size_t i = 0; i < Frustum::PlaneCount; ++i) {
+        const __m256 distance =
+            planeDistance(Planes[i], _mm256_loadu_ps(Corners.x[i] + Index),
+                          _mm256_loadu_ps(Corners.y[i] + Index),
+                          _mm256_loadu_ps(Corners.z[i] + Index));
+        visible = _mm256_and_ps(
+            visible,
+            _mm256_cmp_ps(distance, _mm256_setzero_ps(), _CMP_GE_OQ));
+    }
+
+    return static_cast<unsigned>(_mm256_movemask_ps(visible));
+}
+#elif defined(CALCDA_SIMD_SSE2)
+inline __m128 planeDistance(const Plane &plane, __m128 x, __m128 y, __m128 z) {
+    return _mm_add_ps(
+        _mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane.normal.x), x),
+                   _mm_mul_ps(_mm_set1_ps(plane.normal.y), y)),
+        _mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane.normal.z), z),
+                   _mm_set1_ps(plane.distance)));
+}
+
+unsigned sphereBlock(const Plane *Planes, const float *x, const float *y,
+                     const float *z, const float *Radii) {
+    const __m128 cx = _mm_loadu_ps(x), cy = _mm_loadu_ps(y),
+                 cz = _mm_loadu_ps(z);
+    const __m128 limit = _mm_sub_ps(_mm_setzero_ps(), _mm_loadu_ps(Radii));
+
+    __m128 visible = _mm_cmpge_ps(planeDistance(Planes[0], cx, cy, cz), limit);
+    for (std::size_t i = 1; i < Frustum::PlaneCount; ++i)
+        visible = _mm_and_ps(
+            visible, _mm_cmpge_ps(planeDistance(Planes[i], cx, cy, cz), limit));
+
+    return static_cast<unsigned>(_mm_movemask_ps(visible));
+}
+
+unsigned boxBlock(const Plane *Planes, const BoxCorners &Corners,
+                  std::size_t Index) {
+    __m128 visible = _mm_castsi128_ps(_mm_set1_epi32(-1));
+    for (std::size_t i = 0; i < Frustum::PlaneCount; ++i) {
+        const __m128 distance =
+            planeDistance(Planes[i], _mm_loadu_ps(Corners.x[i] + Index),
+                          _mm_loadu_ps(Corners.y[i] + Index),
+                          _mm_loadu_ps(Corners.z[i] + Index));
+        visible = _mm_and_ps(visible, _mm_cmpge_ps(distance, _mm_setzero_ps()));
+    }
+
+    return static_cast<unsigned>(_mm_movemask_ps(visible));
+}
+#else
+unsigned sphereBlock(const Plane *Planes, const float *x, const float *y,
+                     const float *z, const float *Radii) {
+    return sphereVisible(Planes, *x, *y, *z, *Radii);
+}
+
+unsigned boxBlock(const Plane *Planes, const BoxCorners &Corners,
+                  std::size_t Index) {
+    return boxVisible(Planes, Corners, Index);
+}
+#endif
+} // namespace
+
+#pragma region Plane
+
+float Plane::signedDistance(Vector3 Point) const {
+    return normal.x * Point.x + normal.y * Point.y + normal.z * Point.z +
+           distance;
+}
+
+std::string Plane::toString() const {
+    std::stringstream stream;
+
+    stream << "normal: " << normal.toString() << ", distance: " << distance;
+
+    return stream.str();
+}
+
+#pragma endregion
+
+#pragma region Frustum
+
+Frustum::Frustum(const Matrix4 &ViewProjection) {
+    const auto &m = ViewProjection.value.matrix;
+
+    // -w <= x, y, z <= w: the sums and differences of the last row and the
+    // others are the planes
+    for (std::size_t i = 0; i < PlaneCount; ++i) {
+        const std::size_t row = i / 2;
+        const float sign = (i % 2 == 0) ? 1.0f : -1.0f;
+
+        const float x = m[3][0] + sign * m[row][0],
+                    y = m[3][1] + sign * m[row][1],
+                    z = m[3][2] + sign * m[row][2],
+                    w = m[3][3] + sign * m[row][3];
+        const float scale = 1.0f / std::sqrt(x * x + y * y + z * z);
+
+        m_planes[i] = {Vector3(x * scale, y * scale, z * scale), w * scale};
+    }
+}
+
+const Plane &Frustum::getPlane(std::size_t Index) const {
+    return m_planes[Index];
+}
+
+bool Frustum::containsPoint(Vector3 Point) const {
+    return sphereVisible(m_planes, Point.x, Point.y, Point.z, 0.0f);
+}
+
+bool Frustum::intersectsSphere(Vector3 Center, float Radius) const {
+    return sphereVisible(m_planes, Center.x, Center.y, Center.z, Radius);
+}
+
+bool Frustum::intersectsBox(Vector3 Min, Vector3 Max) const {
+    for (const auto &plane : m_planes) {
+        const Vector3 corner(plane.normal.x >= 0.0f ? Max.x : Min.x,
+                             plane.normal.y >= 0.0f ? Max.y : Min.y,
+                             plane.normal.z >= 0.0f ? Max.z : Min.z);
+        if (plane.signedDistance(corner) < 0.0f)
+            return false;
+    }
+
+    return true;
+}
+
+void Frustum::intersectsSpheres(const Vector3SoA &Centers, const float *Radii,
+                                std::uint32_t *Masks) const {
+    const float *x = Centers.x.data(), *y = Centers.y.data(),
+                *z = Centers.z.data();
+
+    Internal::writeMasks<BlockWidth>(
+        Centers.size(), Masks,
+        [&](std::size_t Index) {
+            return sphereBlock(m_planes, x + Index, y + Index, z + Index,
+                               Radii + Index);
+        },
+        [&](std::size_t Index) {
+            return sphereVisible(m_planes, x[Index], y[Index], z[Index],
+                                 Radii[Index]);
+        });
+}
+
+void Frustum::intersectsBoxes(const Vector3SoA &Mins, const Vector3SoA &Maxs,
+                              std::uint32_t *Masks) const {
+    // the corner is the same for every box, so it picks streams, not values
+    BoxCorners corners;
+    for (std::size_t i = 0; i < PlaneCount; ++i) {
+        const auto &normal = m_planes[i].normal;
+        corners.x[i] = (normal.x >= 0.0f ? Maxs.x : Mins.x).data();
+        corners.y[i] = (normal.y >= 0.0f ? Maxs.y : Mins.y).data();
+        corners.z[i] = (normal.z >= 0.0f ? Maxs.z : Mins.z).data();
+    }
+
+    Internal::writeMasks<BlockWidth>(
+        Mins.size(), Masks,
+        [&](std::size_t Index) { return boxBlock(m_planes, corners, Index); },
+        [&](std::size_t Index) {
+            return boxVisible(m_planes, corners, Index);
+        });
+}
+
+#pragma endregion
+} // namespace Calcda
@@ -1,9 +1,19 @@
 #include "Geometry.hpp"
+#include "Predicates.hpp"
+
+#include "BitMask.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <limits>
 #include <numeric>
-#include <unordered_set>
+#include <thread>
+#include <utility>
+
+#if defined(CALCDA_SIMD_AVX) || defined(CALCDA_SIMD_SSE2)
+#include <immintrin.h>
+#endif
 
 namespace Calcda {
 
@@ -40,17 +50,35 @@ bool Shape::doesLineIntersectBoundingRectangle(Vector2 a, Vector2 b,
     return false;
 };
 
+/* virtual */ std::size_t Shape::intersectLine(Vector2 a, Vector2 b,
+                                               LineType type, Vector2 *Out,
+                                               std::size_t Capacity) const {
+    const auto result = intersectLine(a, b, type);
+    std::copy_n(result.begin(), std::min(result.size(), Capacity), Out);
+
+    return result.size();
+}
+
 #pragma region Line
 
 Line::Line(Vector2 begin, Vector2 end, LineType type)
-    : Shape(), m_begin(begin), m_end(end), m_type(type) {
-    if (begin.lengthSquared() <= end.lengthSquared()) {
-        m_xymin = begin;
-        m_xymax = end;
-    } else {
-        m_xymin = end;
-        m_xymax = begin;
-    }
+    : Shape(Vector2::vmin(begin, end), Vector2::vmax(begin, end)),
+      m_begin(begin), m_end(end), m_type(type) {
+    if (type == LineType::SEGMENT)
+        return;
+
+    // rays are unbounded past the end point, lines in both directions
+    const auto direction = end - begin;
+    const float infinity = std::numeric_limits<float>::infinity();
+
+    if (direction.x > 0.0f || (type == LineType::LINE && direction.x != 0.0f))
+        m_xymax.x = infinity;
+    if (direction.x < 0.0f || (type == LineType::LINE && direction.x != 0.0f))
+        m_xymin.x = -infinity;
+    if (direction.y > 0.0f || (type == LineType::LINE && direction.y != 0.0f))
+        m_xymax.y = infinity;
+    if (direction.y < 0.0f || (type == LineType::LINE && direction.y != 0.0f))
+        m_xymin.y = -infinity;
 }
 
 std::tuple<Vector2, Vector2> Line::getPoints() const {
@@ -62,6 +90,10 @@ std::tuple<Vector2, Vector2> Line::getPoints() const {
     if (!isPointInsideBoundingRectangle(point))
         return false;
 
+#if defined(CALCDA_ROBUST_PREDICATES)
+    // inside the rectangle, a point on the line is on the ray or segment too
+    return Predicates::orient2d(m_begin, m_end, point) == 0.0;
+#else
     const auto direction = m_end - m_begin;
 
     if (direction.x == 0.0f)
@@ -70,56 +102,140 @@ std::tuple<Vector2, Vector2> Line::getPoints() const {
     const float slope = direction.y / direction.x;
 
     return (slope * (point.x - m_begin.x) + m_begin.y) == point.y;
+#endif
 }
 
 /* virtual */ std::vector<Vector2>
 Line::intersectLine(Vector2 a, Vector2 b, LineType type) const /* final */
+{
+    Vector2 result[MaxIntersections];
+    const auto count = intersectLine(a, b, type, result, MaxIntersections);
+
+    return std::vector<Vector2>(result, result + count);
+}
+
+/* virtual */ std::size_t
+Line::intersectLine(Vector2 a, Vector2 b, LineType type, Vector2 *Out,
+                    std::size_t Capacity) const /* final */
 {
     const auto intersectResult =
         intersectRaw(m_begin, m_end, m_type, a, b, type);
-    return intersectResult.has_value() ? std::vector<Vector2>{*intersectResult}
-                                       : std::vector<Vector2>{};
+    if (!intersectResult.has_value())
+        return 0;
+
+    if (Capacity > 0)
+        Out[0] = *intersectResult;
+
+    return 1;
 }
 
 std::vector<Vector2> Line::intersectLine(const Line &other) const {
     return intersectLine(other.m_begin, other.m_end, other.m_type);
 }
 
-using IntersectionCheckFunction = bool (*)(float, float);
-using IntersectionCheckTableEntry =
-    std::pair<std::pair<LineType, LineType>, IntersectionCheckFunction>;
-constexpr static const IntersectionCheckTableEntry IntersectionCheckTable[] = {
-    std::make_pair(std::make_pair(LineType::LINE, LineType::LINE),
-                   [](float s, float t) { return true; }),
-    std::make_pair(std::make_pair(LineType::SEGMENT, LineType::SEGMENT),
-                   [](float s, float t) {
-                       return 0.0f <= s && s <= 1.0f && 0.0f <= t && t <= 1.0f;
-                   }),
-    std::make_pair(std::make_pair(LineType::SEGMENT, LineType::RAY),
-                   [](float seg_intersect, float ray_intersect) {
-                       return 0.0f <= seg_intersect && seg_intersect <= 1.0f &&
-                              ray_intersect >= 0.0f;
-                   }),
-    std::make_pair(std::make_pair(LineType::SEGMENT, LineType::LINE),
-                   [](float s, float t) { return 0.0f <= s && s <= 1.0f; }),
-    std::make_pair(std::make_pair(LineType::RAY, LineType::RAY),
-                   [](float s, float t) { return s >= 0.0f && t >= 0.0f; }),
-    std::make_pair(std::make_pair(LineType::RAY, LineType::LINE),
-                   [](float s, float t) { return 0.0f >= s; })};
+namespace {
+/*
+ * Whether @c parameter is on a line of type @c Type; false for NaN and the
+ * infinities, which come from parallel lines
+ */
+template <LineType Type> inline bool isOnLine(float parameter) {
+    CALCDA_IF_CONSTEXPR(Type == LineType::SEGMENT) {
+        return 0.0f <= parameter && parameter <= 1.0f;
+    }
+    else CALCDA_IF_CONSTEXPR(Type == LineType::RAY) {
+        return 0.0f <= parameter && parameter < INFINITY;
+    }
+    else {
+        return std::abs(parameter) < INFINITY;
+    }
+}
 
-/* static */ std::optional<Vector2> Line::intersectRaw(Vector2 l1a, Vector2 l1b,
-                                                       LineType l1t,
-                                                       Vector2 l2a, Vector2 l2b,
-                                                       LineType l2t) {
-    /*
+#if defined(CALCDA_ROBUST_PREDICATES)
+// Whether Numerator / Denominator has the sign of the nonzero Denominator
+inline bool hasSignOf(double Numerator, double Denominator) {
+    return Denominator > 0.0 ? Numerator >= 0.0 : Numerator <= 0.0;
+}
+
+/*
+ * Exact counterpart of isOnLine, for parameter = Numerator / Denominator;
+ * Rest returns Denominator - Numerator, needed by segments only
+ */
+template <LineType Type, typename Rest>
+inline bool isOnLineExact(double Numerator, double Denominator, Rest rest) {
+    CALCDA_IF_CONSTEXPR(Type == LineType::SEGMENT) {
+        return hasSignOf(Numerator, Denominator) &&
+               hasSignOf(rest(), Denominator);
+    }
+    else CALCDA_IF_CONSTEXPR(Type == LineType::RAY) {
+        return hasSignOf(Numerator, Denominator);
+    }
+    else {
+        return true;
+    }
+}
+
+template <LineType Type> inline float clampParameter(double parameter) {
+    CALCDA_IF_CONSTEXPR(Type == LineType::SEGMENT) {
+        return static_cast<float>(std::min(std::max(parameter, 0.0), 1.0));
+    }
+    else CALCDA_IF_CONSTEXPR(Type == LineType::RAY) {
+        return static_cast<float>(std::max(parameter, 0.0));
+    }
+    else {
+        return static_cast<float>(parameter);
+    }
+}
+
+/*
+ * The parameters of the intersection on both lines, deciding parallelism
+ * and the ends of rays and segments from exact cross products; the
+ * parameters themselves are rounded, and clamped to the lines
+ */
+template <LineType FirstType, LineType SecondType>
+bool intersectExact(Vector2 l1a, Vector2 l1b, Vector2 l2a, Vector2 l2b,
+                    float &l1ratio, float &l2ratio) {
+    const double denominator = Predicates::cross2d(l1a, l1b, l2a, l2b);
+    if (denominator == 0.0) // lines are parallel
+        return false;
+
+    // most pairs of segments miss, usually already on the first one
+    const double n1 = Predicates::cross2d(l1a, l2a, l2a, l2b);
+    if (!isOnLineExact<FirstType>(n1, denominator, [&] {
+            return Predicates::cross2d(l2a, l1b, l2a, l2b);
+        }))
+        return false;
+
+    const double n2 = Predicates::cross2d(l1a, l2a, l1a, l1b);
+    if (!isOnLineExact<SecondType>(n2, denominator, [&] {
+            return Predicates::cross2d(l1a, l1b, l1a, l2b);
+        }))
+        return false;
+
+    l1ratio = clampParameter<FirstType>(n1 / denominator);
+    l2ratio = clampParameter<SecondType>(n2 / denominator);
+    return true;
+}
+#endif
+
+/*
     l1(t) = l1a + t * (l1b - l1a)
     l2(t) = l2a + t * (l2b - l2a)
 
     l1(t1) = l2(t2) ==>
     l1a + t1 * (l1a - l1b) = l2a + t2 * (l2a - l2b) // -l1a; -t * (l2a - l2b)
     t * (l1a - l1b) - t2 * (l2a - l2b) = l2a - l1a
-    */
+*/
+template <LineType FirstType, LineType SecondType>
+std::optional<Vector2> intersectTyped(Vector2 l1a, Vector2 l1b, Vector2 l2a,
+                                      Vector2 l2b) {
+#if defined(CALCDA_ROBUST_PREDICATES)
+    float l1ratio, l2ratio;
+    if (!intersectExact<FirstType, SecondType>(l1a, l1b, l2a, l2b, l1ratio,
+                                               l2ratio))
+        return std::nullopt;
 
+    return l1a - Vector2::scalar(l1ratio) * (l1a - l1b);
+#else
     const auto v1 = l1a - l1b, v2 = l2a - l2b, sd = l1a - l2a;
 
     const auto determinant =
@@ -132,30 +248,467 @@ constexpr static const IntersectionCheckTableEntry IntersectionCheckTable[] = {
     const auto l1ratio = inverseDeterminant * (sd.x * v2.y - sd.y * v2.x),
                l2ratio = inverseDeterminant * (sd.x * v1.y - sd.y * v1.x);
 
-    const auto checkEntry = std::find_if(
-        std::begin(IntersectionCheckTable), std::end(IntersectionCheckTable),
-        [l1t, l2t](const auto &entry) {
-            return (entry.first.first == l1t && entry.first.second == l2t) ||
-                   (entry.first.second == l1t && entry.first.first == l2t);
-        });
+    return isOnLine<FirstType>(l1ratio) && isOnLine<SecondType>(l2ratio)
+               ? std::optional<Vector2>(l1a - Vector2::scalar(l1ratio) * v1)
+               : std::nullopt;
+#endif
+}
 
-    if (checkEntry == std::end(IntersectionCheckTable))
-        return std::nullopt;
+using IntersectFunction = std::optional<Vector2> (*)(Vector2, Vector2, Vector2,
+                                                     Vector2);
+using IntersectBatchFunction = void (*)(const Vector2 *, std::size_t,
+                                        const Vector2 *, std::size_t,
+                                        std::vector<LineIntersection> &);
+
+// indexed by the LineType values: LINE, RAY, SEGMENT
+#define CALCDA_LINE_TYPE_TABLE(function)                                       \
+    {                                                                          \
+        {&function<LineType::LINE, LineType::LINE>,                            \
+         &function<LineType::LINE, LineType::RAY>,                             \
+         &function<LineType::LINE, LineType::SEGMENT>},                        \
+            {&function<LineType::RAY, LineType::LINE>,                         \
+             &function<LineType::RAY, LineType::RAY>,                          \
+             &function<LineType::RAY, LineType::SEGMENT>},                     \
+        {                                                                      \
+            &function<LineType::SEGMENT, LineType::LINE>,                      \
+                &function<LineType::SEGMENT, LineType::RAY>,                   \
+                &function<LineType::SEGMENT, LineType::SEGMENT>                \
+        }                                                                      \
+    }
 
-    const bool switched = checkEntry->first.first == l2t;
+constexpr IntersectFunction IntersectTable[3][3] =
+    CALCDA_LINE_TYPE_TABLE(intersectTyped);
 
-    return checkEntry->second(switched ? l2ratio : l1ratio,
-                              switched ? l1ratio : l2ratio)
-               ? std::optional<Vector2>(l1a -
-                                        Vector2::scalar(l1ratio) * (l1a - l1b))
-               : std::nullopt;
+//! Number of lines of the second batch processed at once
+constexpr std::size_t BatchBlockSize = 256;
+} // namespace
+
+/* static */ std::optional<Vector2> Line::intersectRaw(Vector2 l1a, Vector2 l1b,
+                                                       LineType l1t,
+                                                       Vector2 l2a, Vector2 l2b,
+                                                       LineType l2t) {
+    return IntersectTable[static_cast<unsigned>(l1t)]
+                         [static_cast<unsigned>(l2t)](l1a, l1b, l2a, l2b);
+}
+
+template <LineType FirstType, LineType SecondType>
+/* static */ void Line::intersectBatch(const Vector2 *First,
+                                       std::size_t FirstCount,
+                                       const Vector2 *Second,
+                                       std::size_t SecondCount,
+                                       std::vector<LineIntersection> &Out) {
+#if defined(CALCDA_ROBUST_PREDICATES)
+    // pair by pair; the filters keep most pairs in double precision
+    for (std::size_t i = 0; i < FirstCount; ++i) {
+        const auto l1a = First[2 * i], l1b = First[2 * i + 1];
+
+        for (std::size_t j = 0; j < SecondCount; ++j) {
+            float s, t;
+            if (intersectExact<FirstType, SecondType>(
+                    l1a, l1b, Second[2 * j], Second[2 * j + 1], s, t))
+                Out.push_back(
+                    {i, j, s, t, l1a - Vector2::scalar(s) * (l1a - l1b)});
+        }
+    }
+#else
+    // the second batch as streams of origins and (reversed) directions
+    std::vector<float, Internal::AlignedAllocator<float>> streams(
+        4 * SecondCount);
+    float *CALCDA_RESTRICT ax = streams.data();
+    float *CALCDA_RESTRICT ay = ax + SecondCount;
+    float *CALCDA_RESTRICT vx = ay + SecondCount;
+    float *CALCDA_RESTRICT vy = vx + SecondCount;
+
+    for (std::size_t j = 0; j < SecondCount; ++j) {
+        ax[j] = Second[2 * j].x;
+        ay[j] = Second[2 * j].y;
+        vx[j] = Second[2 * j].x - Second[2 * j + 1].x;
+        vy[j] = Second[2 * j].y - Second[2 * j + 1].y;
+    }
+
+    alignas(Internal::SimdAlignment) float s[BatchBlockSize];
+    alignas(Internal::SimdAlignment) float t[BatchBlockSize];
+
+    for (std::size_t i = 0; i < FirstCount; ++i) {
+        const auto l1a = First[2 * i], v1 = l1a - First[2 * i + 1];
+
+        for (std::size_t block = 0; block < SecondCount;
+             block += BatchBlockSize) {
+            const std::size_t count =
+                std::min(BatchBlockSize, SecondCount - block);
+
+            /*
+             * The same arithmetic as intersectTyped, without the branch:
+             * parallel lines divide by zero, and isOnLine rejects the NaN or
+             * infinite parameters
+             */
+            for (std::size_t j = 0; j < count; ++j) {
+                const float v2x = vx[block + j], v2y = vy[block + j],
+                            sdx = l1a.x - ax[block + j],
+                            sdy = l1a.y - ay[block + j];
+
+                const float determinant = v2y * v1.x - v1.y * v2x;
+                const float inverseDeterminant = 1.0f / determinant;
+
+                s[j] = inverseDeterminant * (sdx * v2y - sdy * v2x);
+                t[j] = inverseDeterminant * (sdx * v1.y - sdy * v1.x);
+            }
+
+            for (std::size_t j = 0; j < count; ++j) {
+                if (isOnLine<FirstType>(s[j]) && isOnLine<SecondType>(t[j]))
+                    Out.push_back({i, block + j, s[j], t[j],
+                                   l1a - Vector2::scalar(s[j]) * v1});
+            }
+        }
+    }
+#endif
 }
 
+#define CALCDA_INSTANTIATE_INTERSECT_BATCH(FirstType, SecondType)              \
+    template void Line::intersectBatch<FirstType, SecondType>(                 \
+        const Vector2 *, std::size_t, const Vector2 *, std::size_t,            \
+        std::vector<LineIntersection> &);
+
+CALCDA_INSTANTIATE_INTERSECT_BATCH(LineType::LINE, LineType::LINE)
+CALCDA_INSTANTIATE_INTERSECT_BATCH(LineType::LINE, LineType::RAY)
+CALCDA_INSTANTIATE_INTERSECT_BATCH(LineType::LINE, LineType::SEGMENT)
+CALCDA_INSTANTIATE_INTERSECT_BATCH(LineType::RAY, LineType::LINE)
+CALCDA_INSTANTIATE_INTERSECT_BATCH(LineType::RAY, LineType::RAY)
+CALCDA_INSTANTIATE_INTERSECT_BATCH(LineType::RAY, LineType::SEGMENT)
+CALCDA_INSTANTIATE_INTERSECT_BATCH(LineType::SEGMENT, LineType::LINE)
+CALCDA_INSTANTIATE_INTERSECT_BATCH(LineType::SEGMENT, LineType::RAY)
+CALCDA_INSTANTIATE_INTERSECT_BATCH(LineType::SEGMENT, LineType::SEGMENT)
+
+#undef CALCDA_INSTANTIATE_INTERSECT_BATCH
+
+/* static */ void Line::intersectBatch(const Vector2 *First,
+                                       std::size_t FirstCount,
+                                       LineType FirstType,
+                                       const Vector2 *Second,
+                                       std::size_t SecondCount,
+                                       LineType SecondType,
+                                       std::vector<LineIntersection> &Out) {
+    constexpr IntersectBatchFunction Table[3][3] =
+        CALCDA_LINE_TYPE_TABLE(Line::intersectBatch);
+
+    Table[static_cast<unsigned>(FirstType)][static_cast<unsigned>(
+        SecondType)](First, FirstCount, Second, SecondCount, Out);
+}
+
+#undef CALCDA_LINE_TYPE_TABLE
+
 // Line
 #pragma endregion
 
 #pragma region Circle
 
+namespace {
+/*
+ * The batch containment tests compare a block of points in SIMD registers,
+ * like the batch tests of Frustum; the points left over, and every point
+ * without SSE2, go through the scalar test
+ */
+#if defined(CALCDA_SIMD_AVX)
+constexpr std::size_t CircleBlockWidth = 8;
+#elif defined(CALCDA_SIMD_SSE2)
+constexpr std::size_t CircleBlockWidth = 4;
+#else
+constexpr std::size_t CircleBlockWidth = 1;
+#endif
+
+// points per block of the many circles test: 16 KiB of coordinates
+constexpr std::size_t CircleTileSize = 2048;
+
+struct CircleTest {
+    float x;
+    float y;
+    float radiusSquared;
+};
+
+inline bool circleContains(const CircleTest &Test, float x, float y) {
+    const float dx = x - Test.x, dy = y - Test.y;
+    return dx * dx + dy * dy < Test.radiusSquared;
+}
+
+#if defined(CALCDA_SIMD_AVX)
+inline unsigned circleBlock(const CircleTest &Test, const float *x,
+                            const float *y) {
+    const __m256 dx = _mm256_sub_ps(_mm256_loadu_ps(x), _mm256_set1_ps(Test.x));
+    const __m256 dy = _mm256_sub_ps(_mm256_loadu_ps(y), _mm256_set1_ps(Test.y));
+    const __m256 distance =
+        _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+
+    return static_cast<unsigned>(_mm256_movemask_ps(_mm256_cmp_ps(
+        distance, _mm256_set1_ps(Test.radiusSquared), _CMP_LT_OQ)));
+}
+#elif defined(CALCDA_SIMD_SSE2)
+inline unsigned circleBlock(const CircleTest &Test, const float *x,
+                            const float *y) {
+    const __m128 dx = _mm_sub_ps(_mm_loadu_ps(x), _mm_set1_ps(Test.x));
+    const __m128 dy = _mm_sub_ps(_mm_loadu_ps(y), _mm_set1_ps(Test.y));
+    const __m128 distance = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+
+    return static_cast<unsigned>(_mm_movemask_ps(
+        _mm_cmplt_ps(distance, _mm_set1_ps(Test.radiusSquared))));
+}
+#else
+inline unsigned circleBlock(const CircleTest &Test, const float *x,
+                            const float *y) {
+    return circleContains(Test, *x, *y);
+}
+#endif
+
+// Writes the bits of Count points to Masks
+void writeCircleMasks(const CircleTest &Test, const float *x, const float *y,
+                      std::size_t Count, std::uint32_t *Masks) {
+    Internal::writeMasks<CircleBlockWidth>(
+        Count, Masks,
+        [&](std::size_t Index) {
+            return circleBlock(Test, x + Index, y + Index);
+        },
+        [&](std::size_t Index) {
+            return circleContains(Test, x[Index], y[Index]);
+        });
+}
+
+// a line of the intersection tests, x + t * (dx, dy)
+struct CircleLine {
+    float x;
+    float y;
+    float dx;
+    float dy;
+    float inverseLengthSquared;
+    float lengthSquared;
+};
+
+inline CircleLine makeCircleLine(float x, float y, float dx, float dy) {
+    const float lengthSquared = dx * dx + dy * dy;
+    return {x, y, dx, dy, 1.0f / lengthSquared, lengthSquared};
+}
+
+/*
+    with f = x - center, the points of the line on the circle solve
+    |f + t * d|^2 = r^2 ==>
+    (d.d) * t^2 + 2 * (f.d) * t + (f.f - r^2) = 0 ==>
+    t = (-(f.d) -+ sqrt((f.d)^2 - (d.d) * (f.f - r^2))) / (d.d)
+
+    Both parameters are NaN if the line misses the circle, and if it is a
+    point
+*/
+inline void circleLineParameters(const CircleLine &Line, float cx, float cy,
+                                 float radius, float &entry, float &exit) {
+    const float fx = Line.x - cx, fy = Line.y - cy;
+    const float b = fx * Line.dx + fy * Line.dy;
+    const float c = (fx * fx + fy * fy) - radius * radius;
+    const float discriminant = b * b - Line.lengthSquared * c;
+
+    if (!(discriminant >= 0.0f)) {
+        entry = exit = std::numeric_limits<float>::quiet_NaN();
+        return;
+    }
+
+    const float root = std::sqrt(discriminant);
+    entry = (-b - root) * Line.inverseLengthSquared;
+    exit = (-b + root) * Line.inverseLengthSquared;
+}
+
+inline bool isOnLine(LineType Type, float parameter) {
+    switch (Type) {
+    case LineType::SEGMENT:
+        return isOnLine<LineType::SEGMENT>(parameter);
+    case LineType::RAY:
+        return isOnLine<LineType::RAY>(parameter);
+    default:
+        return isOnLine<LineType::LINE>(parameter);
+    }
+}
+
+inline Vector2 circleLinePoint(const CircleLine &Line, float parameter) {
+    return {Line.x + parameter * Line.dx, Line.y + parameter * Line.dy};
+}
+
+template <LineType Type> inline float clipParameter(float parameter) {
+    return isOnLine<Type>(parameter) ? parameter
+                                     : std::numeric_limits<float>::quiet_NaN();
+}
+
+// one circle of the batch intersection, the circles left over after blocks
+template <LineType Type>
+inline void circleLineSingle(const CircleLine &Line, float cx, float cy,
+                             float radius, float &entry, float &exit,
+                             Vector2 *entryPoint, Vector2 *exitPoint) {
+    circleLineParameters(Line, cx, cy, radius, entry, exit);
+    entry = clipParameter<Type>(entry);
+    exit = clipParameter<Type>(exit);
+
+    if (entryPoint)
+        *entryPoint = circleLinePoint(Line, entry);
+    if (exitPoint)
+        *exitPoint = circleLinePoint(Line, exit);
+}
+
+/*
+ * Writes the parameters of a block of circles, and their points unless the
+ * point pointers are null; the SIMD blocks compute the square root of
+ * negative discriminants, whose NaN the range check keeps
+ */
+#if defined(CALCDA_SIMD_AVX)
+template <LineType Type> inline __m256 clipBlock(__m256 parameter) {
+    const __m256 infinity = _mm256_set1_ps(INFINITY);
+    __m256 mask;
+
+    CALCDA_IF_CONSTEXPR(Type == LineType::SEGMENT) {
+        mask = _mm256_and_ps(
+            _mm256_cmp_ps(parameter, _mm256_setzero_ps(), _CMP_GE_OQ),
+            _mm256_cmp_ps(parameter, _mm256_set1_ps(1.0f), _CMP_LE_OQ));
+    }
+    else CALCDA_IF_CONSTEXPR(Type == LineType::RAY) {
+        mask = _mm256_and_ps(
+            _mm256_cmp_ps(parameter, _mm256_setzero_ps(), _CMP_GE_OQ),
+            _mm256_cmp_ps(parameter, infinity, _CMP_LT_OQ));
+    }
+    else {
+        mask = _mm256_and_ps(
+            _mm256_cmp_ps(parameter, _mm256_sub_ps(_mm256_setzero_ps(),
+                                                   infinity),
+                          _CMP_GT_OQ),
+            _mm256_cmp_ps(parameter, infinity, _CMP_LT_OQ));
+    }
+
+    return _mm256_blendv_ps(_mm256_set1_ps(NAN), parameter, mask);
+}
+
+// interleaves the x and y of the points into Out; unpack works per 128 bits
+inline void storePointBlock(const CircleLine &Line, __m256 parameter,
+                            Vector2 *Out) {
+    const __m256 x =
+        _mm256_add_ps(_mm256_set1_ps(Line.x),
+                      _mm256_mul_ps(parameter, _mm256_set1_ps(Line.dx)));
+    const __m256 y =
+        _mm256_add_ps(_mm256_set1_ps(Line.y),
+                      _mm256_mul_ps(parameter, _mm256_set1_ps(Line.dy)));
+    const __m256 low = _mm256_unpacklo_ps(x, y),
+                 high = _mm256_unpackhi_ps(x, y);
+
+    float *out = reinterpret_cast<float *>(Out);
+    _mm256_storeu_ps(out, _mm256_permute2f128_ps(low, high, 0x20));
+    _mm256_storeu_ps(out + 8, _mm256_permute2f128_ps(low, high, 0x31));
+}
+
+template <LineType Type>
+inline void circleLineBlock(const CircleLine &Line, const float *cx,
+                            const float *cy, const float *radius,
+                            float *entry, float *exit, Vector2 *entryPoint,
+                            Vector2 *exitPoint) {
+    const __m256 fx =
+        _mm256_sub_ps(_mm256_set1_ps(Line.x), _mm256_loadu_ps(cx));
+    const __m256 fy =
+        _mm256_sub_ps(_mm256_set1_ps(Line.y), _mm256_loadu_ps(cy));
+    const __m256 r = _mm256_loadu_ps(radius);
+
+    const __m256 b = _mm256_add_ps(_mm256_mul_ps(fx, _mm256_set1_ps(Line.dx)),
+                                   _mm256_mul_ps(fy, _mm256_set1_ps(Line.dy)));
+    const __m256 c = _mm256_sub_ps(
+        _mm256_add_ps(_mm256_mul_ps(fx, fx), _mm256_mul_ps(fy, fy)),
+        _mm256_mul_ps(r, r));
+    const __m256 root = _mm256_sqrt_ps(_mm256_sub_ps(
+        _mm256_mul_ps(b, b),
+        _mm256_mul_ps(_mm256_set1_ps(Line.lengthSquared), c)));
+
+    const __m256 minusB = _mm256_xor_ps(b, _mm256_set1_ps(-0.0f));
+    const __m256 inverse = _mm256_set1_ps(Line.inverseLengthSquared);
+
+    const __m256 entries = clipBlock<Type>(
+        _mm256_mul_ps(_mm256_sub_ps(minusB, root), inverse));
+    const __m256 exits = clipBlock<Type>(
+        _mm256_mul_ps(_mm256_add_ps(minusB, root), inverse));
+
+    _mm256_storeu_ps(entry, entries);
+    _mm256_storeu_ps(exit, exits);
+    if (entryPoint)
+        storePointBlock(Line, entries, entryPoint);
+    if (exitPoint)
+        storePointBlock(Line, exits, exitPoint);
+}
+#elif defined(CALCDA_SIMD_SSE2)
+template <LineType Type> inline __m128 clipBlock(__m128 parameter) {
+    const __m128 infinity = _mm_set1_ps(INFINITY);
+    __m128 mask;
+
+    CALCDA_IF_CONSTEXPR(Type == LineType::SEGMENT) {
+        mask = _mm_and_ps(_mm_cmpge_ps(parameter, _mm_setzero_ps()),
+                          _mm_cmple_ps(parameter, _mm_set1_ps(1.0f)));
+    }
+    else CALCDA_IF_CONSTEXPR(Type == LineType::RAY) {
+        mask = _mm_and_ps(_mm_cmpge_ps(parameter, _mm_setzero_ps()),
+                          _mm_cmplt_ps(parameter, infinity));
+    }
+    else {
+        mask = _mm_and_ps(
+            _mm_cmpgt_ps(parameter, _mm_sub_ps(_mm_setzero_ps(), infinity)),
+            _mm_cmplt_ps(parameter, infinity));
+    }
+
+    return _mm_or_ps(_mm_and_ps(mask, parameter),
+                     _mm_andnot_ps(mask, _mm_set1_ps(NAN)));
+}
+
+// interleaves the x and y of the points into Out
+inline void storePointBlock(const CircleLine &Line, __m128 parameter,
+                            Vector2 *Out) {
+    const __m128 x = _mm_add_ps(_mm_set1_ps(Line.x),
+                                _mm_mul_ps(parameter, _mm_set1_ps(Line.dx)));
+    const __m128 y = _mm_add_ps(_mm_set1_ps(Line.y),
+                                _mm_mul_ps(parameter, _mm_set1_ps(Line.dy)));
+
+    float *out = reinterpret_cast<float *>(Out);
+    _mm_storeu_ps(out, _mm_unpacklo_ps(x, y));
+    _mm_storeu_ps(out + 4, _mm_unpackhi_ps(x, y));
+}
+
+template <LineType Type>
+inline void circleLineBlock(const CircleLine &Line, const float *cx,
+                            const float *cy, const float *radius,
+                            float *entry, float *exit, Vector2 *entryPoint,
+                            Vector2 *exitPoint) {
+    const __m128 fx = _mm_sub_ps(_mm_set1_ps(Line.x), _mm_loadu_ps(cx));
+    const __m128 fy = _mm_sub_ps(_mm_set1_ps(Line.y), _mm_loadu_ps(cy));
+    const __m128 r = _mm_loadu_ps(radius);
+
+    const __m128 b = _mm_add_ps(_mm_mul_ps(fx, _mm_set1_ps(Line.dx)),
+                                _mm_mul_ps(fy, _mm_set1_ps(Line.dy)));
+    const __m128 c = _mm_sub_ps(
+        _mm_add_ps(_mm_mul_ps(fx, fx), _mm_mul_ps(fy, fy)), _mm_mul_ps(r, r));
+    const __m128 root = _mm_sqrt_ps(_mm_sub_ps(
+        _mm_mul_ps(b, b), _mm_mul_ps(_mm_set1_ps(Line.lengthSquared), c)));
+
+    const __m128 minusB = _mm_xor_ps(b, _mm_set1_ps(-0.0f));
+    const __m128 inverse = _mm_set1_ps(Line.inverseLengthSquared);
+
+    const __m128 entries =
+        clipBlock<Type>(_mm_mul_ps(_mm_sub_ps(minusB, root), inverse));
+    const __m128 exits =
+        clipBlock<Type>(_mm_mul_ps(_mm_add_ps(minusB, root), inverse));
+
+    _mm_storeu_ps(entry, entries);
+    _mm_storeu_ps(exit, exits);
+    if (entryPoint)
+        storePointBlock(Line, entries, entryPoint);
+    if (exitPoint)
+        storePointBlock(Line, exits, exitPoint);
+}
+#else
+template <LineType Type>
+inline void circleLineBlock(const CircleLine &Line, const float *cx,
+                            const float *cy, const float *radius,
+                            float *entry, float *exit, Vector2 *entryPoint,
+                            Vector2 *exitPoint) {
+    circleLineSingle<Type>(Line, *cx, *cy, *radius, *entry, *exit, entryPoint,
+                           exitPoint);
+}
+#endif
+} // namespace
+
 Circle::Circle(Vector2 origin, float radius)
     : Shape(origin - Vector2::scalar(radius), origin + Vector2::scalar(radius)),
       m_origin(origin), m_radius(radius) {}
@@ -166,104 +719,300 @@ float Circle::getRadius() const { return m_radius; }
 
 /* virtual */ bool Circle::isPointInside(Vector2 point) const /* final */
 {
-    return (m_origin - point).absolute().lengthSquared() <
-           (m_radius * m_radius);
-}
-
-/**
- * @brief Returns the intersection points of a line and the circle
- * \f[
-        m=\frac{B_x-A_x}{B_y-A_y} \\
-        g(x)=x-O_x \\
-        b(x)=m*x - m*B_x + B_y \\
-        q(x)=g(x)^2 + (b(x)-O_y)^2 - r^2 \\
-        \Longrightarrow \\
-        q(x)=(x-O_x)^2 + ((m*x-m*B_x+B_y)-O_y)^2 - r^2 \\\\
-        q(x)=(x^2 - 2*x*O_x + O_x^2) + (m*x - m*B_x + B_y - O_y)^2 - r^2 \\
-        q(x)=(1x^2-2O_x*x+O_x^2)+(m*x + (B_y - m*B_x - O_y))^2 - r^2 \\
-        q(x)=... + ((m*x)^2 + 2(B_y - m*B_x - O_y)*m*x + (B_y - m*B_x - O_y)^2)
- - r^2 \\
-        q(x)=1x^2 -2O_x*x +O_x^2 + m^2*x^2 + 2(B_y - m*B_x - O_y)*m*x + (B_y -
- m*B_x - O_y)^2 - r^2 \\
-        q(x)=(1+m^2)x^2+(-2O_x+2(B_y - m*B_x - O_y)*m)x+(O_x^2+(B_y - m*B_x -
- O_y)^2-r^2) \\
-        q(x)=(1+m^2)x^2+2(-O_x+(B_y - m*B_x - O_y)*m)x+(O_x^2+(B_y - m*B_x -
- O_y)^2-r^2) \\
-        \Longrightarrow \\
-        q(x)=a*x^2 + b*x + c
- * \f]
- */
+    return circleContains({m_origin.x, m_origin.y, m_radius * m_radius},
+                          point.x, point.y);
+}
+
+void Circle::containsPoints(const Vector2SoA &Points,
+                            std::uint32_t *Masks) const {
+    writeCircleMasks({m_origin.x, m_origin.y, m_radius * m_radius},
+                     Points.x.data(), Points.y.data(), Points.size(), Masks);
+}
+
+void Circle::containsPoints(const Vector2SoA &Points,
+                            std::vector<std::size_t> &Out) const {
+    const CircleTest test = {m_origin.x, m_origin.y, m_radius * m_radius};
+    const float *x = Points.x.data(), *y = Points.y.data();
+    const std::size_t count = Points.size();
+
+    std::size_t i = 0;
+    for (; i + CircleBlockWidth <= count; i += CircleBlockWidth) {
+        const unsigned bits = circleBlock(test, x + i, y + i);
+        if (bits == 0)
+            continue;
+
+        for (std::size_t lane = 0; lane < CircleBlockWidth; ++lane)
+            if ((bits >> lane) & 1U)
+                Out.push_back(i + lane);
+    }
+
+    for (; i < count; ++i)
+        if (circleContains(test, x[i], y[i]))
+            Out.push_back(i);
+}
+
+/* static */ void Circle::containsPoints(const Circle *Circles,
+                                         std::size_t Count,
+                                         const Vector2SoA &Points,
+                                         std::uint32_t *Masks) {
+    const float *x = Points.x.data(), *y = Points.y.data();
+    const std::size_t pointCount = Points.size(),
+                      words = (pointCount + 31) / 32;
+
+    // the tiles are whole mask words, so every circle writes its words of
+    // the tile in one go
+    for (std::size_t begin = 0; begin < pointCount; begin += CircleTileSize) {
+        const std::size_t size = std::min(CircleTileSize, pointCount - begin);
+
+        for (std::size_t circle = 0; circle < Count; ++circle) {
+            const Circle &shape = Circles[circle];
+            writeCircleMasks({shape.m_origin.x, shape.m_origin.y,
+                              shape.m_radius * shape.m_radius},
+                             x + begin, y + begin, size,
+                             Masks + circle * words + begin / 32);
+        }
+    }
+}
+
+template <LineType Type>
+/* static */ void
+Circle::intersectLines(const Vector2SoA &Origins, const Vector2SoA &Directions,
+                       const Vector2SoA &Centers, const float *Radii,
+                       float *Entries, float *Exits, Vector2 *EntryPoints,
+                       Vector2 *ExitPoints) {
+    const float *cx = Centers.x.data(), *cy = Centers.y.data();
+    const std::size_t count = Centers.size();
+
+    for (std::size_t line = 0; line < Origins.size(); ++line) {
+        const CircleLine test =
+            makeCircleLine(Origins.x[line], Origins.y[line],
+                           Directions.x[line], Directions.y[line]);
+        const std::size_t row = line * count;
+        Vector2 *entryPoints = EntryPoints ? EntryPoints + row : nullptr,
+                *exitPoints = ExitPoints ? ExitPoints + row : nullptr;
+
+        std::size_t i = 0;
+        for (; i + CircleBlockWidth <= count; i += CircleBlockWidth)
+            circleLineBlock<Type>(test, cx + i, cy + i, Radii + i,
+                                  Entries + row + i, Exits + row + i,
+                                  entryPoints ? entryPoints + i : nullptr,
+                                  exitPoints ? exitPoints + i : nullptr);
+
+        for (; i < count; ++i)
+            circleLineSingle<Type>(test, cx[i], cy[i], Radii[i],
+                                   Entries[row + i], Exits[row + i],
+                                   entryPoints ? entryPoints + i : nullptr,
+                                   exitPoints ? exitPoints + i : nullptr);
+    }
+}
+
+template void Circle::intersectLines<LineType::LINE>(
+    const Vector2SoA &, const Vector2SoA &, const Vector2SoA &, const float *,
+    float *, float *, Vector2 *, Vector2 *);
+template void Circle::intersectLines<LineType::RAY>(
+    const Vector2SoA &, const Vector2SoA &, const Vector2SoA &, const float *,
+    float *, float *, Vector2 *, Vector2 *);
+template void Circle::intersectLines<LineType::SEGMENT>(
+    const Vector2SoA &, const Vector2SoA &, const Vector2SoA &, const float *,
+    float *, float *, Vector2 *, Vector2 *);
+
+/* static */ void
+Circle::intersectLines(const Vector2SoA &Origins, const Vector2SoA &Directions,
+                       LineType Type, const Vector2SoA &Centers,
+                       const float *Radii, float *Entries, float *Exits,
+                       Vector2 *EntryPoints, Vector2 *ExitPoints) {
+    switch (Type) {
+    case LineType::SEGMENT:
+        return intersectLines<LineType::SEGMENT>(Origins, Directions, Centers,
+                                                 Radii, Entries, Exits,
+                                                 EntryPoints, ExitPoints);
+    case LineType::RAY:
+        return intersectLines<LineType::RAY>(Origins, Directions, Centers,
+                                             Radii, Entries, Exits,
+                                             EntryPoints, ExitPoints);
+    default:
+        return intersectLines<LineType::LINE>(Origins, Directions, Centers,
+                                              Radii, Entries, Exits,
+                                              EntryPoints, ExitPoints);
+    }
+}
+
 std::vector<Vector2> Circle::intersectLine(Vector2 a, Vector2 b,
                                            LineType type) const {
-    const auto aInside = isPointInside(a);
-    const auto bInside = isPointInside(b);
+    Vector2 result[MaxIntersections];
+    const auto count = intersectLine(a, b, type, result, MaxIntersections);
 
-    if (a == b && aInside)
-        return {a};
-    else
-        return {};
+    return std::vector<Vector2>(result, result + count);
+}
+
+//! @note The points are ordered along the line, a tangent point once
+std::size_t Circle::intersectLine(Vector2 a, Vector2 b, LineType type,
+                                  Vector2 *Out, std::size_t Capacity) const {
+    std::size_t count = 0;
+    const auto write = [&](Vector2 point) {
+        if (count < Capacity)
+            Out[count] = point;
+        ++count;
+    };
 
-    if (aInside && bInside)
-        return {a, b};
-    else if (aInside)
-        return {a};
-    else if (bInside)
-        return {b};
+    const auto direction = b - a;
+    const CircleLine line = makeCircleLine(a.x, a.y, direction.x, direction.y);
 
-    const auto bavector = b - a;
-    const auto to = bavector.y != 0 ? m_origin : m_origin.yx(),
-               ta = bavector.y != 0 ? a : a.yx(),
-               tb = bavector.y != 0 ? b : b.yx();
-    const float m = bavector.y != 0 ? (bavector.x) / (bavector.y) : 0.0f;
+    float entry, exit;
+    circleLineParameters(line, m_origin.x, m_origin.y, m_radius, entry, exit);
 
-    const float qa = 1.0f + std::pow(m, 2),
-                qb = 2.0f * (-to.x + m * (tb.y - to.y - tb.x * m)),
-                qc = std::pow(to.x, 2.0f) +
-                     std::pow(tb.y - to.y - tb.x * m, 2.0f) -
-                     std::pow(m_radius, 2.0f);
+    if (isOnLine(type, entry))
+        write(a + Vector2::scalar(entry) * direction);
+    if (exit != entry && isOnLine(type, exit))
+        write(a + Vector2::scalar(exit) * direction);
+
+    return count;
+}
+
+// Circle
+#pragma endregion
 
-    const float determinant = std::pow(qb, 2.0f) - 4.0f * qa * qc;
+#pragma region Polygon
+
+namespace {
+//! Parameter of @c point along the line from @c a to @c b
+float lineParameter(Vector2 a, Vector2 b, Vector2 point) {
+    const auto direction = b - a;
+    const float lengthSquared = direction.lengthSquared();
+
+    return lengthSquared == 0.0f
+               ? 0.0f
+               : Vector2::dot(point - a, direction) / lengthSquared;
+}
+
+/*
+ * The queries of Polygon and PolygonView, on the points of either; the
+ * polygon is closed by the edge from the last point to the first
+ */
+std::tuple<Vector2, Vector2> polygonBounds(PointSpan Points) {
+    if (Points.empty())
+        return {Vector2::Zero, Vector2::Zero};
+
+    // one pass without branches, unlike two std::minmax_element
+    float xmin = Points[0].x, ymin = Points[0].y, xmax = xmin, ymax = ymin;
+    for (const auto &point : Points) {
+        xmin = std::min(xmin, point.x);
+        ymin = std::min(ymin, point.y);
+        xmax = std::max(xmax, point.x);
+        ymax = std::max(ymax, point.y);
+    }
+
+    return {{xmin, ymin}, {xmax, ymax}};
+}
 
-    if (determinant < 0.0f)
+std::vector<Polygon::EdgeIntersection>
+polygonIntersectLineEx(PointSpan Points, Vector2 a, Vector2 b, LineType type) {
+    if (Points.size() <= 1)
         return {};
 
-    if (determinant == 0.0f) {
-        const float x = (-std::pow(qb, 2.0f)) / (2.0f * qa);
-        const auto y = m * x - tb.x * m + b.y;
+    std::vector<Polygon::EdgeIntersection> result;
+
+    Vector2 x = Points.back(), y;
+    for (std::size_t i = 0; i < Points.size(); ++i) {
+        y = Points[i];
+
+        const auto intersection =
+            Line::intersectRaw(a, b, type, x, y, LineType::SEGMENT);
+
+        if (intersection)
+            result.push_back({*intersection, Line(x, y, LineType::SEGMENT)});
 
-        return {bavector.y != 0 ? Vector2{x, y} : Vector2{y, x}};
+        x = y;
     }
-    const float determinantSqrt = std::sqrt(determinant);
 
-    const float x1 = (-std::pow(qb, 2.0f) + determinantSqrt) / (2.0f * qa),
-                x2 = (-std::pow(qb, 2.0f) - determinantSqrt) / (2.0f * qa);
-    const auto y1 = m * x1 - tb.x * m + b.y, y2 = m * x2 - tb.x * m + b.y;
+    // both edges of a vertex on the line are reported, in edge order
+    std::stable_sort(result.begin(), result.end(),
+                     [a, b](const Polygon::EdgeIntersection &left,
+                            const Polygon::EdgeIntersection &right) {
+                         return lineParameter(a, b, left.intersection) <
+                                lineParameter(a, b, right.intersection);
+                     });
+    result.erase(std::unique(result.begin(), result.end()), result.end());
 
-    return {(bavector.y != 0 ? Vector2{x1, y1} : Vector2{y1, x1}),
-            (bavector.y != 0 ? Vector2{x2, y2} : Vector2{y2, x2})};
+    return result;
 }
 
-// Circle
-#pragma endregion
+std::size_t polygonIntersectLine(PointSpan Points, Vector2 a, Vector2 b,
+                                 LineType type, Vector2 *Out,
+                                 std::size_t Capacity) {
+    if (Points.size() <= 1)
+        return 0;
 
-#pragma region Polygon
+    const auto byParameter = [a, b](Vector2 left, Vector2 right) {
+        return lineParameter(a, b, left) < lineParameter(a, b, right);
+    };
 
-/* private */ void Polygon::calculateMinmax() {
-    if (m_points.empty()) {
-        m_xymin = m_xymax = Calcda::Vector2::Zero;
-        return;
+    /*
+     * A line through a vertex hits both edges sharing it; those are the only
+     * duplicates. A hit is dropped when its edge starts on the line and the
+     * previous edge was hit and ends there, which is the same vertex; the
+     * vertices are tested exactly, so hits on two close but distinct edges
+     * are kept. Edges of repeated points are skipped, and the last edge is
+     * compared with the first one.
+     */
+    std::size_t last = Points.size() - 1;
+    while (last > 0 && Points[last] == Points[last - 1])
+        --last;
+
+    std::size_t count = 0, stored = 0;
+    bool seen = false, firstAtStart = false, previousAtEnd = false;
+
+    Vector2 x = Points.back(), y;
+    for (std::size_t i = 0; i < Points.size(); ++i) {
+        y = Points[i];
+        if (x == y)
+            continue;
+
+        const auto intersection =
+            Line::intersectRaw(a, b, type, x, y, LineType::SEGMENT);
+        const bool atStart =
+            intersection && Predicates::orient2d(a, b, x) == 0.0;
+        const bool atEnd = intersection && Predicates::orient2d(a, b, y) == 0.0;
+
+        const bool duplicate = (atStart && previousAtEnd) ||
+                               (i == last && atEnd && firstAtStart);
+
+        if (intersection && !duplicate) {
+            ++count;
+
+            // keeps the Capacity hits with the smallest line parameters
+            if (stored < Capacity) {
+                Out[stored++] = *intersection;
+            } else if (Capacity > 0) {
+                auto farthest = std::max_element(Out, Out + Capacity,
+                                                 byParameter);
+                if (byParameter(*intersection, *farthest))
+                    *farthest = *intersection;
+            }
+        }
+
+        if (!seen)
+            firstAtStart = atStart;
+        seen = true;
+        previousAtEnd = atEnd;
+        x = y;
     }
 
-    auto [xmin, xmax] = std::minmax_element(
-        m_points.begin(), m_points.end(),
-        [](const Vector2 &a, const Vector2 &b) -> bool { return a.x < b.x; });
+    std::sort(Out, Out + stored, byParameter);
 
-    auto [ymin, ymax] = std::minmax_element(
-        m_points.begin(), m_points.end(),
-        [](const Vector2 &a, const Vector2 &b) -> bool { return a.y < b.y; });
+    return count;
+}
 
-    m_xymin = {xmin->x, ymin->y};
-    m_xymax = {xmax->x, ymax->y};
+// even-odd rule, counting the crossings of a ray to the right
+bool polygonContains(PointSpan Points, Vector2 point) {
+    return (polygonIntersectLine(Points, point, {point.x + 1.0f, point.y},
+                                 LineType::RAY, nullptr, 0) %
+            2) == 1;
+}
+} // namespace
+
+/* private */ void Polygon::calculateMinmax() {
+    std::tie(m_xymin, m_xymax) = polygonBounds(m_points);
 }
 
 Polygon::Polygon(const std::vector<Vector2> &points)
@@ -271,76 +1020,519 @@ Polygon::Polygon(const std::vector<Vector2> &points)
     calculateMinmax();
 }
 
-Polygon::Polygon(const Polygon &other) : Shape(), m_points(other.getPoints()) {
+Polygon::Polygon(std::vector<Vector2> &&points)
+    : Shape(), m_points(std::move(points)) {
     calculateMinmax();
 }
 
+Polygon::Polygon(const Polygon &other)
+    : Shape(other), m_points(other.m_points) {}
+
+Polygon::Polygon(Polygon &&other) noexcept
+    : Shape(other), m_points(std::move(other.m_points)) {
+    other.m_xymin = other.m_xymax = Vector2::Zero;
+}
+
 Polygon::Polygon(std::initializer_list<Vector2> list)
     : Shape(), m_points(list.begin(), list.end()) {
     calculateMinmax();
 }
 
+Polygon::Polygon(const PolygonView &view)
+    : Shape(view), m_points(view.getPoints().toVector()) {}
+
 /* virtual */ bool Polygon::isPointInside(Vector2 point) const /* override */
 {
-    return (intersectLine(point, {point.x + 1.0f, point.y}, LineType::RAY)
-                .size() %
-            2) == 1;
+    return polygonContains(m_points, point);
 }
 
-std::vector<Vector2> Polygon::getPoints() const { return m_points; }
+PointSpan Polygon::getPoints() const { return m_points; }
+
+PolygonMetrics Polygon::getMetrics(Summation Mode) const {
+    return computePolygonMetrics(m_points, Mode);
+}
+
+float Polygon::getArea() const { return getMetrics().getArea(); }
+
+Vector2 Polygon::getCentroid() const { return getMetrics().centroid; }
+
+float Polygon::getPerimeter() const { return getMetrics().perimeter; }
+
+Winding Polygon::getWinding() const { return getMetrics().getWinding(); }
 
 std::vector<Polygon::EdgeIntersection>
 Polygon::intersectLineEx(Vector2 a, Vector2 b, LineType type) const {
-    if (m_points.size() <= 1)
-        return {};
+    return polygonIntersectLineEx(m_points, a, b, type);
+}
+
+/* virtual */ std::vector<Vector2>
+Polygon::intersectLine(Vector2 a, Vector2 b, LineType type) const /* override */
+{
+    std::vector<Vector2> result(m_points.size());
+    result.resize(intersectLine(a, b, type, result.data(), result.size()));
+
+    return result;
+}
 
-    const auto inputLine = Line(a, b, type);
+/* virtual */ std::size_t
+Polygon::intersectLine(Vector2 a, Vector2 b, LineType type, Vector2 *Out,
+                       std::size_t Capacity) const /* override */
+{
+    return polygonIntersectLine(m_points, a, b, type, Out, Capacity);
+}
+
+// Polygon
+#pragma endregion
 
-    std::unordered_set<EdgeIntersection> result = {};
+#pragma region PolygonView
 
-    Vector2 x = m_points.at(m_points.size() - 1), y;
-    for (std::size_t i = 0; i < m_points.size(); ++i) {
-        y = m_points.at(i);
+PolygonView::PolygonView(PointSpan points) : Shape(), m_points(points) {
+    std::tie(m_xymin, m_xymax) = polygonBounds(m_points);
+}
 
-        const auto segment = Line(x, y, LineType::SEGMENT);
-        const auto intersection = inputLine.intersectLine(segment);
+PolygonView::PolygonView(const Vector2 *points, std::size_t count)
+    : PolygonView(PointSpan(points, count)) {}
 
-        if (intersection.size() > 0)
-            result.insert({intersection.at(0), segment});
+PolygonView::PolygonView(const float *coordinates, std::size_t count)
+    : PolygonView(reinterpret_cast<const Vector2 *>(coordinates), count) {}
 
-        x = y;
-    }
+PolygonView::PolygonView(const Polygon &polygon)
+    : Shape(polygon), m_points(polygon.getPoints()) {}
+
+PointSpan PolygonView::getPoints() const { return m_points; }
+
+PolygonMetrics PolygonView::getMetrics(Summation Mode) const {
+    return computePolygonMetrics(m_points, Mode);
+}
+
+float PolygonView::getArea() const { return getMetrics().getArea(); }
+
+Vector2 PolygonView::getCentroid() const { return getMetrics().centroid; }
+
+float PolygonView::getPerimeter() const { return getMetrics().perimeter; }
+
+Winding PolygonView::getWinding() const { return getMetrics().getWinding(); }
 
-    return std::vector<EdgeIntersection>(result.begin(), result.end());
+/* virtual */ bool
+PolygonView::isPointInside(Vector2 point) const /* override */
+{
+    return polygonContains(m_points, point);
+}
+
+std::vector<Polygon::EdgeIntersection>
+PolygonView::intersectLineEx(Vector2 a, Vector2 b, LineType type) const {
+    return polygonIntersectLineEx(m_points, a, b, type);
 }
 
 /* virtual */ std::vector<Vector2>
-Polygon::intersectLine(Vector2 a, Vector2 b, LineType type) const /* override */
+PolygonView::intersectLine(Vector2 a, Vector2 b,
+                           LineType type) const /* override */
 {
-    if (m_points.size() <= 1)
-        return {};
+    std::vector<Vector2> result(m_points.size());
+    result.resize(intersectLine(a, b, type, result.data(), result.size()));
+
+    return result;
+}
+
+/* virtual */ std::size_t
+PolygonView::intersectLine(Vector2 a, Vector2 b, LineType type, Vector2 *Out,
+                           std::size_t Capacity) const /* override */
+{
+    return polygonIntersectLine(m_points, a, b, type, Out, Capacity);
+}
 
-    const auto inputLine = Line(a, b, type);
+// PolygonView
+#pragma endregion
 
-    std::unordered_set<Vector2> result = {};
+#pragma region PreparedPolygon
 
-    Vector2 x = m_points.at(m_points.size() - 1), y;
-    for (std::size_t i = 0; i < m_points.size(); ++i) {
-        y = m_points.at(i);
+/* private */ void PreparedPolygon::prepare() {
+    m_slabY.clear();
+    m_slabOffsets.clear();
+    m_slabEdges.clear();
+    m_slabOrdered.clear();
 
-        const auto intersection =
-            inputLine.intersectLine(x, y, LineType::SEGMENT);
+    for (const auto &point : m_points)
+        m_slabY.push_back(point.y);
 
-        if (intersection.size() > 0)
-            result.insert(intersection.at(0));
+    std::sort(m_slabY.begin(), m_slabY.end());
+    m_slabY.erase(std::unique(m_slabY.begin(), m_slabY.end()), m_slabY.end());
 
-        x = y;
+    if (m_points.size() < 3 || m_slabY.size() < 2) {
+        m_slabY.clear();
+        return;
     }
 
-    return std::vector<Vector2>(result.begin(), result.end());
+    const std::size_t slabCount = m_slabY.size() - 1;
+
+    // slabs [first, last) spanned by the edge from a to b
+    const auto slabRange = [this](Vector2 a, Vector2 b) {
+        const auto first = std::lower_bound(m_slabY.begin(), m_slabY.end(),
+                                            std::min(a.y, b.y)),
+                   last = std::lower_bound(first, m_slabY.end(),
+                                           std::max(a.y, b.y));
+        return std::make_pair(first - m_slabY.begin(),
+                              last - m_slabY.begin());
+    };
+
+    m_slabOffsets.assign(slabCount + 1, 0);
+
+    Vector2 a = m_points.back();
+    for (const auto &b : m_points) {
+        const auto [first, last] = slabRange(a, b);
+        for (auto slab = first; slab < last; ++slab)
+            ++m_slabOffsets[slab + 1];
+
+        a = b;
+    }
+
+    std::partial_sum(m_slabOffsets.begin(), m_slabOffsets.end(),
+                     m_slabOffsets.begin());
+    m_slabEdges.resize(m_slabOffsets.back());
+
+    std::vector<std::size_t> fill(m_slabOffsets.begin(),
+                                  m_slabOffsets.end() - 1);
+
+    a = m_points.back();
+    for (const auto &b : m_points) {
+        const auto [first, last] = slabRange(a, b);
+        const Edge edge = {a.x, a.y, (b.x - a.x) / (b.y - a.y)};
+
+        for (auto slab = first; slab < last; ++slab)
+            m_slabEdges[fill[slab]++] = edge;
+
+        a = b;
+    }
+
+    // the edges of a simple polygon do not cross inside a slab, so their order
+    // in the middle of the slab holds for the whole slab
+    m_slabOrdered.assign(slabCount, 1);
+    for (std::size_t slab = 0; slab < slabCount; ++slab) {
+        const float low = m_slabY[slab], high = m_slabY[slab + 1],
+                    middle = 0.5f * (low + high);
+
+        const auto begin = m_slabEdges.begin() + m_slabOffsets[slab],
+                   end = m_slabEdges.begin() + m_slabOffsets[slab + 1];
+
+        std::sort(begin, end, [middle](const Edge &e1, const Edge &e2) {
+            return e1.xAt(middle) < e2.xAt(middle);
+        });
+
+        for (auto edge = begin; edge + 1 < end; ++edge) {
+            if (edge[0].xAt(low) > edge[1].xAt(low) ||
+                edge[0].xAt(high) > edge[1].xAt(high)) {
+                m_slabOrdered[slab] = 0;
+                break;
+            }
+        }
+    }
 }
 
-// Polygon
+PreparedPolygon::PreparedPolygon(const std::vector<Vector2> &points)
+    : Polygon(points) {
+    prepare();
+}
+
+PreparedPolygon::PreparedPolygon(const Polygon &other) : Polygon(other) {
+    prepare();
+}
+
+PreparedPolygon::PreparedPolygon(Polygon &&other) : Polygon(std::move(other)) {
+    prepare();
+}
+
+PreparedPolygon::PreparedPolygon(std::initializer_list<Vector2> list)
+    : Polygon(list) {
+    prepare();
+}
+
+/* virtual */ bool
+PreparedPolygon::isPointInside(Vector2 point) const /* override */
+{
+    if (m_slabY.empty() || !isPointInsideBoundingRectangle(point))
+        return false;
+
+    const auto slab = static_cast<std::size_t>(
+        std::upper_bound(m_slabY.begin(), m_slabY.end(), point.y) -
+        m_slabY.begin());
+
+    // above the last vertex, or below the first one
+    if (slab == 0 || slab == m_slabY.size())
+        return false;
+
+    const auto begin = m_slabEdges.begin() + m_slabOffsets[slab - 1],
+               end = m_slabEdges.begin() + m_slabOffsets[slab];
+
+    const auto isLeft = [point](const Edge &edge) {
+        return edge.xAt(point.y) <= point.x;
+    };
+
+    const auto edgesRight =
+        m_slabOrdered[slab - 1]
+            ? end - std::partition_point(begin, end, isLeft)
+            : (end - begin) - std::count_if(begin, end, isLeft);
+
+    return edgesRight % 2 == 1;
+}
+
+void PreparedPolygon::containsPoints(const Vector2 *Points, bool *Out,
+                                     std::size_t Count) const {
+    for (std::size_t i = 0; i < Count; ++i)
+        Out[i] = PreparedPolygon::isPointInside(Points[i]);
+}
+
+// PreparedPolygon
+#pragma endregion
+
+#pragma region PolygonMetrics
+
+namespace {
+// polygons a thread takes at once in the batch
+constexpr std::size_t MetricsChunkSize = 64;
+
+// Neumaier's variant of Kahan summation, which also handles terms larger
+// than the sum
+struct CompensatedSum {
+    double sum = 0.0;
+    double compensation = 0.0;
+
+    inline void add(double term) {
+        const double total = sum + term;
+        compensation += std::abs(sum) >= std::abs(term)
+                            ? (sum - total) + term
+                            : (term - total) + sum;
+        sum = total;
+    }
+
+    inline double value() const { return sum + compensation; }
+};
+
+/*
+ * The sums of the edges from (x0, y0) to (x1, y1), relative to the first
+ * point: twice the signed area sums the cross products, and 6 times the area
+ * times the centroid sums the cross products times the sums of the points
+ */
+template <typename T, typename Sum> struct MetricSums {
+    Sum cross{};
+    Sum centroidX{};
+    Sum centroidY{};
+    Sum perimeter{};
+
+    inline void addEdge(T x0, T y0, T x1, T y1) {
+        const T cross2 = x0 * y1 - y0 * x1, dx = x1 - x0, dy = y1 - y0;
+
+        add(cross, cross2);
+        add(centroidX, (x0 + x1) * cross2);
+        add(centroidY, (y0 + y1) * cross2);
+        add(perimeter, std::sqrt(dx * dx + dy * dy));
+    }
+
+    static inline void add(T &sum, T term) { sum += term; }
+    static inline void add(CompensatedSum &sum, T term) { sum.add(term); }
+};
+
+inline double sumValue(double sum) { return sum; }
+inline double sumValue(float sum) { return sum; }
+inline double sumValue(const CompensatedSum &sum) { return sum.value(); }
+
+#if defined(CALCDA_SIMD_AVX)
+constexpr std::size_t MetricsBlockWidth = 8;
+using MetricsRegister = __m256;
+
+inline __m256 metricsSet1(float value) { return _mm256_set1_ps(value); }
+inline __m256 metricsAdd(__m256 a, __m256 b) { return _mm256_add_ps(a, b); }
+inline __m256 metricsSub(__m256 a, __m256 b) { return _mm256_sub_ps(a, b); }
+inline __m256 metricsMul(__m256 a, __m256 b) { return _mm256_mul_ps(a, b); }
+inline __m256 metricsSqrt(__m256 a) { return _mm256_sqrt_ps(a); }
+
+/*
+ * Splits 8 points into their x and y; the shuffles work per 128 bits, so the
+ * lanes come out of order, the same order for every load
+ */
+inline void metricsLoad(const float *Points, __m256 &x, __m256 &y) {
+    const __m256 low = _mm256_loadu_ps(Points),
+                 high = _mm256_loadu_ps(Points + 8);
+    x = _mm256_shuffle_ps(low, high, _MM_SHUFFLE(2, 0, 2, 0));
+    y = _mm256_shuffle_ps(low, high, _MM_SHUFFLE(3, 1, 3, 1));
+}
+
+inline float metricsSum(__m256 a) {
+    const __m128 sum = _mm_add_ps(_mm256_castps256_ps128(a),
+                                  _mm256_extractf128_ps(a, 1));
+    const __m128 pairs = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    return _mm_cvtss_f32(_mm_add_ss(
+        pairs, _mm_shuffle_ps(pairs, pairs, _MM_SHUFFLE(1, 1, 1, 1))));
+}
+#elif defined(CALCDA_SIMD_SSE2)
+constexpr std::size_t MetricsBlockWidth = 4;
+using MetricsRegister = __m128;
+
+inline __m128 metricsSet1(float value) { return _mm_set1_ps(value); }
+inline __m128 metricsAdd(__m128 a, __m128 b) { return _mm_add_ps(a, b); }
+inline __m128 metricsSub(__m128 a, __m128 b) { return _mm_sub_ps(a, b); }
+inline __m128 metricsMul(__m128 a, __m128 b) { return _mm_mul_ps(a, b); }
+inline __m128 metricsSqrt(__m128 a) { return _mm_sqrt_ps(a); }
+
+// splits 4 points into their x and y
+inline void metricsLoad(const float *Points, __m128 &x, __m128 &y) {
+    const __m128 low = _mm_loadu_ps(Points), high = _mm_loadu_ps(Points + 4);
+    x = _mm_shuffle_ps(low, high, _MM_SHUFFLE(2, 0, 2, 0));
+    y = _mm_shuffle_ps(low, high, _MM_SHUFFLE(3, 1, 3, 1));
+}
+
+inline float metricsSum(__m128 a) {
+    const __m128 pairs = _mm_add_ps(a, _mm_movehl_ps(a, a));
+    return _mm_cvtss_f32(_mm_add_ss(
+        pairs, _mm_shuffle_ps(pairs, pairs, _MM_SHUFFLE(1, 1, 1, 1))));
+}
+#endif
+
+/*
+ * Adds the edges a block at a time, and returns the first point of the edges
+ * left over
+ */
+std::size_t addMetricBlocks(PointSpan Points, Vector2 Origin,
+                            MetricSums<float, float> &Sums) {
+#if defined(CALCDA_SIMD_AVX) || defined(CALCDA_SIMD_SSE2)
+    const float *points = reinterpret_cast<const float *>(Points.data());
+    const MetricsRegister ox = metricsSet1(Origin.x),
+                          oy = metricsSet1(Origin.y);
+
+    MetricsRegister cross = metricsSet1(0.0f), centroidX = cross,
+                    centroidY = cross, perimeter = cross;
+
+    // the edges of a block end at the next block width points
+    std::size_t i = 0;
+    for (; i + MetricsBlockWidth < Points.size(); i += MetricsBlockWidth) {
+        MetricsRegister x0, y0, x1, y1;
+        metricsLoad(points + 2 * i, x0, y0);
+        metricsLoad(points + 2 * i + 2, x1, y1);
+
+        x0 = metricsSub(x0, ox);
+        y0 = metricsSub(y0, oy);
+        x1 = metricsSub(x1, ox);
+        y1 = metricsSub(y1, oy);
+
+        const MetricsRegister cross2 =
+            metricsSub(metricsMul(x0, y1), metricsMul(y0, x1));
+        const MetricsRegister dx = metricsSub(x1, x0), dy = metricsSub(y1, y0);
+
+        cross = metricsAdd(cross, cross2);
+        centroidX =
+            metricsAdd(centroidX, metricsMul(metricsAdd(x0, x1), cross2));
+        centroidY =
+            metricsAdd(centroidY, metricsMul(metricsAdd(y0, y1), cross2));
+        perimeter = metricsAdd(
+            perimeter,
+            metricsSqrt(metricsAdd(metricsMul(dx, dx), metricsMul(dy, dy))));
+    }
+
+    Sums.cross += metricsSum(cross);
+    Sums.centroidX += metricsSum(centroidX);
+    Sums.centroidY += metricsSum(centroidY);
+    Sums.perimeter += metricsSum(perimeter);
+    return i;
+#else
+    static_cast<void>(Points);
+    static_cast<void>(Origin);
+    static_cast<void>(Sums);
+    return 0;
+#endif
+}
+
+template <typename T, typename Sum>
+PolygonMetrics finishMetrics(PointSpan Points, Vector2 Origin,
+                             std::size_t Begin, MetricSums<T, Sum> &Sums) {
+    const auto relative = [Origin](Vector2 point, T &x, T &y) {
+        x = static_cast<T>(point.x) - static_cast<T>(Origin.x);
+        y = static_cast<T>(point.y) - static_cast<T>(Origin.y);
+    };
+
+    // the edges left over, and the edge back to the first point
+    for (std::size_t i = Begin; i < Points.size(); ++i) {
+        T x0, y0, x1, y1;
+        relative(Points[i], x0, y0);
+        relative(Points[i + 1 < Points.size() ? i + 1 : 0], x1, y1);
+        Sums.addEdge(x0, y0, x1, y1);
+    }
+
+    const double cross = sumValue(Sums.cross);
+
+    PolygonMetrics result;
+    result.signedArea = static_cast<float>(0.5 * cross);
+    result.perimeter = static_cast<float>(sumValue(Sums.perimeter));
+
+    if (cross != 0.0) {
+        const double scale = 1.0 / (3.0 * cross),
+                     x = Origin.x + sumValue(Sums.centroidX) * scale,
+                     y = Origin.y + sumValue(Sums.centroidY) * scale;
+        result.centroid = Vector2(static_cast<float>(x), static_cast<float>(y));
+    } else {
+        double x = 0.0, y = 0.0;
+        for (const auto &point : Points) {
+            x += point.x;
+            y += point.y;
+        }
+
+        result.centroid = Vector2(static_cast<float>(x / Points.size()),
+                                  static_cast<float>(y / Points.size()));
+    }
+
+    return result;
+}
+} // namespace
+
+PolygonMetrics computePolygonMetrics(PointSpan Points, Summation Mode) {
+    if (Points.empty())
+        return {0.0f, Vector2::Zero, 0.0f};
+
+    const Vector2 origin = Points[0];
+
+    if (Mode == Summation::COMPENSATED) {
+        MetricSums<double, CompensatedSum> sums;
+        return finishMetrics(Points, origin, 0, sums);
+    }
+
+    MetricSums<float, float> sums;
+    const std::size_t begin = addMetricBlocks(Points, origin, sums);
+    return finishMetrics(Points, origin, begin, sums);
+}
+
+void computePolygonMetrics(const PointSpan *Polygons, std::size_t Count,
+                           PolygonMetrics *Out, Summation Mode,
+                           unsigned int Threads) {
+    const std::size_t chunkCount =
+        (Count + MetricsChunkSize - 1) / MetricsChunkSize;
+
+    if (Threads == 0)
+        Threads = std::max(1U, std::thread::hardware_concurrency());
+    if (Threads > chunkCount)
+        Threads = static_cast<unsigned int>(chunkCount);
+
+    std::atomic<std::size_t> nextChunk(0);
+    const auto work = [&]() {
+        for (std::size_t chunk = nextChunk++; chunk < chunkCount;
+             chunk = nextChunk++) {
+            const std::size_t begin = chunk * MetricsChunkSize,
+                              end = std::min(begin + MetricsChunkSize, Count);
+
+            for (std::size_t i = begin; i < end; ++i)
+                Out[i] = computePolygonMetrics(Polygons[i], Mode);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    if (Threads > 1)
+        threads.reserve(Threads - 1);
+    for (unsigned int i = 1; i < Threads; ++i)
+        threads.emplace_back(work);
+
+    work();
+    for (auto &thread : threads)
+        thread.join();
+}
+
+// PolygonMetrics
 #pragma endregion
 
 } // namespace Calcda
\ No newline at end of file
@@ -1,18 +1,774 @@
 #include "Matrix4.hpp"
 #include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <iomanip>
 #include <sstream>
 
+#if defined(CALCDA_SIMD_AVX) || defined(CALCDA_SIMD_SSE2)
+#include <immintrin.h>
+#elif defined(CALCDA_SIMD_NEON)
+#include <arm_neon.h>
+#endif
+
 namespace Calcda {
 
-Matrix4::Matrix4() {
+namespace {
+//! @brief The scalar 4x4 product, in the order of the SIMD kernels
+template <typename T>
+void multiplyScalar(const T *Left, const T *Right, T *Out) {
+    T result[16] = {};
+
+    for (unsigned int i = 0U; i < 4U; i++) {
+        for (unsigned int j = 0U; j < 4U; j++) {
+            for (unsigned int k = 0U; k < 4U; k++) {
+                result[i * 4U + j] += Left[i * 4U + k] * Right[k * 4U + j];
+            }
+        }
+    }
+
+    for (unsigned int i = 0U; i < 16U; i++) {
+        Out[i] = result[i];
+    }
+}
+
+/**
+ * @brief Multiplies the row-major 4x4 matrices @c Left and @c Right into @c
+ * Out. Every row of the result is accumulated as the sum of the rows of @c
+ * Right, scaled by the broadcast elements of the same row of @c Left. @c Out
+ * may alias either input.
+ *
+ * Without FMA the summation order matches the scalar loop, so the results are
+ * bit-identical to it.
+ */
+void multiplyKernel(const float *Left, const float *Right, float *Out) {
+#if defined(CALCDA_SIMD_AVX)
+    const __m256 r0 =
+        _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(Right + 0));
+    const __m256 r1 =
+        _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(Right + 4));
+    const __m256 r2 =
+        _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(Right + 8));
+    const __m256 r3 =
+        _mm256_broadcast_ps(reinterpret_cast<const __m128 *>(Right + 12));
+
+    // two rows of Left per register
+    const __m256 lower = _mm256_loadu_ps(Left + 0);
+    const __m256 upper = _mm256_loadu_ps(Left + 8);
+
+    const auto rowPair = [&](__m256 rows) {
+        __m256 accumulator = _mm256_setzero_ps();
+#if defined(CALCDA_SIMD_FMA)
+        accumulator = _mm256_fmadd_ps(_mm256_permute_ps(rows, 0x00), r0,
+                                      accumulator);
+        accumulator = _mm256_fmadd_ps(_mm256_permute_ps(rows, 0x55), r1,
+                                      accumulator);
+        accumulator = _mm256_fmadd_ps(_mm256_permute_ps(rows, 0xAA), r2,
+                                      accumulator);
+        accumulator = _mm256_fmadd_ps(_mm256_permute_ps(rows, 0xFF), r3,
+                                      accumulator);
+#else
+        accumulator = _mm256_add_ps(
+            accumulator, _mm256_mul_ps(_mm256_permute_ps(rows, 0x00), r0));
+        accumulator = _mm256_add_ps(
+            accumulator, _mm256_mul_ps(_mm256_permute_ps(rows, 0x55), r1));
+        accumulator = _mm256_add_ps(
+            accumulator, _mm256_mul_ps(_mm256_permute_ps(rows, 0xAA), r2));
+        accumulator = _mm256_add_ps(
+            accumulator, _mm256_mul_ps(_mm256_permute_ps(rows, 0xFF), r3));
+#endif
+        return accumulator;
+    };
+
+    const __m256 resultLower = rowPair(lower);
+    const __m256 resultUpper = rowPair(upper);
+
+    _mm256_storeu_ps(Out + 0, resultLower);
+    _mm256_storeu_ps(Out + 8, resultUpper);
+#elif defined(CALCDA_SIMD_SSE2)
+    const __m128 r0 = _mm_loadu_ps(Right + 0);
+    const __m128 r1 = _mm_loadu_ps(Right + 4);
+    const __m128 r2 = _mm_loadu_ps(Right + 8);
+    const __m128 r3 = _mm_loadu_ps(Right + 12);
+
+    __m128 result[4];
+
+    for (unsigned int i = 0U; i < 4U; i++) {
+        const __m128 row = _mm_loadu_ps(Left + i * 4U);
+
+        __m128 accumulator = _mm_setzero_ps();
+        accumulator = _mm_add_ps(
+            accumulator, _mm_mul_ps(_mm_shuffle_ps(row, row, 0x00), r0));
+        accumulator = _mm_add_ps(
+            accumulator, _mm_mul_ps(_mm_shuffle_ps(row, row, 0x55), r1));
+        accumulator = _mm_add_ps(
+            accumulator, _mm_mul_ps(_mm_shuffle_ps(row, row, 0xAA), r2));
+        accumulator = _mm_add_ps(
+            accumulator, _mm_mul_ps(_mm_shuffle_ps(row, row, 0xFF), r3));
+
+        result[i] = accumulator;
+    }
+
+    for (unsigned int i = 0U; i < 4U; i++) {
+        _mm_storeu_ps(Out + i * 4U, result[i]);
+    }
+#elif defined(CALCDA_SIMD_NEON)
+    const float32x4_t rows[4] = {vld1q_f32(Right + 0), vld1q_f32(Right + 4),
+                                 vld1q_f32(Right + 8), vld1q_f32(Right + 12)};
+
+    float32x4_t result[4];
+
+    for (unsigned int i = 0U; i < 4U; i++) {
+        float32x4_t accumulator = vdupq_n_f32(0.0f);
+
+        for (unsigned int k = 0U; k < 4U; k++) {
+#if defined(CALCDA_SIMD_FMA)
+            accumulator = vfmaq_n_f32(accumulator, rows[k], Left[i * 4U + k]);
+#else
+            accumulator = vaddq_f32(accumulator,
+                                    vmulq_n_f32(rows[k], Left[i * 4U + k]));
+#endif
+        }
+
+        result[i] = accumulator;
+    }
+
+    for (unsigned int i = 0U; i < 4U; i++) {
+        vst1q_f32(Out + i * 4U, result[i]);
+    }
+#else
+    multiplyScalar(Left, Right, Out);
+#endif
+}
+
+/**
+ * @brief The double precision multiplyKernel. A row of doubles fills an AVX
+ * register, or two SSE2 or NEON registers; the rows of the result are
+ * accumulated in the same order.
+ */
+void multiplyKernel(const double *Left, const double *Right, double *Out) {
+#if defined(CALCDA_SIMD_AVX)
+    const __m256d rows[4] = {_mm256_loadu_pd(Right + 0),
+                             _mm256_loadu_pd(Right + 4),
+                             _mm256_loadu_pd(Right + 8),
+                             _mm256_loadu_pd(Right + 12)};
+
+    __m256d result[4];
+
+    for (unsigned int i = 0U; i < 4U; i++) {
+        __m256d accumulator = _mm256_setzero_pd();
+
+        for (unsigned int k = 0U; k < 4U; k++) {
+            const __m256d scale = _mm256_set1_pd(Left[i * 4U + k]);
+#if defined(CALCDA_SIMD_FMA)
+            accumulator = _mm256_fmadd_pd(scale, rows[k], accumulator);
+#else
+            accumulator =
+                _mm256_add_pd(accumulator, _mm256_mul_pd(scale, rows[k]));
+#endif
+        }
+
+        result[i] = accumulator;
+    }
+
+    for (unsigned int i = 0U; i < 4U; i++) {
+        _mm256_storeu_pd(Out + i * 4U, result[i]);
+    }
+#elif defined(CALCDA_SIMD_SSE2)
+    // the lower and upper halves of every row
+    __m128d rows[8];
+    for (unsigned int i = 0U; i < 8U; i++) {
+        rows[i] = _mm_loadu_pd(Right + i * 2U);
+    }
+
+    __m128d result[8];
+
+    for (unsigned int i = 0U; i < 4U; i++) {
+        __m128d lower = _mm_setzero_pd();
+        __m128d upper = _mm_setzero_pd();
+
+        for (unsigned int k = 0U; k < 4U; k++) {
+            const __m128d scale = _mm_set1_pd(Left[i * 4U + k]);
+            lower = _mm_add_pd(lower, _mm_mul_pd(scale, rows[k * 2U + 0U]));
+            upper = _mm_add_pd(upper, _mm_mul_pd(scale, rows[k * 2U + 1U]));
+        }
+
+        result[i * 2U + 0U] = lower;
+        result[i * 2U + 1U] = upper;
+    }
+
+    for (unsigned int i = 0U; i < 8U; i++) {
+        _mm_storeu_pd(Out + i * 2U, result[i]);
+    }
+#elif defined(CALCDA_SIMD_NEON) && defined(__aarch64__)
+    // the lower and upper halves of every row
+    float64x2_t rows[8];
+    for (unsigned int i = 0U; i < 8U; i++) {
+        rows[i] = vld1q_f64(Right + i * 2U);
+    }
+
+    float64x2_t result[8];
+
+    for (unsigned int i = 0U; i < 4U; i++) {
+        float64x2_t lower = vdupq_n_f64(0.0);
+        float64x2_t upper = vdupq_n_f64(0.0);
+
+        for (unsigned int k = 0U; k < 4U; k++) {
+            const double scale = Left[i * 4U + k];
+#if defined(CALCDA_SIMD_FMA)
+            lower = vfmaq_n_f64(lower, rows[k * 2U + 0U], scale);
+            upper = vfmaq_n_f64(upper, rows[k * 2U + 1U], scale);
+#else
+            lower = vaddq_f64(lower, vmulq_n_f64(rows[k * 2U + 0U], scale));
+            upper = vaddq_f64(upper, vmulq_n_f64(rows[k * 2U + 1U], scale));
+#endif
+        }
+
+        result[i * 2U + 0U] = lower;
+        result[i * 2U + 1U] = upper;
+    }
+
+    for (unsigned int i = 0U; i < 8U; i++) {
+        vst1q_f64(Out + i * 2U, result[i]);
+    }
+#else
+    multiplyScalar(Left, Right, Out);
+#endif
+}
+
+#if defined(CALCDA_SIMD_SSE2)
+//! @brief A row of floats in an SSE2 register, for transformLanes
+struct FloatLanes {
+    using lane_t = __m128;
+
+    static lane_t load(const float *Source) { return _mm_loadu_ps(Source); }
+    static void store(float *Destination, lane_t Lane) {
+        _mm_storeu_ps(Destination, Lane);
+    }
+    static lane_t add(lane_t Left, lane_t Right) {
+        return _mm_add_ps(Left, Right);
+    }
+    static lane_t scale(lane_t Column, float Scale) {
+        return _mm_mul_ps(Column, _mm_set1_ps(Scale));
+    }
+    static lane_t scaleAdd(lane_t Accumulator, lane_t Column, float Scale) {
+#if defined(CALCDA_SIMD_FMA)
+        return _mm_fmadd_ps(Column, _mm_set1_ps(Scale), Accumulator);
+#else
+        return _mm_add_ps(Accumulator, _mm_mul_ps(Column, _mm_set1_ps(Scale)));
+#endif
+    }
+};
+#elif defined(CALCDA_SIMD_NEON)
+//! @brief A row of floats in a NEON register, for transformLanes
+struct FloatLanes {
+    using lane_t = float32x4_t;
+
+    static lane_t load(const float *Source) { return vld1q_f32(Source); }
+    static void store(float *Destination, lane_t Lane) {
+        vst1q_f32(Destination, Lane);
+    }
+    static lane_t add(lane_t Left, lane_t Right) {
+        return vaddq_f32(Left, Right);
+    }
+    static lane_t scale(lane_t Column, float Scale) {
+        return vmulq_n_f32(Column, Scale);
+    }
+    static lane_t scaleAdd(lane_t Accumulator, lane_t Column, float Scale) {
+#if defined(CALCDA_SIMD_FMA)
+        return vfmaq_n_f32(Accumulator, Column, Scale);
+#else
+        return vaddq_f32(Accumulator, vmulq_n_f32(Column, Scale));
+#endif
+    }
+};
+#endif
+
+#if defined(CALCDA_SIMD_AVX)
+//! @brief A row of doubles in an AVX register, for transformLanes
+struct DoubleLanes {
+    using lane_t = __m256d;
+
+    static lane_t load(const double *Source) { return _mm256_loadu_pd(Source); }
+    static void store(double *Destination, lane_t Lane) {
+        _mm256_storeu_pd(Destination, Lane);
+    }
+    static lane_t add(lane_t Left, lane_t Right) {
+        return _mm256_add_pd(Left, Right);
+    }
+    static lane_t scale(lane_t Column, double Scale) {
+        return _mm256_mul_pd(Column, _mm256_set1_pd(Scale));
+    }
+    static lane_t scaleAdd(lane_t Accumulator, lane_t Column, double Scale) {
+#if defined(CALCDA_SIMD_FMA)
+        return _mm256_fmadd_pd(Column, _mm256_set1_pd(Scale), Accumulator);
+#else
+        return _mm256_add_pd(Accumulator,
+                             _mm256_mul_pd(Column, _mm256_set1_pd(Scale)));
+#endif
+    }
+};
+#elif defined(CALCDA_SIMD_SSE2)
+//! @brief A row of doubles in two SSE2 registers, for transformLanes
+struct DoubleLanes {
+    struct lane_t {
+        __m128d lower;
+        __m128d upper;
+    };
+
+    static lane_t load(const double *Source) {
+        return {_mm_loadu_pd(Source), _mm_loadu_pd(Source + 2)};
+    }
+    static void store(double *Destination, lane_t Lane) {
+        _mm_storeu_pd(Destination, Lane.lower);
+        _mm_storeu_pd(Destination + 2, Lane.upper);
+    }
+    static lane_t add(lane_t Left, lane_t Right) {
+        return {_mm_add_pd(Left.lower, Right.lower),
+                _mm_add_pd(Left.upper, Right.upper)};
+    }
+    static lane_t scale(lane_t Column, double Scale) {
+        const __m128d broadcast = _mm_set1_pd(Scale);
+        return {_mm_mul_pd(Column.lower, broadcast),
+                _mm_mul_pd(Column.upper, broadcast)};
+    }
+    static lane_t scaleAdd(lane_t Accumulator, lane_t Column, double Scale) {
+        return add(Accumulator, scale(Column, Scale));
+    }
+};
+#elif defined(CALCDA_SIMD_NEON) && defined(__aarch64__)
+//! @brief A row of doubles in two NEON registers, for transformLanes
+struct DoubleLanes {
+    struct lane_t {
+        float64x2_t lower;
+        float64x2_t upper;
+    };
+
+    static lane_t load(const double *Source) {
+        return {vld1q_f64(Source), vld1q_f64(Source + 2)};
+    }
+    static void store(double *Destination, lane_t Lane) {
+        vst1q_f64(Destination, Lane.lower);
+        vst1q_f64(Destination + 2, Lane.upper);
+    }
+    static lane_t add(lane_t Left, lane_t Right) {
+        return {vaddq_f64(Left.lower, Right.lower),
+                vaddq_f64(Left.upper, Right.upper)};
+    }
+    static lane_t scale(lane_t Column, double Scale) {
+        return {vmulq_n_f64(Column.lower, Scale),
+                vmulq_n_f64(Column.upper, Scale)};
+    }
+    static lane_t scaleAdd(lane_t Accumulator, lane_t Column, double Scale) {
+#if defined(CALCDA_SIMD_FMA)
+        return {vfmaq_n_f64(Accumulator.lower, Column.lower, Scale),
+                vfmaq_n_f64(Accumulator.upper, Column.upper, Scale)};
+#else
+        return add(Accumulator, scale(Column, Scale));
+#endif
+    }
+};
+#endif
+
+/**
+ * @brief Transforms @c Count vectors of @c Components elements with the
+ * row-major matrix @c Matrix, a column of the matrix per register of @c Lanes.
+ * Three component vectors get an implicit W of 1 if @c Point is set, 0
+ * otherwise.
+ *
+ * The result is accumulated column by column, in the order of
+ * Matrix4::multiply(const Vector4 &), so without FMA the results are
+ * bit-identical to it.
+ */
+template <typename Lanes, std::size_t Components, bool Point, typename T>
+void transformLanes(const T *Matrix, const unsigned char *In,
+                    std::size_t InStride, unsigned char *Out,
+                    std::size_t OutStride, std::size_t Count) {
+    using lane_t = typename Lanes::lane_t;
+    constexpr std::size_t vectorSize = Components * sizeof(T);
+
+    const T columns[16] = {Matrix[0], Matrix[4], Matrix[8],  Matrix[12],
+                           Matrix[1], Matrix[5], Matrix[9],  Matrix[13],
+                           Matrix[2], Matrix[6], Matrix[10], Matrix[14],
+                           Matrix[3], Matrix[7], Matrix[11], Matrix[15]};
+
+    const lane_t c0 = Lanes::load(columns + 0);
+    const lane_t c1 = Lanes::load(columns + 4);
+    const lane_t c2 = Lanes::load(columns + 8);
+    const lane_t c3 = Lanes::load(columns + 12);
+
+    const auto transform = [&](const unsigned char *Source,
+                               unsigned char *Destination) {
+        T vector[4];
+        std::memcpy(vector, Source, vectorSize);
+
+        lane_t accumulator = Lanes::scale(c0, vector[0]);
+        accumulator = Lanes::scaleAdd(accumulator, c1, vector[1]);
+        accumulator = Lanes::scaleAdd(accumulator, c2, vector[2]);
+
+        CALCDA_IF_CONSTEXPR(Components == 4) {
+            accumulator = Lanes::scaleAdd(accumulator, c3, vector[3]);
+        }
+        else CALCDA_IF_CONSTEXPR(Point) {
+            accumulator = Lanes::add(accumulator, c3);
+        }
+
+        Lanes::store(vector, accumulator);
+        std::memcpy(Destination, vector, vectorSize);
+    };
+
+    std::size_t index = 0;
+
+    // four independent vectors per iteration, to hide the latency of the adds
+    for (; index + 4 <= Count; index += 4) {
+        transform(In + (index + 0) * InStride, Out + (index + 0) * OutStride);
+        transform(In + (index + 1) * InStride, Out + (index + 1) * OutStride);
+        transform(In + (index + 2) * InStride, Out + (index + 2) * OutStride);
+        transform(In + (index + 3) * InStride, Out + (index + 3) * OutStride);
+    }
+
+    for (; index < Count; ++index) {
+        transform(In + index * InStride, Out + index * OutStride);
+    }
+}
+
+//! @brief The scalar transformLanes
+template <std::size_t Components, bool Point, typename T>
+void transformScalar(const T *Matrix, const unsigned char *In,
+                     std::size_t InStride, unsigned char *Out,
+                     std::size_t OutStride, std::size_t Count) {
+    constexpr std::size_t vectorSize = Components * sizeof(T);
+
+    for (std::size_t index = 0; index < Count; ++index) {
+        T vector[4] = {T(0), T(0), T(0), Point ? T(1) : T(0)};
+        std::memcpy(vector, In + index * InStride, vectorSize);
+
+        T result[4];
+        for (std::size_t row = 0; row < 4; ++row) {
+            result[row] = (Matrix[row * 4 + 0] * vector[0]) +
+                          (Matrix[row * 4 + 1] * vector[1]) +
+                          (Matrix[row * 4 + 2] * vector[2]) +
+                          (Matrix[row * 4 + 3] * vector[3]);
+        }
+
+        std::memcpy(Out + index * OutStride, result, vectorSize);
+    }
+}
+
+template <std::size_t Components, bool Point>
+void transformKernel(const float *Matrix, const unsigned char *In,
+                     std::size_t InStride, unsigned char *Out,
+                     std::size_t OutStride, std::size_t Count) {
+#if defined(CALCDA_SIMD_SSE2) || defined(CALCDA_SIMD_NEON)
+    transformLanes<FloatLanes, Components, Point>(Matrix, In, InStride, Out,
+                                                  OutStride, Count);
+#else
+    transformScalar<Components, Point>(Matrix, In, InStride, Out, OutStride,
+                                       Count);
+#endif
+}
+
+template <std::size_t Components, bool Point>
+void transformKernel(const double *Matrix, const unsigned char *In,
+                     std::size_t InStride, unsigned char *Out,
+                     std::size_t OutStride, std::size_t Count) {
+#if defined(CALCDA_SIMD_SSE2) ||                                               \
+    (defined(CALCDA_SIMD_NEON) && defined(__aarch64__))
+    transformLanes<DoubleLanes, Components, Point>(Matrix, In, InStride, Out,
+                                                   OutStride, Count);
+#else
+    transformScalar<Components, Point>(Matrix, In, InStride, Out, OutStride,
+                                       Count);
+#endif
+}
+
+/**
+ * @brief Writes the inverse of the row-major 4x4 matrix @c In to @c Out,
+ * returning the determinant. Both are built from the 2x2 sub-determinants of
+ * the upper and lower row pairs, in the element precision; a singular matrix
+ * gives infinite or NaN elements. @c Out may alias @c In.
+ */
+template <typename T> T inverseKernel(const T *In, T *Out) {
+    const T a00 = In[0], a01 = In[1], a02 = In[2], a03 = In[3], a10 = In[4],
+            a11 = In[5], a12 = In[6], a13 = In[7], a20 = In[8], a21 = In[9],
+            a22 = In[10], a23 = In[11], a30 = In[12], a31 = In[13],
+            a32 = In[14], a33 = In[15];
+
+    // sub-determinants of the upper (s) and lower (c) row pairs
+    const T s0 = a00 * a11 - a10 * a01, s1 = a00 * a12 - a10 * a02,
+            s2 = a00 * a13 - a10 * a03, s3 = a01 * a12 - a11 * a02,
+            s4 = a01 * a13 - a11 * a03, s5 = a02 * a13 - a12 * a03;
+    const T c0 = a20 * a31 - a30 * a21, c1 = a20 * a32 - a30 * a22,
+            c2 = a20 * a33 - a30 * a23, c3 = a21 * a32 - a31 * a22,
+            c4 = a21 * a33 - a31 * a23, c5 = a22 * a33 - a32 * a23;
+
+    const T determinant =
+        s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+    const T scale = T(1) / determinant;
+
+    Out[0] = (a11 * c5 - a12 * c4 + a13 * c3) * scale;
+    Out[1] = (-a01 * c5 + a02 * c4 - a03 * c3) * scale;
+    Out[2] = (a31 * s5 - a32 * s4 + a33 * s3) * scale;
+    Out[3] = (-a21 * s5 + a22 * s4 - a23 * s3) * scale;
+    Out[4] = (-a10 * c5 + a12 * c2 - a13 * c1) * scale;
+    Out[5] = (a00 * c5 - a02 * c2 + a03 * c1) * scale;
+    Out[6] = (-a30 * s5 + a32 * s2 - a33 * s1) * scale;
+    Out[7] = (a20 * s5 - a22 * s2 + a23 * s1) * scale;
+    Out[8] = (a10 * c4 - a11 * c2 + a13 * c0) * scale;
+    Out[9] = (-a00 * c4 + a01 * c2 - a03 * c0) * scale;
+    Out[10] = (a30 * s4 - a31 * s2 + a33 * s0) * scale;
+    Out[11] = (-a20 * s4 + a21 * s2 - a23 * s0) * scale;
+    Out[12] = (-a10 * c3 + a11 * c1 - a12 * c0) * scale;
+    Out[13] = (a00 * c3 - a01 * c1 + a02 * c0) * scale;
+    Out[14] = (-a30 * s3 + a31 * s1 - a32 * s0) * scale;
+    Out[15] = (a20 * s3 - a21 * s1 + a22 * s0) * scale;
+
+    return determinant;
+}
+
+/**
+ * @brief Writes the inverse of the affine row-major matrix @c In (last row
+ * 0, 0, 0, 1) to @c Out. The inverse of the upper 3x3 block has the cross
+ * products of its rows as columns, divided by the determinant.
+ */
+template <typename T> void inverseAffineKernel(const T *In, T *Out) {
+    const T m00 = In[0], m01 = In[1], m02 = In[2], m03 = In[3], m10 = In[4],
+            m11 = In[5], m12 = In[6], m13 = In[7], m20 = In[8], m21 = In[9],
+            m22 = In[10], m23 = In[11];
+
+    const T c00 = m11 * m22 - m12 * m21, c10 = m12 * m20 - m10 * m22,
+            c20 = m10 * m21 - m11 * m20;
+    const T scale = T(1) / (m00 * c00 + m01 * c10 + m02 * c20);
+
+    const T r[9] = {c00 * scale,
+                    (m02 * m21 - m01 * m22) * scale,
+                    (m01 * m12 - m02 * m11) * scale,
+                    c10 * scale,
+                    (m00 * m22 - m02 * m20) * scale,
+                    (m02 * m10 - m00 * m12) * scale,
+                    c20 * scale,
+                    (m01 * m20 - m00 * m21) * scale,
+                    (m00 * m11 - m01 * m10) * scale};
+
+    for (unsigned int i = 0U; i < 3U; i++) {
+        Out[i * 4U + 0U] = r[i * 3U + 0U];
+        Out[i * 4U + 1U] = r[i * 3U + 1U];
+        Out[i * 4U + 2U] = r[i * 3U + 2U];
+        Out[i * 4U + 3U] =
+            -(r[i * 3U + 0U] * m03 + r[i * 3U + 1U] * m13 +
+              r[i * 3U + 2U] * m23);
+    }
+
+    Out[12] = T(0);
+    Out[13] = T(0);
+    Out[14] = T(0);
+    Out[15] = T(1);
+}
+
+/**
+ * @brief Writes the inverse of the rigid row-major matrix @c In (orthonormal
+ * rotation and translation) to @c Out; the rotation is transposed, so the
+ * rows of the input are the columns of the output
+ */
+template <typename T> void inverseRigidKernel(const T *In, T *Out) {
+    for (unsigned int i = 0U; i < 3U; i++) {
+        for (unsigned int j = 0U; j < 3U; j++) {
+            Out[i * 4U + j] = In[j * 4U + i];
+        }
+
+        Out[i * 4U + 3U] = -(In[0U * 4U + i] * In[3] + In[1U * 4U + i] * In[7] +
+                             In[2U * 4U + i] * In[11]);
+    }
+
+    Out[12] = T(0);
+    Out[13] = T(0);
+    Out[14] = T(0);
+    Out[15] = T(1);
+}
+
+#if defined(CALCDA_SIMD_SSE2)
+/**
+ * @brief The SSE2 inverseKernel for floats, which inverts the matrix
+ * blockwise: with the 2x2 blocks A, B, C, D and the adjugate #, |M| = |A||D| +
+ * |B||C| - tr((A#B)(D#C)), and the blocks of the inverse are products of the
+ * adjugates.
+ */
+template <> float inverseKernel(const float *In, float *Out) {
+#define CALCDA_SWIZZLE(v, x, y, z, w)                                          \
+    _mm_shuffle_ps(v, v, _MM_SHUFFLE(w, z, y, x))
+#define CALCDA_SHUFFLE(v1, v2, x, y, z, w)                                     \
+    _mm_shuffle_ps(v1, v2, _MM_SHUFFLE(w, z, y, x))
+
+    // 2x2 row-major products: A * B, A# * B, A * B#
+    const auto multiply2 = [](__m128 a, __m128 b) {
+        return _mm_add_ps(
+            _mm_mul_ps(a, CALCDA_SWIZZLE(b, 0, 3, 0, 3)),
+            _mm_mul_ps(CALCDA_SWIZZLE(a, 1, 0, 3, 2),
+                       CALCDA_SWIZZLE(b, 2, 1, 2, 1)));
+    };
+    const auto adjugateMultiply2 = [](__m128 a, __m128 b) {
+        return _mm_sub_ps(
+            _mm_mul_ps(CALCDA_SWIZZLE(a, 3, 3, 0, 0), b),
+            _mm_mul_ps(CALCDA_SWIZZLE(a, 1, 1, 2, 2),
+                       CALCDA_SWIZZLE(b, 2, 3, 0, 1)));
+    };
+    const auto multiplyAdjugate2 = [](__m128 a, __m128 b) {
+        return _mm_sub_ps(
+            _mm_mul_ps(a, CALCDA_SWIZZLE(b, 3, 0, 3, 0)),
+            _mm_mul_ps(CALCDA_SWIZZLE(a, 1, 0, 3, 2),
+                       CALCDA_SWIZZLE(b, 2, 1, 2, 1)));
+    };
+
+    const __m128 r0 = _mm_loadu_ps(In + 0);
+    const __m128 r1 = _mm_loadu_ps(In + 4);
+    const __m128 r2 = _mm_loadu_ps(In + 8);
+    const __m128 r3 = _mm_loadu_ps(In + 12);
+
+    const __m128 a = _mm_movelh_ps(r0, r1);
+    const __m128 b = _mm_movehl_ps(r1, r0);
+    const __m128 c = _mm_movelh_ps(r2, r3);
+    const __m128 d = _mm_movehl_ps(r3, r2);
+
+    // |A|, |B|, |C|, |D|
+    const __m128 subDeterminants =
+        _mm_sub_ps(_mm_mul_ps(CALCDA_SHUFFLE(r0, r2, 0, 2, 0, 2),
+                              CALCDA_SHUFFLE(r1, r3, 1, 3, 1, 3)),
+                   _mm_mul_ps(CALCDA_SHUFFLE(r0, r2, 1, 3, 1, 3),
+                              CALCDA_SHUFFLE(r1, r3, 0, 2, 0, 2)));
+    const __m128 detA = CALCDA_SWIZZLE(subDeterminants, 0, 0, 0, 0);
+    const __m128 detB = CALCDA_SWIZZLE(subDeterminants, 1, 1, 1, 1);
+    const __m128 detC = CALCDA_SWIZZLE(subDeterminants, 2, 2, 2, 2);
+    const __m128 detD = CALCDA_SWIZZLE(subDeterminants, 3, 3, 3, 3);
+
+    const __m128 dc = adjugateMultiply2(d, c);
+    const __m128 ab = adjugateMultiply2(a, b);
+
+    // adjugates of the blocks of the inverse
+    __m128 x = _mm_sub_ps(_mm_mul_ps(detD, a), multiply2(b, dc));
+    __m128 w = _mm_sub_ps(_mm_mul_ps(detA, d), multiply2(c, ab));
+    __m128 y = _mm_sub_ps(_mm_mul_ps(detB, c), multiplyAdjugate2(d, ab));
+    __m128 z = _mm_sub_ps(_mm_mul_ps(detC, b), multiplyAdjugate2(a, dc));
+
+    __m128 trace = _mm_mul_ps(ab, CALCDA_SWIZZLE(dc, 0, 2, 1, 3));
+    trace = _mm_add_ps(trace, CALCDA_SWIZZLE(trace, 2, 3, 0, 1));
+    trace = _mm_add_ps(trace, CALCDA_SWIZZLE(trace, 1, 0, 3, 2));
+
+    const __m128 determinant =
+        _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)),
+                   trace);
+
+    // the signs of the 2x2 adjugate
+    const __m128 scale =
+        _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), determinant);
+
+    x = _mm_mul_ps(x, scale);
+    y = _mm_mul_ps(y, scale);
+    z = _mm_mul_ps(z, scale);
+    w = _mm_mul_ps(w, scale);
+
+    _mm_storeu_ps(Out + 0, CALCDA_SHUFFLE(x, y, 3, 1, 3, 1));
+    _mm_storeu_ps(Out + 4, CALCDA_SHUFFLE(x, y, 2, 0, 2, 0));
+    _mm_storeu_ps(Out + 8, CALCDA_SHUFFLE(z, w, 3, 1, 3, 1));
+    _mm_storeu_ps(Out + 12, CALCDA_SHUFFLE(z, w, 2, 0, 2, 0));
+
+#undef CALCDA_SWIZZLE
+#undef CALCDA_SHUFFLE
+
+    return _mm_cvtss_f32(determinant);
+}
+
+/**
+ * @brief Stores the affine matrix with the upper 3x3 block given by the
+ * columns @c C0, @c C1, @c C2, and the translation @c T, to @c Out
+ */
+void storeAffineColumns(__m128 C0, __m128 C1, __m128 C2, __m128 T,
+                        float *Out) {
+    _MM_TRANSPOSE4_PS(C0, C1, C2, T);
+
+    _mm_storeu_ps(Out + 0, C0);
+    _mm_storeu_ps(Out + 4, C1);
+    _mm_storeu_ps(Out + 8, C2);
+    _mm_storeu_ps(Out + 12, _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f));
+}
+
+/**
+ * @brief Cross product of the X, Y, Z elements; the W element is 0
+ *
+ * W is cleared explicitly: Left.w * Right.w - Left.w * Right.w is not 0 when
+ * the compiler contracts it into a fused multiply-add.
+ */
+__m128 cross3(__m128 Left, __m128 Right) {
+    const __m128 product = _mm_sub_ps(
+        _mm_mul_ps(_mm_shuffle_ps(Left, Left, _MM_SHUFFLE(3, 0, 2, 1)),
+                   _mm_shuffle_ps(Right, Right, _MM_SHUFFLE(3, 1, 0, 2))),
+        _mm_mul_ps(_mm_shuffle_ps(Left, Left, _MM_SHUFFLE(3, 1, 0, 2)),
+                   _mm_shuffle_ps(Right, Right, _MM_SHUFFLE(3, 0, 2, 1))));
+
+    const __m128 xyz = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+    return _mm_and_ps(product, xyz);
+}
+
+//! @brief -(C0 * T.x + C1 * T.y + C2 * T.z), for the translation of an inverse
+__m128 negatedTransform(__m128 C0, __m128 C1, __m128 C2, __m128 T) {
+    const __m128 sum = _mm_add_ps(
+        _mm_add_ps(_mm_mul_ps(C0, _mm_shuffle_ps(T, T, 0x00)),
+                   _mm_mul_ps(C1, _mm_shuffle_ps(T, T, 0x55))),
+        _mm_mul_ps(C2, _mm_shuffle_ps(T, T, 0xAA)));
+
+    return _mm_sub_ps(_mm_setzero_ps(), sum);
+}
+
+//! @brief The SSE2 inverseAffineKernel for floats
+template <> void inverseAffineKernel(const float *In, float *Out) {
+    const __m128 r0 = _mm_loadu_ps(In + 0);
+    const __m128 r1 = _mm_loadu_ps(In + 4);
+    const __m128 r2 = _mm_loadu_ps(In + 8);
+
+    __m128 c0 = cross3(r1, r2);
+    __m128 c1 = cross3(r2, r0);
+    __m128 c2 = cross3(r0, r1);
+
+    // the W elements of the cross products are 0, so the dot product is 3D
+    __m128 determinant = _mm_mul_ps(r0, c0);
+    determinant = _mm_add_ps(
+        determinant, _mm_shuffle_ps(determinant, determinant, 0x4E));
+    determinant = _mm_add_ps(
+        determinant, _mm_shuffle_ps(determinant, determinant, 0xB1));
+
+    const __m128 scale = _mm_div_ps(_mm_set1_ps(1.0f), determinant);
+    c0 = _mm_mul_ps(c0, scale);
+    c1 = _mm_mul_ps(c1, scale);
+    c2 = _mm_mul_ps(c2, scale);
+
+    // the translation column of the input
+    __m128 t = _mm_unpackhi_ps(r0, r1);
+    t = _mm_shuffle_ps(t, r2, _MM_SHUFFLE(3, 3, 3, 2));
+
+    storeAffineColumns(c0, c1, c2, negatedTransform(c0, c1, c2, t), Out);
+}
+
+//! @brief The SSE2 inverseRigidKernel for floats
+template <> void inverseRigidKernel(const float *In, float *Out) {
+    const __m128 r0 = _mm_loadu_ps(In + 0);
+    const __m128 r1 = _mm_loadu_ps(In + 4);
+    const __m128 r2 = _mm_loadu_ps(In + 8);
+
+    __m128 t = _mm_unpackhi_ps(r0, r1);
+    t = _mm_shuffle_ps(t, r2, _MM_SHUFFLE(3, 3, 3, 2));
+
+    storeAffineColumns(r0, r1, r2, negatedTransform(r0, r1, r2, t), Out);
+}
+#endif
+} // namespace
+
+template <typename T> BasicMatrix4<T>::BasicMatrix4() {
     for (std::size_t index = 0; index < 16; ++index) {
         value.data[index] = 0.0f;
     }
 }
 
-Matrix4::Matrix4(const std::initializer_list<float> &List) {
+template <typename T>
+BasicMatrix4<T>::BasicMatrix4(const std::initializer_list<T> &List) {
     std::size_t count = 0;
     std::size_t rowCount = 0;
     std::size_t colCount = 0;
@@ -47,17 +803,20 @@ Matrix4::Matrix4(const std::initializer_list<float> &List) {
     }
 }
 
-Matrix4::Matrix4(const Matrix4 &Other) {
+template <typename T>
+BasicMatrix4<T>::BasicMatrix4(const BasicMatrix4 &Other) {
     for (std::size_t index = 0; index < 16; ++index) {
         value.data[index] = Other.value.data[index];
     }
 }
 
-Matrix4::Matrix4(const Matrix3 &Base) {
+template <typename T> BasicMatrix4<T>::BasicMatrix4(const Matrix3 &Base) {
     for (std::size_t row = 0; row < 3; ++row) {
         for (std::size_t column = 0; column < 3; ++column) {
             value.matrix[row][column] = Base.value.matrix[row][column];
         }
+
+        value.matrix[row][3] = 0.0f;
     }
 
     value.matrix[3][0] = 0.0f;
@@ -66,66 +825,72 @@ Matrix4::Matrix4(const Matrix3 &Base) {
     value.matrix[3][3] = 1.0f;
 }
 
-Matrix4::~Matrix4() {}
+template <typename T> BasicMatrix4<T>::~BasicMatrix4() {}
 
-Vector4 Matrix4::r01() const {
-    return Vector4(value.matrix[0][0], value.matrix[0][1], value.matrix[0][2],
-                   value.matrix[0][3]);
+template <typename T>
+BasicVector4<T> BasicMatrix4<T>::r01() const {
+    return BasicVector4<T>(value.matrix[0][0], value.matrix[0][1],
+                           value.matrix[0][2], value.matrix[0][3]);
 }
 
-Vector4 Matrix4::r02() const {
-    return Vector4(value.matrix[1][0], value.matrix[1][1], value.matrix[1][2],
-                   value.matrix[1][3]);
+template <typename T>
+BasicVector4<T> BasicMatrix4<T>::r02() const {
+    return BasicVector4<T>(value.matrix[1][0], value.matrix[1][1],
+                           value.matrix[1][2], value.matrix[1][3]);
 }
 
-Vector4 Matrix4::r03() const {
-    return Vector4(value.matrix[2][0], value.matrix[2][1], value.matrix[2][2],
-                   value.matrix[2][3]);
+template <typename T>
+BasicVector4<T> BasicMatrix4<T>::r03() const {
+    return BasicVector4<T>(value.matrix[2][0], value.matrix[2][1],
+                           value.matrix[2][2], value.matrix[2][3]);
 }
 
-Vector4 Matrix4::r04() const {
-    return Vector4(value.matrix[3][0], value.matrix[3][1], value.matrix[3][2],
-                   value.matrix[3][3]);
+template <typename T>
+BasicVector4<T> BasicMatrix4<T>::r04() const {
+    return BasicVector4<T>(value.matrix[3][0], value.matrix[3][1],
+                           value.matrix[3][2], value.matrix[3][3]);
 }
 
-Vector4 Matrix4::c01() const {
-    return Vector4(value.matrix[0][0], value.matrix[1][0], value.matrix[2][0],
-                   value.matrix[3][0]);
+template <typename T>
+BasicVector4<T> BasicMatrix4<T>::c01() const {
+    return BasicVector4<T>(value.matrix[0][0], value.matrix[1][0],
+                           value.matrix[2][0], value.matrix[3][0]);
 }
 
-Vector4 Matrix4::c02() const {
-    return Vector4(value.matrix[0][1], value.matrix[1][1], value.matrix[2][1],
-                   value.matrix[3][1]);
+template <typename T>
+BasicVector4<T> BasicMatrix4<T>::c02() const {
+    return BasicVector4<T>(value.matrix[0][1], value.matrix[1][1],
+                           value.matrix[2][1], value.matrix[3][1]);
 }
 
-Vector4 Matrix4::c03() const {
-    return Vector4(value.matrix[0][2], value.matrix[1][2], value.matrix[2][2],
-                   value.matrix[3][2]);
+template <typename T>
+BasicVector4<T> BasicMatrix4<T>::c03() const {
+    return BasicVector4<T>(value.matrix[0][2], value.matrix[1][2],
+                           value.matrix[2][2], value.matrix[3][2]);
 }
 
-Vector4 Matrix4::c04() const {
-    return Vector4(value.matrix[0][3], value.matrix[1][3], value.matrix[2][3],
-                   value.matrix[3][3]);
+template <typename T>
+BasicVector4<T> BasicMatrix4<T>::c04() const {
+    return BasicVector4<T>(value.matrix[0][3], value.matrix[1][3],
+                           value.matrix[2][3], value.matrix[3][3]);
 }
 
-float *Matrix4::getData() { return &value.data[0]; }
+template <typename T>
+T *BasicMatrix4<T>::getData() { return &value.data[0]; }
 
-const float *Matrix4::getData() const { return &value.data[0]; }
+template <typename T>
+const T *BasicMatrix4<T>::getData() const { return &value.data[0]; }
 
-Matrix4 &Matrix4::selfMultiply(const Matrix4 &Other) {
-    for (unsigned int i = 0U; i < 4U; i++) {
-        for (unsigned int j = 0U; j < 4U; j++) {
-            for (unsigned int k = 0U; k < 4U; k++) {
-                value.matrix[i][k] *= Other.value.matrix[k][j];
-            }
-        }
-    }
+template <typename T>
+BasicMatrix4<T> &BasicMatrix4<T>::selfMultiply(const BasicMatrix4 &Other) {
+    multiplyKernel(value.data, Other.value.data, value.data);
 
     return *this;
 }
 
-Matrix4 &Matrix4::selfDivide(const Matrix4 &Other) {
-    Matrix4 temporal = Other.calculateInverseTemporal();
+template <typename T>
+BasicMatrix4<T> &BasicMatrix4<T>::selfDivide(const BasicMatrix4 &Other) {
+    BasicMatrix4 temporal = Other.calculateInverseTemporal();
     double determinant = Other.calculateDeterminant(&temporal);
 
     if (determinant != 0.0) {
@@ -135,8 +900,9 @@ Matrix4 &Matrix4::selfDivide(const Matrix4 &Other) {
     }
 }
 
-Matrix4 Matrix4::calculateInverseTemporal() const {
-    Matrix4 result;
+template <typename T>
+BasicMatrix4<T> BasicMatrix4<T>::calculateInverseTemporal() const {
+    BasicMatrix4 result;
 
     result.value.data[0] = (value.data[5] * value.data[10] * value.data[15] -
                             value.data[5] * value.data[11] * value.data[14] -
@@ -253,8 +1019,9 @@ Matrix4 Matrix4::calculateInverseTemporal() const {
     return result;
 }
 
-double Matrix4::calculateDeterminant(Matrix4 *iTemporal) const {
-    Matrix4 temporal;
+template <typename T>
+double BasicMatrix4<T>::calculateDeterminant(BasicMatrix4 *iTemporal) const {
+    BasicMatrix4 temporal;
     if (iTemporal == nullptr) {
         temporal = calculateInverseTemporal();
     } else {
@@ -264,13 +1031,15 @@ double Matrix4::calculateDeterminant(Matrix4 *iTemporal) const {
     return value.data[0] * temporal.value.data[0] +
            value.data[1] * temporal.value.data[4] +
            value.data[2] * temporal.value.data[8] +
-           value.data[3] * temporal.value.data[1];
+           value.data[3] * temporal.value.data[12];
 }
 
-Matrix4 Matrix4::inverse(Matrix4 *iTemporal, double *iDeterminant) const {
-    Matrix4 result;
+template <typename T>
+BasicMatrix4<T>
+BasicMatrix4<T>::inverse(BasicMatrix4 *iTemporal, double *iDeterminant) const {
+    BasicMatrix4 result;
 
-    Matrix4 temporal;
+    BasicMatrix4 temporal;
     double determinant = 0.0;
 
     if (iTemporal == nullptr) {
@@ -286,91 +1055,184 @@ Matrix4 Matrix4::inverse(Matrix4 *iTemporal, double *iDeterminant) const {
     }
 
     if (determinant == 0.0) {
-        return Matrix4::Identity;
+        return BasicMatrix4::Identity;
     } else {
         determinant = 1.0 / determinant;
 
         for (unsigned int i = 0U; i < 16U; i++) {
             result.value.data[i] =
-                static_cast<float>(temporal.value.data[i] * determinant);
+                static_cast<T>(temporal.value.data[i] * determinant);
         }
 
         return result;
     }
 }
 
-Matrix4 Matrix4::divide(const Matrix4 &Other) const {
-    Matrix4 Temporal = Other.calculateInverseTemporal();
+template <typename T>
+BasicMatrix4<T> BasicMatrix4<T>::inverseUnchecked() const {
+    BasicMatrix4 result;
+    inverseKernel(value.data, result.value.data);
+
+    return result;
+}
+
+template <typename T>
+std::optional<BasicMatrix4<T>> BasicMatrix4<T>::inverseChecked() const {
+    BasicMatrix4 result;
+    const T determinant = inverseKernel(value.data, result.value.data);
+
+    if (determinant == 0.0f || !std::isfinite(determinant)) {
+        return std::nullopt;
+    }
+
+    return result;
+}
+
+template <typename T>
+BasicMatrix4<T> BasicMatrix4<T>::inverseAffine() const {
+    BasicMatrix4 result;
+    inverseAffineKernel(value.data, result.value.data);
+
+    return result;
+}
+
+template <typename T>
+BasicMatrix4<T> BasicMatrix4<T>::inverseRigid() const {
+    BasicMatrix4 result;
+    inverseRigidKernel(value.data, result.value.data);
+
+    return result;
+}
+
+template <typename T>
+BasicMatrix4<T> BasicMatrix4<T>::divide(const BasicMatrix4 &Other) const {
+    BasicMatrix4 Temporal = Other.calculateInverseTemporal();
     double Determinant = Other.calculateDeterminant(&Temporal);
 
     if (Determinant == 0.0) {
-        return Matrix4();
+        return BasicMatrix4();
     } else {
         return multiply(Other.inverse(&Temporal, &Determinant));
     }
 }
 
-Vector4 Matrix4::multiply(const Vector4 &Other) const {
-    const float X = (value.m00 * Other.x) + (value.m01 * Other.y) +
-                    (value.m02 * Other.z) + (value.m03 * Other.w);
-    const float Y = (value.m10 * Other.x) + (value.m11 * Other.y) +
-                    (value.m12 * Other.z) + (value.m13 * Other.w);
-    const float Z = (value.m20 * Other.x) + (value.m21 * Other.y) +
-                    (value.m22 * Other.z) + (value.m23 * Other.w);
-    const float W = (value.m30 * Other.x) + (value.m31 * Other.y) +
-                    (value.m32 * Other.z) + (value.m33 * Other.w);
+template <typename T>
+BasicVector4<T> BasicMatrix4<T>::multiply(const BasicVector4<T> &Other) const {
+    const T X = (value.m00 * Other.x) + (value.m01 * Other.y) +
+                (value.m02 * Other.z) + (value.m03 * Other.w);
+    const T Y = (value.m10 * Other.x) + (value.m11 * Other.y) +
+                (value.m12 * Other.z) + (value.m13 * Other.w);
+    const T Z = (value.m20 * Other.x) + (value.m21 * Other.y) +
+                (value.m22 * Other.z) + (value.m23 * Other.w);
+    const T W = (value.m30 * Other.x) + (value.m31 * Other.y) +
+                (value.m32 * Other.z) + (value.m33 * Other.w);
+
+    return BasicVector4<T>(X, Y, Z, W);
+}
 
-    return Vector4(X, Y, Z, W);
+template <typename T>
+void
+BasicMatrix4<T>::transformBatch(const BasicVector4<T> *In, BasicVector4<T> *Out,
+                                std::size_t Count, std::size_t InStride,
+                                std::size_t OutStride) const {
+    transformKernel<4, false>(
+        value.data, reinterpret_cast<const unsigned char *>(In),
+        InStride == 0 ? sizeof(BasicVector4<T>) : InStride,
+        reinterpret_cast<unsigned char *>(Out),
+        OutStride == 0 ? sizeof(BasicVector4<T>) : OutStride, Count);
 }
 
-Matrix4 Matrix4::multiply(const Matrix4 &Other) const {
-    Matrix4 result;
+template <typename T>
+void
+BasicMatrix4<T>::transformPoints(const BasicVector3<T> *In,
+                                 BasicVector3<T> *Out, std::size_t Count,
+                                 std::size_t InStride,
+                                 std::size_t OutStride) const {
+    transformKernel<3, true>(
+        value.data, reinterpret_cast<const unsigned char *>(In),
+        InStride == 0 ? sizeof(BasicVector3<T>) : InStride,
+        reinterpret_cast<unsigned char *>(Out),
+        OutStride == 0 ? sizeof(BasicVector3<T>) : OutStride, Count);
+}
+
+template <typename T>
+void
+BasicMatrix4<T>::transformDirections(const BasicVector3<T> *In,
+                                     BasicVector3<T> *Out, std::size_t Count,
+                                     std::size_t InStride,
+                                     std::size_t OutStride) const {
+    transformKernel<3, false>(
+        value.data, reinterpret_cast<const unsigned char *>(In),
+        InStride == 0 ? sizeof(BasicVector3<T>) : InStride,
+        reinterpret_cast<unsigned char *>(Out),
+        OutStride == 0 ? sizeof(BasicVector3<T>) : OutStride, Count);
+}
+
+template <typename T>
+BasicMatrix4<T> BasicMatrix4<T>::multiply(const BasicMatrix4 &Other) const {
+    // the kernel overwrites every element; copying is cheaper than zeroing,
+    // which compilers turn into rep stos for 16 doubles
+    BasicMatrix4 result(*this);
+
+    multiplyKernel(value.data, Other.value.data, result.value.data);
 
-    for (unsigned int i = 0U; i < 4U; i++) {
-        for (unsigned int j = 0U; j < 4U; j++) {
-            for (unsigned int k = 0U; k < 4U; k++) {
-                result.value.matrix[i][j] +=
-                    value.matrix[i][k] * Other.value.matrix[k][j];
-            }
-        }
-    }
     return result;
 }
 
-Matrix4 Matrix4::transpose() const {
-    return Matrix4{value.m00, value.m10, value.m20, value.m30,
-                   value.m01, value.m11, value.m21, value.m31,
-                   value.m02, value.m12, value.m22, value.m32,
-                   value.m03, value.m13, value.m23, value.m33};
+template <typename T>
+BasicMatrix4<T> BasicMatrix4<T>::transpose() const {
+    return BasicMatrix4{value.m00, value.m10, value.m20, value.m30,
+                        value.m01, value.m11, value.m21, value.m31,
+                        value.m02, value.m12, value.m22, value.m32,
+                        value.m03, value.m13, value.m23, value.m33};
 }
 
-Matrix4 Matrix4::negate() const {
-    return Matrix4{-value.m00, -value.m01, -value.m02, -value.m03,
-                   -value.m10, -value.m11, -value.m12, -value.m13,
-                   -value.m20, -value.m21, -value.m22, -value.m23,
-                   -value.m30, -value.m31, -value.m32, -value.m33};
+template <typename T>
+BasicMatrix4<T> BasicMatrix4<T>::negate() const {
+    return BasicMatrix4{-value.m00, -value.m01, -value.m02, -value.m03,
+                        -value.m10, -value.m11, -value.m12, -value.m13,
+                        -value.m20, -value.m21, -value.m22, -value.m23,
+                        -value.m30, -value.m31, -value.m32, -value.m33};
 }
 
-Matrix4 Matrix4::operator-() const { return negate(); }
+template <typename T>
+BasicMatrix4<T> BasicMatrix4<T>::operator-() const { return negate(); }
 
-Matrix4 Matrix4::operator/(const Matrix4 &x) const { return divide(x); }
+template <typename T>
+BasicMatrix4<T> BasicMatrix4<T>::operator/(const BasicMatrix4 &x) const {
+    return divide(x);
+}
 
-Matrix4 Matrix4::operator*(const Matrix4 &x) const { return multiply(x); }
+template <typename T>
+BasicMatrix4<T> BasicMatrix4<T>::operator*(const BasicMatrix4 &x) const {
+    return multiply(x);
+}
 
-Vector4 Matrix4::operator*(const Vector4 &x) const { return multiply(x); }
+template <typename T>
+BasicVector4<T> BasicMatrix4<T>::operator*(const BasicVector4<T> &x) const {
+    return multiply(x);
+}
 
-Matrix4 &Matrix4::operator/=(const Matrix4 &x) { return selfDivide(x); }
+template <typename T>
+BasicMatrix4<T> &BasicMatrix4<T>::operator/=(const BasicMatrix4 &x) {
+    return selfDivide(x);
+}
 
-Matrix4 &Matrix4::operator*=(const Matrix4 &x) { return selfMultiply(x); }
+template <typename T>
+BasicMatrix4<T> &BasicMatrix4<T>::operator*=(const BasicMatrix4 &x) {
+    return selfMultiply(x);
+}
 
-Matrix4 &Matrix4::operator=(const Matrix4 &Other) {
+template <typename T>
+BasicMatrix4<T> &BasicMatrix4<T>::operator=(const BasicMatrix4 &Other) {
     for (unsigned int Iterator = 0; Iterator < 16; ++Iterator) {
         value.data[Iterator] = Other.value.data[Iterator];
     }
     return *this;
 }
 
-bool Matrix4::operator==(const Matrix4 &Other) const {
+template <typename T>
+bool BasicMatrix4<T>::operator==(const BasicMatrix4 &Other) const {
     return (value.m00 == Other.value.m00 && value.m01 == Other.value.m01 &&
             value.m02 == Other.value.m02 && value.m03 == Other.value.m03 &&
             value.m10 == Other.value.m10 && value.m11 == Other.value.m11 &&
@@ -381,7 +1243,8 @@ bool Matrix4::operator==(const Matrix4 &Other) const {
             value.m32 == Other.value.m32 && value.m33 == Other.value.m33);
 }
 
-bool Matrix4::operator!=(const Matrix4 &Other) const {
+template <typename T>
+bool BasicMatrix4<T>::operator!=(const BasicMatrix4 &Other) const {
     return (value.m00 != Other.value.m00 || value.m01 != Other.value.m01 ||
             value.m02 != Other.value.m02 || value.m03 != Other.value.m03 ||
             value.m10 != Other.value.m10 || value.m11 != Other.value.m11 ||
@@ -392,68 +1255,70 @@ bool Matrix4::operator!=(const Matrix4 &Other) const {
             value.m32 != Other.value.m32 || value.m33 != Other.value.m33);
 }
 
-Matrix4 Matrix4::rotation(Axis x, double value) {
+template <typename T>
+BasicMatrix4<T> BasicMatrix4<T>::rotation(Axis x, double value) {
     switch (x) {
         case Axis::X:
-            return Matrix4{1.0f,
-                           0.0f,
-                           0.0f,
-                           0.0f,
-                           0.0f,
-                           static_cast<float>(std::cos(-value)),
-                           static_cast<float>(-std::sin(-value)),
-                           0.0f,
-                           0.0f,
-                           static_cast<float>(std::sin(-value)),
-                           static_cast<float>(std::cos(-value)),
-                           0.0f,
-                           0.0f,
-                           0.0f,
-                           0.0f,
-                           1.0f};
+            return BasicMatrix4{1.0f,
+                                0.0f,
+                                0.0f,
+                                0.0f,
+                                0.0f,
+                                static_cast<T>(std::cos(-value)),
+                                static_cast<T>(-std::sin(-value)),
+                                0.0f,
+                                0.0f,
+                                static_cast<T>(std::sin(-value)),
+                                static_cast<T>(std::cos(-value)),
+                                0.0f,
+                                0.0f,
+                                0.0f,
+                                0.0f,
+                                1.0f};
 
         case Axis::Y:
-            return Matrix4{static_cast<float>(std::cos(-value)),
-                           0.0f,
-                           static_cast<float>(std::sin(-value)),
-                           0.0f,
-                           0.0f,
-                           1.0f,
-                           0.0f,
-                           0.0f,
-                           static_cast<float>(-std::sin(-value)),
-                           0.0f,
-                           static_cast<float>(std::cos(-value)),
-                           0.0f,
-                           0.0f,
-                           0.0f,
-                           0.0f,
-                           1.0f};
+            return BasicMatrix4{static_cast<T>(std::cos(-value)),
+                                0.0f,
+                                static_cast<T>(std::sin(-value)),
+                                0.0f,
+                                0.0f,
+                                1.0f,
+                                0.0f,
+                                0.0f,
+                                static_cast<T>(-std::sin(-value)),
+                                0.0f,
+                                static_cast<T>(std::cos(-value)),
+                                0.0f,
+                                0.0f,
+                                0.0f,
+                                0.0f,
+                                1.0f};
 
         case Axis::Z:
-            return Matrix4{static_cast<float>(std::cos(-value)),
-                           static_cast<float>(-std::sin(-value)),
-                           0.0f,
-                           0.0f,
-                           static_cast<float>(std::sin(-value)),
-                           static_cast<float>(std::cos(-value)),
-                           0.0f,
-                           0.0f,
-                           0.0f,
-                           0.0f,
-                           1.0f,
-                           0.0f,
-                           0.0f,
-                           0.0f,
-                           0.0f,
-                           1.0f};
+            return BasicMatrix4{static_cast<T>(std::cos(-value)),
+                                static_cast<T>(-std::sin(-value)),
+                                0.0f,
+                                0.0f,
+                                static_cast<T>(std::sin(-value)),
+                                static_cast<T>(std::cos(-value)),
+                                0.0f,
+                                0.0f,
+                                0.0f,
+                                0.0f,
+                                1.0f,
+                                0.0f,
+                                0.0f,
+                                0.0f,
+                                0.0f,
+                                1.0f};
         default:
-            return Matrix4::Identity;
+            return BasicMatrix4::Identity;
     }
 }
 
-Matrix4 Matrix4::translation(float X, float Y, float Z) {
-    Matrix4 result = Matrix4::Identity;
+template <typename T>
+BasicMatrix4<T> BasicMatrix4<T>::translation(T X, T Y, T Z) {
+    BasicMatrix4 result = BasicMatrix4::Identity;
 
     result.value.m03 = X;
     result.value.m13 = Y;
@@ -462,8 +1327,9 @@ Matrix4 Matrix4::translation(float X, float Y, float Z) {
     return result;
 }
 
-Matrix4 Matrix4::translation(Vector3 Point) {
-    Matrix4 result = Matrix4::Identity;
+template <typename T>
+BasicMatrix4<T> BasicMatrix4<T>::translation(BasicVector3<T> Point) {
+    BasicMatrix4 result = BasicMatrix4::Identity;
 
     result.value.m03 = Point.x;
     result.value.m13 = Point.y;
@@ -472,8 +1338,9 @@ Matrix4 Matrix4::translation(Vector3 Point) {
     return result;
 }
 
-Matrix4 Matrix4::scale(float X, float Y, float Z) {
-    Matrix4 result = Matrix4::Identity;
+template <typename T>
+BasicMatrix4<T> BasicMatrix4<T>::scale(T X, T Y, T Z) {
+    BasicMatrix4 result = BasicMatrix4::Identity;
 
     result.value.m00 = X;
     result.value.m11 = Y;
@@ -482,8 +1349,9 @@ Matrix4 Matrix4::scale(float X, float Y, float Z) {
     return result;
 }
 
-Matrix4 Matrix4::scale(Vector3 Point) {
-    Matrix4 result = Matrix4::Identity;
+template <typename T>
+BasicMatrix4<T> BasicMatrix4<T>::scale(BasicVector3<T> Point) {
+    BasicMatrix4 result = BasicMatrix4::Identity;
 
     result.value.m00 = Point.x;
     result.value.m11 = Point.y;
@@ -492,46 +1360,55 @@ Matrix4 Matrix4::scale(Vector3 Point) {
     return result;
 }
 
-Matrix4 Matrix4::orthographic(float left, float right, float top, float bottom,
-                              float nearplane, float farplane) {
-
-    return Matrix4{2.0f / (right - left),
-                   0.0f,
-                   0.0f,
-                   -((right + left) / (right - left)),
-                   0.0f,
-                   2.0f / (top - bottom),
-                   0.0f,
-                   -((top + bottom) / (top - bottom)),
-                   0.0f,
-                   0.0f,
-                   -2.0f / (farplane - nearplane),
-                   -((farplane + nearplane) / (farplane - nearplane)),
-                   0.0f,
-                   0.0f,
-                   0.0f,
-                   1.0f};
+template <typename T>
+BasicMatrix4<T>
+BasicMatrix4<T>::orthographic(T left, T right, T top, T bottom, T nearplane,
+                              T farplane) {
+
+    return BasicMatrix4{2.0f / (right - left),
+                        0.0f,
+                        0.0f,
+                        -((right + left) / (right - left)),
+                        0.0f,
+                        2.0f / (top - bottom),
+                        0.0f,
+                        -((top + bottom) / (top - bottom)),
+                        0.0f,
+                        0.0f,
+                        -2.0f / (farplane - nearplane),
+                        -((farplane + nearplane) / (farplane - nearplane)),
+                        0.0f,
+                        0.0f,
+                        0.0f,
+                        1.0f};
 }
 
 // https://www.opengl.org/discussion_boards/showthread.php/172280-Constructing-an-orthographic-matrix-for-2D-drawing
 
-Matrix4 Matrix4::lookAt(Vector3 Eye, Vector3 Center, Vector3 Up) {
-    const Vector3 forward = (Center - Eye).normalize();
-    const Vector3 side = Vector3::cross(forward, Up).normalize();
-    const Vector3 top = Vector3::cross(side, forward);
-
-    return Matrix4{side.x, side.y, side.z,     0.0f,       top.x,      top.y,
-                   top.z,  0.0f,   -forward.x, -forward.y, -forward.z, 0.0f,
-                   0.0f,   0.0f,   0.0f,       1.0f} *
-           Matrix4::translation(-Eye);
+template <typename T>
+BasicMatrix4<T>
+BasicMatrix4<T>::lookAt(BasicVector3<T> Eye, BasicVector3<T> Center,
+                        BasicVector3<T> Up) {
+    const BasicVector3<T> forward = (Center - Eye).normalize();
+    const BasicVector3<T> side =
+        BasicVector3<T>::cross(forward, Up).normalize();
+    const BasicVector3<T> top = BasicVector3<T>::cross(side, forward);
+
+    return BasicMatrix4{side.x,     side.y,     side.z,     0.0f,
+                        top.x,      top.y,      top.z,      0.0f,
+                        -forward.x, -forward.y, -forward.z, 0.0f,
+                        0.0f,       0.0f,       0.0f,       1.0f} *
+           BasicMatrix4::translation(-Eye);
 }
 
-Matrix4 Matrix4::frustum(float left, float right, float top, float bottom,
-                         float nearPlane, float farPlane) {
+template <typename T>
+BasicMatrix4<T>
+BasicMatrix4<T>::frustum(T left, T right, T top, T bottom, T nearPlane,
+                         T farPlane) {
     /* ~[glhFrustumf2] : https://www.khronos.org/opengl/wiki/GluPerspective_code
      */
 
-    Matrix4 result;
+    BasicMatrix4 result;
 
     result.value.matrix[0][0] = (2.0f * nearPlane) / (right - left);
     result.value.matrix[1][0] = 0.0f;
@@ -555,47 +1432,54 @@ Matrix4 Matrix4::frustum(float left, float right, float top, float bottom,
     return result;
 }
 
-Matrix4 Matrix4::perspective(float fovyInRadians, float aspectRatio,
-                             float nearPlane, float farPlane) {
-    float ymax = nearPlane * tanf(fovyInRadians);
-    float ymin = -ymax;
-    float xmin = -ymax * aspectRatio;
-    float xmax = ymax * aspectRatio;
+template <typename T>
+BasicMatrix4<T>
+BasicMatrix4<T>::perspective(T fovyInRadians, T aspectRatio, T nearPlane,
+                             T farPlane) {
+    T ymax = nearPlane * std::tan(fovyInRadians);
+    T ymin = -ymax;
+    T xmin = -ymax * aspectRatio;
+    T xmax = ymax * aspectRatio;
 
     return frustum(xmin, xmax, ymin, ymax, nearPlane, farPlane);
 }
 
-Matrix4 Matrix4::perspectiveFlippedY(float fovyInRadians, float aspectRatio,
-                                     float nearPlane, float farPlane) {
-    float ymax = nearPlane * tanf(fovyInRadians);
-    float ymin = -ymax;
-    float xmin = -ymax * aspectRatio;
-    float xmax = ymax * aspectRatio;
+template <typename T>
+BasicMatrix4<T>
+BasicMatrix4<T>::perspectiveFlippedY(T fovyInRadians, T aspectRatio,
+                                     T nearPlane, T farPlane) {
+    T ymax = nearPlane * std::tan(fovyInRadians);
+    T ymin = -ymax;
+    T xmin = -ymax * aspectRatio;
+    T xmax = ymax * aspectRatio;
 
     return frustum(xmin, xmax, ymax, ymin, nearPlane, farPlane);
 }
 
-Matrix4 Matrix4::projection(float left, float right, float top, float bottom,
-                            float nearPlane, float farPlane) {
-    return Matrix4{(2 * nearPlane) / (right - left),
-                   0.0,
-                   (right + left) / (right - left),
-                   0.0,
-                   0.0,
-                   (2 * nearPlane) / (top - bottom),
-                   (top + bottom) / (top - bottom),
-                   0.0,
-                   0.0,
-                   0.0,
-                   -(farPlane + nearPlane) / (farPlane - nearPlane),
-                   (-2.0f * farPlane * nearPlane) / (farPlane - nearPlane),
-                   0.0,
-                   0.0,
-                   -1.0,
-                   0.0};
-}
-
-std::string Matrix4::toString() const {
+template <typename T>
+BasicMatrix4<T>
+BasicMatrix4<T>::projection(T left, T right, T top, T bottom, T nearPlane,
+                            T farPlane) {
+    return BasicMatrix4{(2 * nearPlane) / (right - left),
+                        0.0,
+                        (right + left) / (right - left),
+                        0.0,
+                        0.0,
+                        (2 * nearPlane) / (top - bottom),
+                        (top + bottom) / (top - bottom),
+                        0.0,
+                        0.0,
+                        0.0,
+                        -(farPlane + nearPlane) / (farPlane - nearPlane),
+                        (-2.0f * farPlane * nearPlane) / (farPlane - nearPlane),
+                        0.0,
+                        0.0,
+                        -1.0,
+                        0.0};
+}
+
+template <typename T>
+std::string BasicMatrix4<T>::toString() const {
     std::stringstream stream;
     stream << std::fixed << std::setprecision(2) << "[";
 
@@ -622,8 +1506,9 @@ std::string Matrix4::toString() const {
     return stream.str();
 }
 
-std::string Matrix4::toStringO(unsigned int Padding,
-                               unsigned int Precision) const {
+template <typename T>
+std::string
+BasicMatrix4<T>::toStringO(unsigned int Padding, unsigned int Precision) const {
     const std::string paddingString = std::string(Padding, ' ');
 
     std::stringstream stream;
@@ -650,7 +1535,11 @@ std::string Matrix4::toStringO(unsigned int Padding,
 
 //* STATIC VARIABLE *//
 
-const Matrix4 Matrix4::Identity =
-    Matrix4{1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
-            0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f};
-} // namespace Calcda
\ No newline at end of file
+template <typename T>
+const BasicMatrix4<T> BasicMatrix4<T>::Identity =
+    BasicMatrix4{1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+                 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f};
+
+template class BasicMatrix4<float>;
+template class BasicMatrix4<double>;
+} // namespace Calcda
@@ -0,0 +1,310 @@
+#include "Predicates.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+/*
+ * The error-free transformations below rely on every operation being rounded
+ * on its own; the build turns off floating-point contraction for this file,
+ * so no multiply and add is fused.
+ */
+
+namespace Calcda {
+
+namespace Predicates {
+namespace {
+// half an ulp of 1 in double precision
+constexpr double Epsilon = 1.0 / 9007199254740992.0;
+
+// 2^27 + 1, splits a double into two halves of 26 bits
+constexpr double Splitter = 134217729.0;
+
+// bound of the error of the double precision incircle, from Shewchuk
+constexpr double IncircleBound = (10.0 + 96.0 * Epsilon) * Epsilon;
+
+// a + b = x + y exactly, with |a| >= |b|
+inline void fastTwoSum(double a, double b, double &x, double &y) {
+    x = a + b;
+    y = b - (x - a);
+}
+
+// a + b = x + y exactly
+inline void twoSum(double a, double b, double &x, double &y) {
+    x = a + b;
+    const double bVirtual = x - a, aVirtual = x - bVirtual;
+    y = (a - aVirtual) + (b - bVirtual);
+}
+
+// a - b = x + y exactly
+inline void twoDiff(double a, double b, double &x, double &y) {
+    x = a - b;
+    const double bVirtual = a - x, aVirtual = x + bVirtual;
+    y = (a - aVirtual) + (bVirtual - b);
+}
+
+inline void split(double a, double &high, double &low) {
+    const double c = Splitter * a;
+    high = c - (c - a);
+    low = a - high;
+}
+
+// a * b = x + y exactly
+inline void twoProduct(double a, double b, double &x, double &y) {
+    x = a * b;
+
+    double aHigh, aLow, bHigh, bLow;
+    split(a, aHigh, aLow);
+    split(b, bHigh, bLow);
+
+    const double error1 = x - aHigh * bHigh, error2 = error1 - aLow * bHigh,
+                 error3 = error2 - aHigh * bLow;
+    y = aLow * bLow - error3;
+}
+
+/*
+ * An expansion of at most N components, on the stack; the capacities of the
+ * results follow from those of the operands, so no call allocates
+ */
+template <std::size_t N> struct Expansion {
+    double components[N];
+    std::size_t size = 0;
+};
+
+Expansion<2> difference(double a, double b) {
+    Expansion<2> result;
+    double x, y;
+    twoDiff(a, b, x, y);
+
+    if (y != 0.0)
+        result.components[result.size++] = y;
+    if (x != 0.0)
+        result.components[result.size++] = x;
+
+    return result;
+}
+
+template <std::size_t N, std::size_t M>
+Expansion<N + M> sum(const Expansion<N> &e, const Expansion<M> &f) {
+    Expansion<N + M> result;
+    result.size = Internal::expansionSum(e.size, e.components, f.size,
+                                         f.components, result.components);
+    return result;
+}
+
+template <std::size_t N>
+Expansion<2 * N> scale(const Expansion<N> &e, double b) {
+    Expansion<2 * N> result;
+    result.size =
+        Internal::expansionScale(e.size, e.components, b, result.components);
+    return result;
+}
+
+// the sum of e scaled by each component of f
+template <std::size_t N, std::size_t M>
+Expansion<2 * N * M> product(const Expansion<N> &e, const Expansion<M> &f) {
+    Expansion<2 * N * M> partials[2];
+    std::size_t current = 0;
+
+    for (std::size_t i = 0; i < f.size; ++i) {
+        const auto scaled = scale(e, f.components[i]);
+        const auto &from = partials[current];
+        auto &to = partials[1 - current];
+
+        to.size = Internal::expansionSum(from.size, from.components,
+                                         scaled.size, scaled.components,
+                                         to.components);
+        current = 1 - current;
+    }
+
+    return partials[current];
+}
+
+template <std::size_t N> Expansion<N> negate(Expansion<N> e) {
+    for (std::size_t i = 0; i < e.size; ++i)
+        e.components[i] = -e.components[i];
+
+    return e;
+}
+
+template <std::size_t N> double estimate(const Expansion<N> &e) {
+    return Internal::expansionEstimate(e.size, e.components);
+}
+
+double incircleExact(Vector2 A, Vector2 B, Vector2 C, Vector2 D) {
+    const auto adx = difference(A.x, D.x), ady = difference(A.y, D.y),
+               bdx = difference(B.x, D.x), bdy = difference(B.y, D.y),
+               cdx = difference(C.x, D.x), cdy = difference(C.y, D.y);
+
+    const auto lift = [](const Expansion<2> &x, const Expansion<2> &y) {
+        return sum(product(x, x), product(y, y));
+    };
+    const auto cross = [](const Expansion<2> &x1, const Expansion<2> &y1,
+                          const Expansion<2> &x2, const Expansion<2> &y2) {
+        return sum(product(x1, y2), negate(product(x2, y1)));
+    };
+
+    return estimate(
+        sum(sum(product(lift(adx, ady), cross(bdx, bdy, cdx, cdy)),
+                product(lift(bdx, bdy), cross(cdx, cdy, adx, ady))),
+            product(lift(cdx, cdy), cross(adx, ady, bdx, bdy))));
+}
+} // namespace
+
+namespace Internal {
+// Shewchuk's fast_expansion_sum_zeroelim: merges by magnitude, then sums
+std::size_t expansionSum(std::size_t ESize, const double *E, std::size_t FSize,
+                         const double *F, double *H) {
+    if (ESize == 0 || FSize == 0) {
+        const double *source = ESize == 0 ? F : E;
+        const std::size_t size = ESize == 0 ? FSize : ESize;
+        std::copy(source, source + size, H);
+        return size;
+    }
+
+    std::size_t i = 0, j = 0, size = 0;
+    const auto next = [&]() {
+        if (j == FSize || (i < ESize && std::abs(E[i]) < std::abs(F[j])))
+            return E[i++];
+        return F[j++];
+    };
+
+    double q = next(), qNew, h;
+    const std::size_t count = ESize + FSize;
+
+    if (i + j < count) {
+        fastTwoSum(next(), q, qNew, h);
+        q = qNew;
+        if (h != 0.0)
+            H[size++] = h;
+    }
+
+    while (i + j < count) {
+        twoSum(q, next(), qNew, h);
+        q = qNew;
+        if (h != 0.0)
+            H[size++] = h;
+    }
+
+    if (q != 0.0 || size == 0)
+        H[size++] = q;
+
+    return size;
+}
+
+// Shewchuk's scale_expansion_zeroelim
+std::size_t expansionScale(std::size_t ESize, const double *E, double B,
+                           double *H) {
+    if (ESize == 0)
+        return 0;
+
+    std::size_t size = 0;
+    double q, h;
+    twoProduct(E[0], B, q, h);
+    if (h != 0.0)
+        H[size++] = h;
+
+    for (std::size_t i = 1; i < ESize; ++i) {
+        double product, productTail, total;
+        twoProduct(E[i], B, product, productTail);
+
+        twoSum(q, productTail, total, h);
+        if (h != 0.0)
+            H[size++] = h;
+
+        fastTwoSum(product, total, q, h);
+        if (h != 0.0)
+            H[size++] = h;
+    }
+
+    if (q != 0.0 || size == 0)
+        H[size++] = q;
+
+    return size;
+}
+
+// the most significant component has the sign, the sum the magnitude
+double expansionEstimate(std::size_t ESize, const double *E) {
+    if (ESize == 0 || E[ESize - 1] == 0.0)
+        return 0.0;
+
+    double result = 0.0;
+    for (std::size_t i = 0; i < ESize; ++i)
+        result += E[i];
+
+    return std::signbit(result) == std::signbit(E[ESize - 1]) ? result
+                                                              : E[ESize - 1];
+}
+
+std::size_t cross2dExpansion(Vector2 A, Vector2 B, Vector2 C, Vector2 D,
+                             double *H) {
+    const auto right = product(difference(B.y, A.y), difference(D.x, C.x));
+    const auto left = sum(product(difference(B.x, A.x), difference(D.y, C.y)),
+                          negate(right));
+    static_assert(sizeof(left.components) <=
+                      CrossExpansionSize * sizeof(double),
+                  "cross2dExpansion writes past CrossExpansionSize");
+
+    std::copy(left.components, left.components + left.size, H);
+    return left.size;
+}
+
+double cross2dExact(Vector2 A, Vector2 B, Vector2 C, Vector2 D) {
+    /*
+     * Collinear and shared points land here on every call; their differences
+     * and products are usually exact in double precision, and then the sign
+     * of the rounded difference of the products is exact too
+     */
+    double bax, bay, dcx, dcy, baxTail, bayTail, dcxTail, dcyTail;
+    twoDiff(B.x, A.x, bax, baxTail);
+    twoDiff(B.y, A.y, bay, bayTail);
+    twoDiff(D.x, C.x, dcx, dcxTail);
+    twoDiff(D.y, C.y, dcy, dcyTail);
+
+    if (baxTail == 0.0 && bayTail == 0.0 && dcxTail == 0.0 &&
+        dcyTail == 0.0) {
+        double left, leftTail, right, rightTail;
+        twoProduct(bax, dcy, left, leftTail);
+        twoProduct(bay, dcx, right, rightTail);
+
+        if (leftTail == 0.0 && rightTail == 0.0)
+            return left - right;
+    }
+
+    Expansion<CrossExpansionSize> result;
+    result.size = cross2dExpansion(A, B, C, D, result.components);
+    return estimate(result);
+}
+} // namespace Internal
+
+double incircle(Vector2 A, Vector2 B, Vector2 C, Vector2 D) {
+    const double adx = static_cast<double>(A.x) - D.x,
+                 ady = static_cast<double>(A.y) - D.y,
+                 bdx = static_cast<double>(B.x) - D.x,
+                 bdy = static_cast<double>(B.y) - D.y,
+                 cdx = static_cast<double>(C.x) - D.x,
+                 cdy = static_cast<double>(C.y) - D.y;
+
+    const double bdxcdy = bdx * cdy, cdxbdy = cdx * bdy,
+                 cdxady = cdx * ady, adxcdy = adx * cdy,
+                 adxbdy = adx * bdy, bdxady = bdx * ady;
+    const double alift = adx * adx + ady * ady,
+                 blift = bdx * bdx + bdy * bdy,
+                 clift = cdx * cdx + cdy * cdy;
+
+    const double result = alift * (bdxcdy - cdxbdy) +
+                          blift * (cdxady - adxcdy) +
+                          clift * (adxbdy - bdxady);
+    const double permanent =
+        (std::abs(bdxcdy) + std::abs(cdxbdy)) * alift +
+        (std::abs(cdxady) + std::abs(adxcdy)) * blift +
+        (std::abs(adxbdy) + std::abs(bdxady)) * clift;
+
+    const double bound = IncircleBound * permanent;
+    if (result > bound || -result > bound)
+        return result;
+
+    return incircleExact(A, B, C, D);
+}
+} // namespace Predicates
+} // namespace Calcda
@@ -1,4 +1,11 @@
 #include "Rotation.hpp"
+#include "Matrix3.hpp"
+#include "Matrix4.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
 
 namespace Calcda {
 namespace Conversion {
@@ -6,4 +13,240 @@ float degreeToRadian(float Degree) { return Degree * (CALCDA_PIf / 180.0f); }
 
 float radianToDegree(float Radian) { return Radian / (CALCDA_PIf / 180.0f); }
 } // namespace Conversion
-} // namespace Calcda
\ No newline at end of file
+
+#pragma region Quaternion
+
+namespace {
+/*
+ * Above this cosine slerp interpolates linearly, as sin θ is too small to
+ * divide by
+ */
+constexpr float SlerpLinearThreshold = 0.9995f;
+
+/*
+ * Coefficients of sin(tθ) / sin θ = t * (1 + b1 * (1 + b2 * (...))), with
+ * b_i = (u_i * t^2 - v_i) * (cos θ - 1), u_i = 1 / (i * (2i + 1)) and
+ * v_i = i / (2i + 1); the last term is scaled to make up for the truncated
+ * ones, as in D. Eberly, A Fast and Accurate Algorithm for Computing SLERP
+ * (2011). With 12 terms and this factor, the truncation error is below 7.2e-7.
+ */
+constexpr unsigned SlerpTerms = 12;
+constexpr float SlerpCorrection = 1.8938f;
+
+constexpr float slerpU(unsigned i) {
+    return (i == SlerpTerms ? SlerpCorrection : 1.0f) /
+           static_cast<float>(i * (2 * i + 1));
+}
+
+constexpr float slerpV(unsigned i) {
+    return (i == SlerpTerms ? SlerpCorrection : 1.0f) *
+           static_cast<float>(i) / static_cast<float>(2 * i + 1);
+}
+
+inline float slerpWeight(float Amount, float CosineMinusOne) {
+    const float squared = Amount * Amount;
+
+    float result = 1.0f;
+    for (unsigned i = SlerpTerms; i > 0; --i)
+        result = 1.0f + (slerpU(i) * squared - slerpV(i)) * CosineMinusOne *
+                            result;
+
+    return Amount * result;
+}
+
+// row-major 3x3 rotation block, indexed by row, then column
+template <typename Matrix> Quaternion quaternionFromMatrix(const Matrix &m) {
+    const float trace = m[0][0] + m[1][1] + m[2][2];
+
+    // picks the largest of w, x, y, z to divide by
+    if (trace > 0.0f) {
+        const float s = 0.5f / std::sqrt(trace + 1.0f);
+        return Quaternion((m[2][1] - m[1][2]) * s, (m[0][2] - m[2][0]) * s,
+                          (m[1][0] - m[0][1]) * s, 0.25f / s);
+    } else if (m[0][0] > m[1][1] && m[0][0] > m[2][2]) {
+        const float s = 2.0f * std::sqrt(1.0f + m[0][0] - m[1][1] - m[2][2]);
+        return Quaternion(0.25f * s, (m[0][1] + m[1][0]) / s,
+                          (m[0][2] + m[2][0]) / s, (m[2][1] - m[1][2]) / s);
+    } else if (m[1][1] > m[2][2]) {
+        const float s = 2.0f * std::sqrt(1.0f + m[1][1] - m[0][0] - m[2][2]);
+        return Quaternion((m[0][1] + m[1][0]) / s, 0.25f * s,
+                          (m[1][2] + m[2][1]) / s, (m[0][2] - m[2][0]) / s);
+    } else {
+        const float s = 2.0f * std::sqrt(1.0f + m[2][2] - m[0][0] - m[1][1]);
+        return Quaternion((m[0][2] + m[2][0]) / s, (m[1][2] + m[2][1]) / s,
+                          0.25f * s, (m[1][0] - m[0][1]) / s);
+    }
+}
+} // namespace
+
+const Quaternion Quaternion::Identity = Quaternion(0.0f, 0.0f, 0.0f, 1.0f);
+
+/* static */ Quaternion Quaternion::fromAxisAngle(Vector3 RotateAxis,
+                                                  float Angle) {
+    const float length =
+        std::sqrt(RotateAxis.x * RotateAxis.x + RotateAxis.y * RotateAxis.y +
+                  RotateAxis.z * RotateAxis.z);
+    const float scale = std::sin(0.5f * Angle) / length;
+
+    return Quaternion(RotateAxis.x * scale, RotateAxis.y * scale,
+                      RotateAxis.z * scale, std::cos(0.5f * Angle));
+}
+
+/* static */ Quaternion Quaternion::fromMatrix(const Matrix3 &Rotation) {
+    return quaternionFromMatrix(Rotation.value.matrix);
+}
+
+/* static */ Quaternion Quaternion::fromMatrix(const Matrix4 &Rotation) {
+    return quaternionFromMatrix(Rotation.value.matrix);
+}
+
+std::tuple<Vector3, float> Quaternion::toAxisAngle() const {
+    const auto unit = normalize();
+    const float angle = 2.0f * std::acos(std::clamp(unit.w, -1.0f, 1.0f));
+    const float sine = std::sqrt(std::max(0.0f, 1.0f - unit.w * unit.w));
+
+    if (sine < 1e-6f)
+        return {Vector3::UnitX, angle};
+
+    return {Vector3(unit.x / sine, unit.y / sine, unit.z / sine), angle};
+}
+
+Matrix3 Quaternion::toMatrix3() const {
+    const float xx = x * x, yy = y * y, zz = z * z, xy = x * y, xz = x * z,
+                yz = y * z, wx = w * x, wy = w * y, wz = w * z;
+
+    return Matrix3{1.0f - 2.0f * (yy + zz), 2.0f * (xy - wz),
+                   2.0f * (xz + wy),        2.0f * (xy + wz),
+                   1.0f - 2.0f * (xx + zz), 2.0f * (yz - wx),
+                   2.0f * (xz - wy),        2.0f * (yz + wx),
+                   1.0f - 2.0f * (xx + yy)};
+}
+
+Matrix4 Quaternion::toMatrix4() const { return Matrix4(toMatrix3()); }
+
+Quaternion Quaternion::multiply(const Quaternion &Other) const {
+    return Quaternion(w * Other.x + x * Other.w + y * Other.z - z * Other.y,
+                      w * Other.y - x * Other.z + y * Other.w + z * Other.x,
+                      w * Other.z + x * Other.y - y * Other.x + z * Other.w,
+                      w * Other.w - x * Other.x - y * Other.y - z * Other.z);
+}
+
+Quaternion &Quaternion::selfMultiply(const Quaternion &Other) {
+    return *this = multiply(Other);
+}
+
+Vector3 Quaternion::rotate(Vector3 Point) const {
+    // v + w * t + u x t, with t = 2 * u x v
+    const float tx = 2.0f * (y * Point.z - z * Point.y),
+                ty = 2.0f * (z * Point.x - x * Point.z),
+                tz = 2.0f * (x * Point.y - y * Point.x);
+
+    return Vector3(Point.x + w * tx + (y * tz - z * ty),
+                   Point.y + w * ty + (z * tx - x * tz),
+                   Point.z + w * tz + (x * ty - y * tx));
+}
+
+Quaternion Quaternion::conjugate() const { return Quaternion(-x, -y, -z, w); }
+
+Quaternion Quaternion::inverse() const {
+    const float scale = 1.0f / lengthSquared();
+    return Quaternion(-x * scale, -y * scale, -z * scale, w * scale);
+}
+
+float Quaternion::length() const { return std::sqrt(lengthSquared()); }
+
+float Quaternion::lengthSquared() const { return dot(*this, *this); }
+
+Quaternion Quaternion::normalize() const {
+    const float scale = 1.0f / length();
+    return Quaternion(x * scale, y * scale, z * scale, w * scale);
+}
+
+Quaternion &Quaternion::selfNormalize() { return *this = normalize(); }
+
+/* static */ float Quaternion::dot(const Quaternion &Left,
+                                   const Quaternion &Right) {
+    return Left.x * Right.x + Left.y * Right.y + Left.z * Right.z +
+           Left.w * Right.w;
+}
+
+/* static */ Quaternion Quaternion::nlerp(const Quaternion &From,
+                                          const Quaternion &To, float Amount) {
+    const float to = dot(From, To) < 0.0f ? -Amount : Amount,
+                from = 1.0f - Amount;
+
+    return Quaternion(from * From.x + to * To.x, from * From.y + to * To.y,
+                      from * From.z + to * To.z, from * From.w + to * To.w)
+        .normalize();
+}
+
+/* static */ Quaternion Quaternion::slerp(const Quaternion &From,
+                                          const Quaternion &To, float Amount) {
+    const float cosine = dot(From, To);
+    const float absoluteCosine = std::abs(cosine);
+
+    if (absoluteCosine > SlerpLinearThreshold)
+        return nlerp(From, To, Amount);
+
+    const float angle = std::acos(absoluteCosine),
+                inverseSine = 1.0f / std::sin(angle);
+    const float from = std::sin((1.0f - Amount) * angle) * inverseSine,
+                to = std::copysign(std::sin(Amount * angle) * inverseSine,
+                                   cosine);
+
+    return Quaternion(from * From.x + to * To.x, from * From.y + to * To.y,
+                      from * From.z + to * To.z, from * From.w + to * To.w);
+}
+
+/* static */ void Quaternion::slerpBatch(const Quaternion *From,
+                                         const Quaternion *To,
+                                         const float *Amount, Quaternion *Out,
+                                         std::size_t Count) {
+    for (std::size_t i = 0; i < Count; ++i) {
+        const Quaternion from = From[i], to = To[i];
+        const float cosine = dot(from, to);
+
+        const float toWeight =
+            std::copysign(slerpWeight(Amount[i], std::abs(cosine) - 1.0f),
+                          cosine);
+        const float fromWeight =
+            slerpWeight(1.0f - Amount[i], std::abs(cosine) - 1.0f);
+
+        Out[i] = Quaternion(fromWeight * from.x + toWeight * to.x,
+                            fromWeight * from.y + toWeight * to.y,
+                            fromWeight * from.z + toWeight * to.z,
+                            fromWeight * from.w + toWeight * to.w);
+    }
+}
+
+Quaternion Quaternion::operator*(const Quaternion &Other) const {
+    return multiply(Other);
+}
+
+Vector3 Quaternion::operator*(Vector3 Point) const { return rotate(Point); }
+
+Quaternion Quaternion::operator-() const { return Quaternion(-x, -y, -z, -w); }
+
+Quaternion &Quaternion::operator*=(const Quaternion &Other) {
+    return selfMultiply(Other);
+}
+
+bool Quaternion::operator==(const Quaternion &Other) const {
+    return x == Other.x && y == Other.y && z == Other.z && w == Other.w;
+}
+
+bool Quaternion::operator!=(const Quaternion &Other) const {
+    return !(*this == Other);
+}
+
+std::string Quaternion::toString() const {
+    std::stringstream stream;
+
+    stream << std::fixed << std::setprecision(2) << "<" << x << ", " << y
+           << ", " << z << ", " << w << ">";
+
+    return stream.str();
+}
+
+#pragma endregion
+} // namespace Calcda
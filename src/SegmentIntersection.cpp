@@ -0,0 +1,528 @@
+#include "SegmentIntersection.hpp"
+#include "Predicates.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <set>
+
+namespace Calcda {
+
+namespace {
+namespace Exact = Predicates::Internal;
+
+/*
+ * Exact values as Shewchuk expansions, for the few decisions that the double
+ * precision approximations cannot take; never empty, zero is {0}
+ */
+using Expansion = std::vector<double>;
+
+Expansion sum(const Expansion &E, const Expansion &F) {
+    Expansion result(E.size() + F.size());
+    result.resize(Exact::expansionSum(E.size(), E.data(), F.size(), F.data(),
+                                      result.data()));
+    return result;
+}
+
+Expansion scale(const Expansion &E, double B) {
+    Expansion result(2 * E.size());
+    result.resize(Exact::expansionScale(E.size(), E.data(), B, result.data()));
+    return result;
+}
+
+Expansion product(const Expansion &E, const Expansion &F) {
+    Expansion result = {0.0};
+    for (const double component : F)
+        result = sum(result, scale(E, component));
+
+    return result;
+}
+
+Expansion negate(Expansion E) {
+    for (auto &component : E)
+        component = -component;
+
+    return E;
+}
+
+int sign(const Expansion &E) { return (E.back() > 0.0) - (E.back() < 0.0); }
+
+int sign(double Value) { return (Value > 0.0) - (Value < 0.0); }
+
+/*
+ * Bound of the relative error of a cross product of floats in double
+ * precision, and slack for the few roundings after it; both are generous
+ */
+constexpr double CrossError = 1.0 / 1125899906842624.0;   // 2^-50
+constexpr double CrossingSlack = 1.0 / 281474976710656.0; // 2^-48
+
+//! @brief Orientation of @c A, @c B, @c C, as in Predicates::orient2d
+Expansion orientation(Vector2 A, Vector2 B, Vector2 C) {
+    Expansion result(Exact::CrossExpansionSize);
+    result.resize(Exact::cross2dExpansion(A, B, A, C, result.data()));
+    return result;
+}
+
+//! @brief The orientation in double precision, and a bound of its error
+double orientation(Vector2 A, Vector2 B, Vector2 C, double &Error) {
+    const double left = (static_cast<double>(B.x) - A.x) *
+                        (static_cast<double>(C.y) - A.y),
+                 right = (static_cast<double>(B.y) - A.y) *
+                         (static_cast<double>(C.x) - A.x);
+
+    Error = CrossError * (std::abs(left) + std::abs(right));
+    return left - right;
+}
+
+constexpr std::size_t NoCrossing = std::numeric_limits<std::size_t>::max();
+
+struct Point {
+    //! @brief The coordinates, rounded for crossings
+    double x;
+    double y;
+
+    //! @brief Bound of the rounding error of x and y; zero for endpoints
+    double error;
+
+    //! @brief Index of the crossing in m_crossings, or NoCrossing
+    std::size_t crossing;
+
+    explicit Point(Vector2 Endpoint)
+        : x(Endpoint.x), y(Endpoint.y), error(0.0), crossing(NoCrossing) {}
+    Point(double X, double Y, double Error, std::size_t Crossing)
+        : x(X), y(Y), error(Error), crossing(Crossing) {}
+};
+
+/*
+ * The crossing of two segments that cross properly; its exact coordinates
+ * (x / w, y / w), with w > 0, are only computed when they are needed
+ */
+struct Crossing {
+    std::size_t first;
+    std::size_t second;
+
+    Expansion x;
+    Expansion y;
+    Expansion w;
+};
+
+struct Segment {
+    //! @brief The endpoint that the sweep reaches first
+    Vector2 begin;
+    Vector2 end;
+};
+
+struct Event {
+    std::vector<std::size_t> begins;
+    std::vector<std::size_t> ends;
+};
+
+/*
+ * Sweeps a vertical line over the plane from left to right, stopping at the
+ * endpoints and at the intersections found so far. The status holds the
+ * segments crossing the sweep line from bottom to top; only neighbours in the
+ * status can intersect next, so each event tests O(1) new pairs.
+ *
+ * Every decision is exact: the endpoints are floats, the crossings keep their
+ * exact homogeneous coordinates, and the orientation tests and comparisons
+ * fall back to expansions when the rounded values cannot decide. Rounding
+ * therefore cannot misorder the status or split one point into two events.
+ */
+class SegmentSweep {
+  private:
+    //! @brief Heterogeneous key for searching the status at the current event
+    struct Current {};
+
+    struct EventOrder {
+        SegmentSweep *sweep;
+
+        bool operator()(const Point &a, const Point &b) const {
+            const int x = sweep->compare(a, b, false);
+            return x < 0 || (x == 0 && sweep->compare(a, b, true) < 0);
+        }
+    };
+
+    /*
+     * Only segments through the current event are inserted, so the set only
+     * compares them with each other and with the segments that pass above or
+     * below the event
+     */
+    struct StatusOrder {
+        using is_transparent = void;
+
+        SegmentSweep *sweep;
+
+        bool operator()(std::size_t a, std::size_t b) const {
+            const bool throughA = sweep->isCurrent(a),
+                       throughB = sweep->isCurrent(b);
+
+            if (throughA && throughB) {
+                // ordered as they leave the event; overlaps by index
+                const auto &first = sweep->m_segments[a],
+                           &second = sweep->m_segments[b];
+                const double turn = Predicates::cross2d(
+                    first.begin, first.end, second.begin, second.end);
+                return turn > 0.0 || (turn == 0.0 && a < b);
+            }
+
+            if (throughA)
+                return sweep->side(b) < 0;
+            if (throughB)
+                return sweep->side(a) > 0;
+
+            return a < b;
+        }
+        bool operator()(std::size_t a, Current) const {
+            return sweep->side(a) > 0;
+        }
+        bool operator()(Current, std::size_t b) const {
+            return sweep->side(b) < 0;
+        }
+    };
+
+    using Status = std::set<std::size_t, StatusOrder>;
+
+    const Vector2 *m_points;
+    std::vector<Segment> m_segments;
+    std::vector<Crossing> m_crossings;
+    std::map<Point, Event, EventOrder> m_events;
+    Status m_status;
+
+    //! @brief Iterators of the segments in the status, or m_status.end()
+    std::vector<Status::iterator> m_positions;
+
+    //! @brief The current event
+    Point m_point;
+
+    //! @brief Segments of the current event, deduplicated by m_visited
+    std::vector<std::size_t> m_current;
+    std::vector<std::size_t> m_visited;
+    std::size_t m_stamp;
+
+    std::vector<LineIntersection> m_result;
+
+  private:
+    bool isCurrent(std::size_t Index) const {
+        return m_visited[Index] == m_stamp;
+    }
+
+    //! @brief Whether both are the crossing of the same two segments
+    bool isSameCrossing(const Point &P, const Point &Q) const {
+        if (P.crossing == NoCrossing || Q.crossing == NoCrossing)
+            return false;
+
+        const auto &p = m_crossings[P.crossing], &q = m_crossings[Q.crossing];
+        return (p.first == q.first && p.second == q.second) ||
+               (p.first == q.second && p.second == q.first);
+    }
+
+    Expansion numerator(const Point &P, bool Vertical) {
+        if (P.crossing == NoCrossing)
+            return {Vertical ? P.y : P.x};
+
+        const auto &crossing = exact(P.crossing);
+        return Vertical ? crossing.y : crossing.x;
+    }
+
+    Expansion weight(const Point &P) {
+        return P.crossing == NoCrossing ? Expansion{1.0} : exact(P.crossing).w;
+    }
+
+    //! @brief The sign of the x, or with @c Vertical the y, of @c P - @c Q
+    int compare(const Point &P, const Point &Q, bool Vertical) {
+        const double p = Vertical ? P.y : P.x, q = Vertical ? Q.y : Q.x,
+                     error = P.error + Q.error;
+
+        if (p - q > error)
+            return 1;
+        if (q - p > error)
+            return -1;
+        if (error == 0.0)
+            return 0;
+
+        return compareExact(P, Q, Vertical);
+    }
+
+    int compareExact(const Point &P, const Point &Q, bool Vertical) {
+        if (isSameCrossing(P, Q))
+            return 0;
+
+        return sign(sum(product(numerator(P, Vertical), weight(Q)),
+                        negate(product(numerator(Q, Vertical), weight(P)))));
+    }
+
+    /*
+     * Positive if the current event is above the segment, negative if it is
+     * below, and zero if it is on the line through it
+     */
+    int side(std::size_t Index) {
+        const auto &segment = m_segments[Index];
+        const auto begin = segment.begin, end = segment.end;
+
+        if (m_point.crossing == NoCrossing)
+            return sign(Predicates::orient2d(
+                begin, end,
+                Vector2(static_cast<float>(m_point.x),
+                        static_cast<float>(m_point.y))));
+
+        // the segments that cross there are on it
+        const auto &crossing = m_crossings[m_point.crossing];
+        if (Index == crossing.first || Index == crossing.second)
+            return 0;
+
+        const double dx = static_cast<double>(end.x) - begin.x,
+                     dy = static_cast<double>(end.y) - begin.y,
+                     left = dx * (m_point.y - begin.y),
+                     right = dy * (m_point.x - begin.x),
+                     bound = 2.0 * (std::abs(dx) + std::abs(dy)) *
+                                 m_point.error +
+                             1e-14 * (std::abs(left) + std::abs(right));
+
+        if (left - right > bound)
+            return 1;
+        if (right - left > bound)
+            return -1;
+
+        return sideExact(Index);
+    }
+
+    int sideExact(std::size_t Index) {
+        const auto &segment = m_segments[Index];
+        const auto begin = segment.begin, end = segment.end;
+
+        // dx (y - begin.y w) - dy (x - begin.x w), with w > 0
+        const auto &point = exact(m_point.crossing);
+        const auto exactDx = sum({end.x}, {-static_cast<double>(begin.x)}),
+                   exactDy = sum({end.y}, {-static_cast<double>(begin.y)});
+        const auto relativeY = sum(point.y, negate(scale(point.w, begin.y))),
+                   relativeX = sum(point.x, negate(scale(point.w, begin.x)));
+        return sign(sum(product(exactDx, relativeY),
+                        negate(product(exactDy, relativeX))));
+    }
+
+    /*
+     * Adds the crossing of @c First and @c Second, which cross properly;
+     * @c Sign is the sign of the orientation of @c Second and the beginning
+     * of @c First
+     */
+    Point addCrossing(std::size_t First, std::size_t Second, int Sign) {
+        const auto &s1 = m_segments[First], &s2 = m_segments[Second];
+
+        // the parameter along s1 is d1 / (d1 - d2), of the distances d1 and
+        // d2 of its endpoints from s2; bound it with the errors of both
+        double error1, error2;
+        const double d1 = Sign *
+                          orientation(s2.begin, s2.end, s1.begin, error1),
+                     d2 = -Sign * orientation(s2.begin, s2.end, s1.end, error2);
+        const double low1 = std::max(d1 - error1, 0.0), high1 = d1 + error1,
+                     low2 = std::max(d2 - error2, 0.0), high2 = d2 + error2,
+                     low = low1 / (low1 + high2), high = high1 / (high1 + low2),
+                     t = 0.5 * (low + high);
+
+        const double dx = static_cast<double>(s1.end.x) - s1.begin.x,
+                     dy = static_cast<double>(s1.end.y) - s1.begin.y,
+                     spread = std::max(std::abs(dx), std::abs(dy)),
+                     error = (0.5 * (high - low) + CrossingSlack) * spread +
+                             CrossingSlack * std::max(std::abs(s1.begin.x),
+                                                      std::abs(s1.begin.y));
+
+        m_crossings.push_back({First, Second, {}, {}, {}});
+        return Point(s1.begin.x + t * dx, s1.begin.y + t * dy, error,
+                     m_crossings.size() - 1);
+    }
+
+    const Crossing &exact(std::size_t Index) {
+        auto &crossing = m_crossings[Index];
+        if (!crossing.w.empty())
+            return crossing;
+
+        // s1.begin + d1 / (d1 - d2) (s1.end - s1.begin)
+        const auto &s1 = m_segments[crossing.first],
+                   &s2 = m_segments[crossing.second];
+        const auto d1 = orientation(s2.begin, s2.end, s1.begin),
+                   d2 = orientation(s2.begin, s2.end, s1.end);
+
+        crossing.x = sum(scale(d1, s1.end.x), negate(scale(d2, s1.begin.x)));
+        crossing.y = sum(scale(d1, s1.end.y), negate(scale(d2, s1.begin.y)));
+        crossing.w = sum(d1, negate(d2));
+        if (sign(crossing.w) < 0) {
+            crossing.x = negate(std::move(crossing.x));
+            crossing.y = negate(std::move(crossing.y));
+            crossing.w = negate(std::move(crossing.w));
+        }
+
+        return crossing;
+    }
+
+    /*
+     * Touching and collinear segments meet at an endpoint of one of them,
+     * whose event finds the other one in the status; only proper crossings
+     * need events of their own.
+     */
+    void checkPair(std::size_t Below, std::size_t Above) {
+        const auto &s1 = m_segments[Below], &s2 = m_segments[Above];
+
+        const int turn = sign(Predicates::orient2d(s2.begin, s2.end, s1.begin));
+        if (turn * sign(Predicates::orient2d(s2.begin, s2.end, s1.end)) >= 0 ||
+            sign(Predicates::orient2d(s1.begin, s1.end, s2.begin)) *
+                    sign(Predicates::orient2d(s1.begin, s1.end, s2.end)) >=
+                0)
+            return;
+
+        const auto point = addCrossing(Below, Above, turn);
+        if (!EventOrder{this}(m_point, point) ||
+            !m_events.emplace(point, Event()).second)
+            m_crossings.pop_back();
+    }
+
+    // parameter along the segment as it was given, not as it is swept
+    double parameter(std::size_t Index, const Point &Position) const {
+        const auto a = m_points[2 * Index], b = m_points[2 * Index + 1];
+        const double dx = static_cast<double>(b.x) - a.x,
+                     dy = static_cast<double>(b.y) - a.y,
+                     lengthSquared = dx * dx + dy * dy;
+
+        return lengthSquared == 0.0
+                   ? 0.0
+                   : ((Position.x - a.x) * dx + (Position.y - a.y) * dy) /
+                         lengthSquared;
+    }
+
+    void add(std::size_t Index) {
+        if (m_visited[Index] == m_stamp)
+            return;
+
+        m_visited[Index] = m_stamp;
+        m_current.push_back(Index);
+    }
+
+    void report() {
+        const Vector2 intersection(static_cast<float>(m_point.x),
+                                   static_cast<float>(m_point.y));
+
+        std::sort(m_current.begin(), m_current.end());
+        for (std::size_t i = 0; i < m_current.size(); ++i) {
+            const auto first = m_current[i];
+            const auto firstParameter = parameter(first, m_point);
+
+            for (std::size_t j = i + 1; j < m_current.size(); ++j) {
+                const auto second = m_current[j];
+                m_result.push_back(
+                    {first, second, static_cast<float>(firstParameter),
+                     static_cast<float>(parameter(second, m_point)),
+                     intersection});
+            }
+        }
+    }
+
+    void handle(const Event &event) {
+        ++m_stamp;
+        m_current.clear();
+
+        for (const auto index : event.begins)
+            add(index);
+        for (const auto index : event.ends)
+            add(index);
+
+        // the segments through the point are adjacent in the status
+        const auto through = m_status.equal_range(Current{});
+        for (auto it = through.first; it != through.second; ++it)
+            add(*it);
+
+        if (m_current.size() > 1)
+            report();
+
+        for (const auto index : m_current) {
+            if (m_positions[index] != m_status.end()) {
+                m_status.erase(m_positions[index]);
+                m_positions[index] = m_status.end();
+            }
+        }
+
+        // reinserting the crossing segments swaps their order
+        for (const auto index : m_current)
+            if (EventOrder{this}(m_point, Point(m_segments[index].end)))
+                m_positions[index] = m_status.insert(index).first;
+
+        const auto lower = m_status.lower_bound(Current{}),
+                   upper = m_status.upper_bound(Current{});
+
+        if (lower == upper) {
+            if (lower != m_status.begin() && lower != m_status.end())
+                checkPair(*std::prev(lower), *lower);
+            return;
+        }
+
+        if (lower != m_status.begin())
+            checkPair(*std::prev(lower), *lower);
+        if (upper != m_status.end())
+            checkPair(*std::prev(upper), *upper);
+    }
+
+  public:
+    SegmentSweep(const Vector2 *Points, std::size_t Count)
+        : m_points(Points), m_events(EventOrder{this}),
+          m_status(StatusOrder{this}), m_point(Vector2()),
+          m_visited(Count, 0), m_stamp(0) {
+        m_segments.reserve(Count);
+        m_positions.assign(Count, m_status.end());
+
+        for (std::size_t i = 0; i < Count; ++i) {
+            auto begin = Points[2 * i], end = Points[2 * i + 1];
+            if (end.x < begin.x || (end.x == begin.x && end.y < begin.y))
+                std::swap(begin, end);
+
+            m_segments.push_back({begin, end});
+            m_events[Point(begin)].begins.push_back(i);
+            m_events[Point(end)].ends.push_back(i);
+        }
+    }
+
+    std::vector<LineIntersection> run() {
+        while (!m_events.empty()) {
+            auto next = m_events.begin();
+            m_point = next->first;
+            const Event event = std::move(next->second);
+            m_events.erase(next);
+
+            handle(event);
+        }
+
+        // overlapping segments meet at several events; keep the first
+        std::stable_sort(m_result.begin(), m_result.end(),
+                         [](const auto &a, const auto &b) {
+                             return a.first < b.first ||
+                                    (a.first == b.first && a.second < b.second);
+                         });
+        m_result.erase(std::unique(m_result.begin(), m_result.end(),
+                                   [](const auto &a, const auto &b) {
+                                       return a.first == b.first &&
+                                              a.second == b.second;
+                                   }),
+                       m_result.end());
+
+        return std::move(m_result);
+    }
+};
+} // namespace
+
+std::vector<LineIntersection> intersectSegments(const Vector2 *Points,
+                                                std::size_t Count) {
+    return SegmentSweep(Points, Count).run();
+}
+
+std::vector<LineIntersection>
+intersectSegments(const std::vector<Line> &Segments) {
+    std::vector<Vector2> points;
+    points.reserve(2 * Segments.size());
+
+    for (const auto &segment : Segments) {
+        const auto [begin, end] = segment.getPoints();
+        points.push_back(begin);
+        points.push_back(end);
+    }
+
+    return intersectSegments(points.data(), Segments.size());
+}
+} // namespace Calcda
@@ -0,0 +1,31 @@
+#ifndef CALCDA_SLAB_H
+#define CALCDA_SLAB_H
+
+#include "Vector3.hpp" // Calcda::Vector3
+
+#include <cmath>
+#include <limits>
+
+namespace Calcda {
+namespace Internal {
+// The x, y or z of Value for an Axis of 0, 1 or 2
+inline float component(const Vector3 &Value, unsigned Axis) {
+    return Axis == 0 ? Value.x : (Axis == 1 ? Value.y : Value.z);
+}
+
+/*
+ * Inverse of a direction component for the slab tests of AABB3 and
+ * TriangleMesh; zero (and denormal) components get a large finite inverse
+ * of the same sign instead of an infinite one, so a ray starting on a face
+ * of a box never multiplies 0 by infinity
+ */
+inline float slabInverse(float Direction) {
+    constexpr float Smallest = std::numeric_limits<float>::min();
+    return std::abs(Direction) >= Smallest
+               ? 1.0f / Direction
+               : std::copysign(1.0f / Smallest, Direction);
+}
+} // namespace Internal
+} // namespace Calcda
+
+#endif // !CALCDA_SLAB_H
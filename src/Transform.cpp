@@ -0,0 +1,206 @@
+#include "Transform.hpp"
+
+#include <sstream>
+
+namespace Calcda {
+namespace {
+/*
+ * Rotation * (Scale * Point), written out like Quaternion::rotate; the
+ * Vector3 operators are calls when the vectors are not header-only
+ */
+inline Vector3 scaleAndRotate(const Quaternion &Rotation, const Vector3 &Scale,
+                              const Vector3 &Point) {
+    const float px = Scale.x * Point.x, py = Scale.y * Point.y,
+                pz = Scale.z * Point.z;
+    const float x = Rotation.x, y = Rotation.y, z = Rotation.z, w = Rotation.w;
+
+    const float tx = 2.0f * (y * pz - z * py), ty = 2.0f * (z * px - x * pz),
+                tz = 2.0f * (x * py - y * px);
+
+    return Vector3(px + w * tx + (y * tz - z * ty),
+                   py + w * ty + (z * tx - x * tz),
+                   pz + w * tz + (x * ty - y * tx));
+}
+} // namespace
+
+const Transform Transform::Identity = Transform();
+
+Transform::Transform()
+    : m_translation(Vector3::Zero), m_rotation(Quaternion::Identity),
+      m_scale(Vector3::One) {}
+
+Transform::Transform(Vector3 Translation, Quaternion Rotation, Vector3 Scale)
+    : m_translation(Translation), m_rotation(Rotation), m_scale(Scale) {}
+
+Vector3 Transform::getTranslation() const { return m_translation; }
+
+Quaternion Transform::getRotation() const { return m_rotation; }
+
+Vector3 Transform::getScale() const { return m_scale; }
+
+Transform &Transform::setTranslation(Vector3 Translation) {
+    m_translation = Translation;
+    return *this;
+}
+
+Transform &Transform::setRotation(Quaternion Rotation) {
+    m_rotation = Rotation;
+    return *this;
+}
+
+Transform &Transform::setScale(Vector3 Scale) {
+    m_scale = Scale;
+    return *this;
+}
+
+Transform &Transform::translate(Vector3 Offset) {
+    return setTranslation(m_translation + Offset);
+}
+
+Transform &Transform::rotate(Quaternion Rotation) {
+    return setRotation(Rotation * m_rotation);
+}
+
+Transform Transform::combine(const Transform &Other) const {
+    return Transform(transformPoint(Other.m_translation),
+                     m_rotation.multiply(Other.m_rotation),
+                     Vector3(m_scale.x * Other.m_scale.x,
+                             m_scale.y * Other.m_scale.y,
+                             m_scale.z * Other.m_scale.z));
+}
+
+Transform Transform::inverse() const {
+    const Quaternion rotation(-m_rotation.x, -m_rotation.y, -m_rotation.z,
+                              m_rotation.w);
+    const Vector3 scale(1.0f / m_scale.x, 1.0f / m_scale.y, 1.0f / m_scale.z);
+    const Vector3 translation = scaleAndRotate(rotation, scale, m_translation);
+
+    return Transform(Vector3(-translation.x, -translation.y, -translation.z),
+                     rotation, scale);
+}
+
+Vector3 Transform::transformPoint(Vector3 Point) const {
+    const Vector3 result = scaleAndRotate(m_rotation, m_scale, Point);
+    return Vector3(result.x + m_translation.x, result.y + m_translation.y,
+                   result.z + m_translation.z);
+}
+
+Vector3 Transform::transformDirection(Vector3 Direction) const {
+    return scaleAndRotate(m_rotation, m_scale, Direction);
+}
+
+Matrix4 Transform::toMatrix4() const {
+    // the rotation matrix of the quaternion, with its columns scaled
+    const float x = m_rotation.x, y = m_rotation.y, z = m_rotation.z,
+                w = m_rotation.w;
+    const float xx = x * x, yy = y * y, zz = z * z, xy = x * y, xz = x * z,
+                yz = y * z, wx = w * x, wy = w * y, wz = w * z;
+    Matrix4 result;
+    auto &value = result.value;
+
+    value.m00 = (1.0f - 2.0f * (yy + zz)) * m_scale.x;
+    value.m01 = 2.0f * (xy - wz) * m_scale.y;
+    value.m02 = 2.0f * (xz + wy) * m_scale.z;
+    value.m03 = m_translation.x;
+
+    value.m10 = 2.0f * (xy + wz) * m_scale.x;
+    value.m11 = (1.0f - 2.0f * (xx + zz)) * m_scale.y;
+    value.m12 = 2.0f * (yz - wx) * m_scale.z;
+    value.m13 = m_translation.y;
+
+    value.m20 = 2.0f * (xz - wy) * m_scale.x;
+    value.m21 = 2.0f * (yz + wx) * m_scale.y;
+    value.m22 = (1.0f - 2.0f * (xx + yy)) * m_scale.z;
+    value.m23 = m_translation.z;
+
+    value.m30 = 0.0f;
+    value.m31 = 0.0f;
+    value.m32 = 0.0f;
+    value.m33 = 1.0f;
+
+    return result;
+}
+
+Transform Transform::operator*(const Transform &Other) const {
+    return combine(Other);
+}
+
+Vector3 Transform::operator*(Vector3 Point) const {
+    return transformPoint(Point);
+}
+
+Transform &Transform::operator*=(const Transform &Other) {
+    return *this = combine(Other);
+}
+
+bool Transform::operator==(const Transform &Other) const {
+    return m_translation == Other.m_translation &&
+           m_rotation == Other.m_rotation && m_scale == Other.m_scale;
+}
+
+bool Transform::operator!=(const Transform &Other) const {
+    return !(*this == Other);
+}
+
+std::string Transform::toString() const {
+    std::stringstream stream;
+
+    stream << "translation: " << m_translation.toString()
+           << ", rotation: " << m_rotation.toString()
+           << ", scale: " << m_scale.toString();
+
+    return stream.str();
+}
+
+CachedTransform::CachedTransform() : m_dirty(true) {}
+
+CachedTransform::CachedTransform(const Transform &Value)
+    : m_transform(Value), m_dirty(true) {}
+
+const Transform &CachedTransform::getTransform() const { return m_transform; }
+
+CachedTransform &CachedTransform::setTransform(const Transform &Value) {
+    m_transform = Value;
+    m_dirty = true;
+    return *this;
+}
+
+CachedTransform &CachedTransform::setTranslation(Vector3 Translation) {
+    m_transform.setTranslation(Translation);
+    m_dirty = true;
+    return *this;
+}
+
+CachedTransform &CachedTransform::setRotation(Quaternion Rotation) {
+    m_transform.setRotation(Rotation);
+    m_dirty = true;
+    return *this;
+}
+
+CachedTransform &CachedTransform::setScale(Vector3 Scale) {
+    m_transform.setScale(Scale);
+    m_dirty = true;
+    return *this;
+}
+
+CachedTransform &CachedTransform::translate(Vector3 Offset) {
+    m_transform.translate(Offset);
+    m_dirty = true;
+    return *this;
+}
+
+CachedTransform &CachedTransform::rotate(Quaternion Rotation) {
+    m_transform.rotate(Rotation);
+    m_dirty = true;
+    return *this;
+}
+
+const Matrix4 &CachedTransform::toMatrix4() {
+    if (m_dirty) {
+        m_matrix = m_transform.toMatrix4();
+        m_dirty = false;
+    }
+
+    return m_matrix;
+}
+} // namespace Calcda
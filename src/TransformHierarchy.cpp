@@ -0,0 +1,215 @@
+#include "TransformHierarchy.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+namespace Calcda {
+TransformHierarchy::TransformHierarchy()
+    : m_stamp(0), m_firstDirty(0), m_subtreeThreads(0) {}
+
+void TransformHierarchy::markDirty(std::size_t Node) {
+    m_dirty[Node] = 1;
+    m_firstDirty = std::min(m_firstDirty, Node);
+}
+
+/*
+ * Splits the hierarchy at the first level with at least Threads nodes, or at
+ * the widest level if there is none. The nodes above it are kept in
+ * m_topNodes, and the rest are grouped by their ancestor on that level with
+ * a counting sort; the sort is stable, so every parent stays before its
+ * children
+ */
+void TransformHierarchy::buildSubtrees(unsigned int Threads) {
+    const std::size_t count = m_parents.size();
+
+    std::vector<std::size_t> depths(count), levelSizes;
+    for (std::size_t i = 0; i < count; ++i) {
+        depths[i] = m_parents[i] == NoParent ? 0 : depths[m_parents[i]] + 1;
+        if (depths[i] == levelSizes.size())
+            levelSizes.push_back(0);
+        ++levelSizes[depths[i]];
+    }
+
+    std::size_t split = 0;
+    for (std::size_t level = 0; level < levelSizes.size(); ++level) {
+        if (levelSizes[level] >= Threads) {
+            split = level;
+            break;
+        }
+        if (levelSizes[level] > levelSizes[split])
+            split = level;
+    }
+
+    std::vector<std::size_t> subtrees(count);
+    m_topNodes.clear();
+    m_subtreeOffsets.assign(1, 0);
+    for (std::size_t i = 0; i < count; ++i) {
+        if (depths[i] < split) {
+            m_topNodes.push_back(i);
+            continue;
+        }
+
+        if (depths[i] == split) {
+            subtrees[i] = m_subtreeOffsets.size() - 1;
+            m_subtreeOffsets.push_back(0);
+        } else {
+            subtrees[i] = subtrees[m_parents[i]];
+        }
+        ++m_subtreeOffsets[subtrees[i] + 1];
+    }
+
+    for (std::size_t i = 1; i < m_subtreeOffsets.size(); ++i)
+        m_subtreeOffsets[i] += m_subtreeOffsets[i - 1];
+
+    auto next = m_subtreeOffsets;
+    m_subtreeNodes.resize(count - m_topNodes.size());
+    for (std::size_t i = 0; i < count; ++i)
+        if (depths[i] >= split)
+            m_subtreeNodes[next[subtrees[i]]++] = i;
+
+    m_subtreeThreads = Threads;
+}
+
+/*
+ * A node is recomputed if it is dirty, or if its parent was recomputed in the
+ * current update; the parent comes first, so its stamp is already set
+ */
+std::size_t TransformHierarchy::updateNode(std::size_t Node) {
+    const auto parent = m_parents[Node];
+    const bool parentUpdated =
+        parent != NoParent && m_updated[parent] == m_stamp;
+
+    if (!m_dirty[Node] && !parentUpdated)
+        return 0;
+
+    if (parent == NoParent)
+        m_worlds[Node] = m_locals[Node];
+    else
+        m_worlds[Node] = m_worlds[parent].multiply(m_locals[Node]);
+
+    m_dirty[Node] = 0;
+    m_updated[Node] = m_stamp;
+    return 1;
+}
+
+void TransformHierarchy::reserve(std::size_t Count) {
+    m_parents.reserve(Count);
+    m_locals.reserve(Count);
+    m_worlds.reserve(Count);
+    m_dirty.reserve(Count);
+    m_updated.reserve(Count);
+}
+
+std::size_t TransformHierarchy::add(const Matrix4 &Local, std::size_t Parent) {
+    const std::size_t node = m_parents.size();
+
+    m_parents.push_back(Parent);
+    m_locals.push_back(Local);
+    m_worlds.push_back(Local);
+    m_dirty.push_back(0);
+    m_updated.push_back(0);
+
+    markDirty(node);
+    return node;
+}
+
+std::size_t TransformHierarchy::add(const Transform &Local,
+                                    std::size_t Parent) {
+    return add(Local.toMatrix4(), Parent);
+}
+
+std::size_t TransformHierarchy::size() const { return m_parents.size(); }
+
+std::size_t TransformHierarchy::getParent(std::size_t Node) const {
+    return m_parents[Node];
+}
+
+const Matrix4 &TransformHierarchy::getLocal(std::size_t Node) const {
+    return m_locals[Node];
+}
+
+const Matrix4 &TransformHierarchy::getWorld(std::size_t Node) const {
+    return m_worlds[Node];
+}
+
+void TransformHierarchy::setLocal(std::size_t Node, const Matrix4 &Local) {
+    m_locals[Node] = Local;
+    markDirty(Node);
+}
+
+void TransformHierarchy::setLocal(std::size_t Node, const Transform &Local) {
+    setLocal(Node, Local.toMatrix4());
+}
+
+std::size_t TransformHierarchy::update() {
+    const std::size_t count = m_parents.size();
+    if (m_firstDirty >= count)
+        return 0;
+
+    ++m_stamp;
+
+    std::size_t updated = 0;
+    for (std::size_t i = m_firstDirty; i < count; ++i)
+        updated += updateNode(i);
+
+    m_firstDirty = count;
+    return updated;
+}
+
+std::size_t TransformHierarchy::updateParallel(unsigned int Threads) {
+    const std::size_t count = m_parents.size();
+    if (m_firstDirty >= count)
+        return 0;
+
+    if (Threads == 0)
+        Threads = std::max(1U, std::thread::hardware_concurrency());
+    if (Threads <= 1)
+        return update();
+
+    // nodes are only ever added, so a size change means a new structure
+    if (m_topNodes.size() + m_subtreeNodes.size() != count ||
+        m_subtreeThreads != Threads)
+        buildSubtrees(Threads);
+
+    const std::size_t subtreeCount = m_subtreeOffsets.size() - 1;
+    if (Threads > subtreeCount)
+        Threads = static_cast<unsigned int>(subtreeCount);
+
+    if (Threads <= 1)
+        return update();
+
+    ++m_stamp;
+
+    // the top of the tree goes first, so the subtrees see its stamps
+    std::size_t topUpdated = 0;
+    for (const auto node : m_topNodes)
+        topUpdated += updateNode(node);
+
+    // the threads take whole subtrees, which share no nodes
+    std::atomic<std::size_t> nextSubtree(0), updated(topUpdated);
+    const auto work = [&]() {
+        std::size_t local = 0;
+
+        for (std::size_t subtree = nextSubtree++; subtree < subtreeCount;
+             subtree = nextSubtree++)
+            for (std::size_t i = m_subtreeOffsets[subtree];
+                 i < m_subtreeOffsets[subtree + 1]; ++i)
+                local += updateNode(m_subtreeNodes[i]);
+
+        updated += local;
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(Threads - 1);
+    for (unsigned int i = 1; i < Threads; ++i)
+        threads.emplace_back(work);
+
+    work();
+    for (auto &thread : threads)
+        thread.join();
+
+    m_firstDirty = count;
+    return updated;
+}
+} // namespace Calcda
@@ -0,0 +1,525 @@
+#include "TriangleMesh.hpp"
+
+#include "BinnedSplit.hpp"
+#include "Slab.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(CALCDA_SIMD_AVX) || defined(CALCDA_SIMD_SSE2)
+#include <immintrin.h>
+#endif
+
+namespace Calcda {
+
+namespace {
+constexpr std::size_t MaxLeafSize = 4;
+constexpr std::size_t BinCount = 16;
+
+// see BoundingVolumeHierarchy: bounds the depth for the fixed size stacks
+constexpr unsigned MaxHeuristicDepth = 32;
+constexpr std::size_t StackSize = 64;
+
+using Internal::component;
+using Internal::slabInverse;
+
+struct Ray {
+    float origin[3];
+    float direction[3];
+    float inverse[3];
+
+    Ray(Vector3 Origin, Vector3 Direction)
+        : origin{Origin.x, Origin.y, Origin.z},
+          direction{Direction.x, Direction.y, Direction.z},
+          inverse{slabInverse(Direction.x), slabInverse(Direction.y),
+                  slabInverse(Direction.z)} {}
+
+    //! Distance where the ray enters the box, 0 if it starts inside
+    bool boxDistance(const AABB3 &Box, float MaxDistance,
+                     float &Entry) const {
+        float exit = MaxDistance;
+        Entry = 0.0f;
+
+        for (unsigned axis = 0; axis < 3; ++axis) {
+            const float t1 = (component(Box.minimum, axis) - origin[axis]) *
+                             inverse[axis],
+                        t2 = (component(Box.maximum, axis) - origin[axis]) *
+                             inverse[axis];
+
+            Entry = std::max(Entry, std::min(t1, t2));
+            exit = std::min(exit, std::max(t1, t2));
+        }
+
+        return Entry <= exit;
+    }
+
+    // Möller-Trumbore, with the edges from Corner precomputed
+    bool intersectTriangle(const Vector3 &Corner, const Vector3 &Edge1,
+                           const Vector3 &Edge2, float MaxDistance,
+                           TriangleHit &Hit) const {
+        const float *d = direction;
+
+        const float px = d[1] * Edge2.z - d[2] * Edge2.y,
+                    py = d[2] * Edge2.x - d[0] * Edge2.z,
+                    pz = d[0] * Edge2.y - d[1] * Edge2.x;
+        const float determinant = Edge1.x * px + Edge1.y * py + Edge1.z * pz;
+        if (determinant == 0.0f)
+            return false;
+
+        const float inverseDeterminant = 1.0f / determinant;
+        const float sx = origin[0] - Corner.x, sy = origin[1] - Corner.y,
+                    sz = origin[2] - Corner.z;
+
+        const float u = (sx * px + sy * py + sz * pz) * inverseDeterminant;
+        if (u < 0.0f || u > 1.0f)
+            return false;
+
+        const float qx = sy * Edge1.z - sz * Edge1.y,
+                    qy = sz * Edge1.x - sx * Edge1.z,
+                    qz = sx * Edge1.y - sy * Edge1.x;
+
+        const float v =
+            (d[0] * qx + d[1] * qy + d[2] * qz) * inverseDeterminant;
+        if (v < 0.0f || u + v > 1.0f)
+            return false;
+
+        const float t =
+            (Edge2.x * qx + Edge2.y * qy + Edge2.z * qz) * inverseDeterminant;
+        if (t < 0.0f || t > MaxDistance)
+            return false;
+
+        Hit = {t, u, v};
+        return true;
+    }
+};
+
+#if defined(CALCDA_SIMD_AVX) || defined(CALCDA_SIMD_SSE2)
+/*
+ * The packet kernels are written once against these wrappers, with a lane
+ * per ray; masks are lanes of all ones or all zeros
+ */
+#if defined(CALCDA_SIMD_AVX)
+constexpr std::size_t PacketWidth = 8;
+using Lanes = __m256;
+
+inline Lanes broadcast(float Value) { return _mm256_set1_ps(Value); }
+inline Lanes load(const float *Values) { return _mm256_loadu_ps(Values); }
+inline void store(float *Values, Lanes Value) {
+    _mm256_storeu_ps(Values, Value);
+}
+inline Lanes add(Lanes a, Lanes b) { return _mm256_add_ps(a, b); }
+inline Lanes sub(Lanes a, Lanes b) { return _mm256_sub_ps(a, b); }
+inline Lanes mul(Lanes a, Lanes b) { return _mm256_mul_ps(a, b); }
+inline Lanes div(Lanes a, Lanes b) { return _mm256_div_ps(a, b); }
+inline Lanes lanesMin(Lanes a, Lanes b) { return _mm256_min_ps(a, b); }
+inline Lanes lanesMax(Lanes a, Lanes b) { return _mm256_max_ps(a, b); }
+inline Lanes lessEqual(Lanes a, Lanes b) {
+    return _mm256_cmp_ps(a, b, _CMP_LE_OQ);
+}
+inline Lanes notEqual(Lanes a, Lanes b) {
+    return _mm256_cmp_ps(a, b, _CMP_NEQ_OQ);
+}
+inline Lanes both(Lanes a, Lanes b) { return _mm256_and_ps(a, b); }
+inline Lanes select(Lanes Mask, Lanes a, Lanes b) {
+    return _mm256_blendv_ps(b, a, Mask);
+}
+inline unsigned bits(Lanes Mask) {
+    return static_cast<unsigned>(_mm256_movemask_ps(Mask));
+}
+#else
+constexpr std::size_t PacketWidth = 4;
+using Lanes = __m128;
+
+inline Lanes broadcast(float Value) { return _mm_set1_ps(Value); }
+inline Lanes load(const float *Values) { return _mm_loadu_ps(Values); }
+inline void store(float *Values, Lanes Value) { _mm_storeu_ps(Values, Value); }
+inline Lanes add(Lanes a, Lanes b) { return _mm_add_ps(a, b); }
+inline Lanes sub(Lanes a, Lanes b) { return _mm_sub_ps(a, b); }
+inline Lanes mul(Lanes a, Lanes b) { return _mm_mul_ps(a, b); }
+inline Lanes div(Lanes a, Lanes b) { return _mm_div_ps(a, b); }
+inline Lanes lanesMin(Lanes a, Lanes b) { return _mm_min_ps(a, b); }
+inline Lanes lanesMax(Lanes a, Lanes b) { return _mm_max_ps(a, b); }
+inline Lanes lessEqual(Lanes a, Lanes b) { return _mm_cmple_ps(a, b); }
+inline Lanes notEqual(Lanes a, Lanes b) { return _mm_cmpneq_ps(a, b); }
+inline Lanes both(Lanes a, Lanes b) { return _mm_and_ps(a, b); }
+inline Lanes select(Lanes Mask, Lanes a, Lanes b) {
+    return _mm_or_ps(_mm_and_ps(Mask, a), _mm_andnot_ps(Mask, b));
+}
+inline unsigned bits(Lanes Mask) {
+    return static_cast<unsigned>(_mm_movemask_ps(Mask));
+}
+#endif
+
+inline Lanes dot(const Lanes (&a)[3], const Lanes (&b)[3]) {
+    return add(add(mul(a[0], b[0]), mul(a[1], b[1])), mul(a[2], b[2]));
+}
+
+inline void cross(const Lanes (&a)[3], const Lanes (&b)[3],
+                  Lanes (&Result)[3]) {
+    Result[0] = sub(mul(a[1], b[2]), mul(a[2], b[1]));
+    Result[1] = sub(mul(a[2], b[0]), mul(a[0], b[2]));
+    Result[2] = sub(mul(a[0], b[1]), mul(a[1], b[0]));
+}
+
+struct Packet {
+    Lanes origin[3];
+    Lanes direction[3];
+    Lanes inverse[3];
+
+    // closest hit so far of every ray
+    Lanes distance;
+    Lanes u;
+    Lanes v;
+    std::size_t triangle[PacketWidth];
+
+    // Mask of the rays that hit the box before their closest hit
+    Lanes hitsBox(const AABB3 &Box) const {
+        Lanes entry = broadcast(0.0f), exit = distance;
+
+        for (unsigned axis = 0; axis < 3; ++axis) {
+            const Lanes t1 = mul(sub(broadcast(component(Box.minimum, axis)),
+                                     origin[axis]),
+                                 inverse[axis]),
+                        t2 = mul(sub(broadcast(component(Box.maximum, axis)),
+                                     origin[axis]),
+                                 inverse[axis]);
+
+            entry = lanesMax(entry, lanesMin(t1, t2));
+            exit = lanesMin(exit, lanesMax(t1, t2));
+        }
+
+        return lessEqual(entry, exit);
+    }
+
+    // the scalar Möller-Trumbore test, on every ray at once
+    void intersectTriangle(const Vector3 &Corner, const Vector3 &Edge1,
+                           const Vector3 &Edge2, std::size_t Triangle) {
+        const Lanes edge1[3] = {broadcast(Edge1.x), broadcast(Edge1.y),
+                                broadcast(Edge1.z)},
+                    edge2[3] = {broadcast(Edge2.x), broadcast(Edge2.y),
+                                broadcast(Edge2.z)};
+        const Lanes s[3] = {sub(origin[0], broadcast(Corner.x)),
+                            sub(origin[1], broadcast(Corner.y)),
+                            sub(origin[2], broadcast(Corner.z))};
+
+        Lanes p[3], q[3];
+        cross(direction, edge2, p);
+        cross(s, edge1, q);
+
+        const Lanes zero = broadcast(0.0f), one = broadcast(1.0f);
+        const Lanes determinant = dot(edge1, p);
+        const Lanes inverseDeterminant = div(one, determinant);
+
+        const Lanes hitU = mul(dot(s, p), inverseDeterminant),
+                    hitV = mul(dot(direction, q), inverseDeterminant),
+                    hitDistance = mul(dot(edge2, q), inverseDeterminant);
+
+        // a zero determinant gives infinite or NaN values, which fail these
+        const Lanes hit = both(
+            both(both(notEqual(determinant, zero), lessEqual(zero, hitU)),
+                 both(lessEqual(zero, hitV), lessEqual(add(hitU, hitV), one))),
+            both(lessEqual(zero, hitDistance),
+                 lessEqual(hitDistance, distance)));
+
+        unsigned mask = bits(hit);
+        if (mask == 0)
+            return;
+
+        distance = select(hit, hitDistance, distance);
+        u = select(hit, hitU, u);
+        v = select(hit, hitV, v);
+        for (std::size_t lane = 0; mask != 0; ++lane, mask >>= 1)
+            if (mask & 1U)
+                triangle[lane] = Triangle;
+    }
+};
+#endif
+} // namespace
+
+std::optional<TriangleHit> intersectRayTriangle(Vector3 Origin,
+                                                Vector3 Direction, Vector3 A,
+                                                Vector3 B, Vector3 C,
+                                                float MaxDistance) {
+    const Vector3 edge1(B.x - A.x, B.y - A.y, B.z - A.z),
+        edge2(C.x - A.x, C.y - A.y, C.z - A.z);
+
+    TriangleHit hit;
+    if (!Ray(Origin, Direction)
+             .intersectTriangle(A, edge1, edge2, MaxDistance, hit))
+        return std::nullopt;
+
+    return hit;
+}
+
+TriangleMesh::TriangleMesh(const std::vector<Vector3> &Vertices,
+                           const std::vector<std::uint32_t> &Indices) {
+    const std::size_t count = Indices.size() / 3;
+    if (count == 0)
+        return;
+
+    std::vector<AABB3> bounds(count);
+    m_indices.resize(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        bounds[i] = AABB3::Empty;
+        for (std::size_t corner = 0; corner < 3; ++corner)
+            bounds[i].selfMerge(Vertices[Indices[3 * i + corner]]);
+        m_indices[i] = static_cast<std::uint32_t>(i);
+    }
+
+    m_nodes.reserve(2 * count);
+    m_nodes.push_back({});
+    build(bounds, 0, 0, count, 0);
+
+    // the triangles in the order of the leaves, ready for the tests
+    m_triangles.reserve(count);
+    for (const auto index : m_indices) {
+        const auto &a = Vertices[Indices[3 * index]],
+                   &b = Vertices[Indices[3 * index + 1]],
+                   &c = Vertices[Indices[3 * index + 2]];
+
+        m_triangles.push_back({a, Vector3(b.x - a.x, b.y - a.y, b.z - a.z),
+                               Vector3(c.x - a.x, c.y - a.y, c.z - a.z)});
+    }
+}
+
+/* private */ void TriangleMesh::build(std::vector<AABB3> &Bounds,
+                                       std::size_t Node, std::size_t Begin,
+                                       std::size_t End, unsigned Depth) {
+    AABB3 box, centroids;
+    for (std::size_t i = Begin; i < End; ++i) {
+        const auto &bounds = Bounds[m_indices[i]];
+        box.selfMerge(bounds);
+        centroids.selfMerge(bounds.center());
+    }
+
+    m_nodes[Node].bounds = box;
+    m_nodes[Node].axis = 0;
+
+    const std::size_t count = End - Begin;
+    if (count <= MaxLeafSize) {
+        m_nodes[Node].first = static_cast<std::uint32_t>(Begin);
+        m_nodes[Node].count = static_cast<std::uint32_t>(count);
+        return;
+    }
+
+    const Vector3 cextent(centroids.maximum.x - centroids.minimum.x,
+                          centroids.maximum.y - centroids.minimum.y,
+                          centroids.maximum.z - centroids.minimum.z);
+    const unsigned axis =
+        cextent.x >= cextent.y ? (cextent.x >= cextent.z ? 0 : 2)
+                               : (cextent.y >= cextent.z ? 1 : 2);
+    const float low = component(centroids.minimum, axis),
+                extent = component(cextent, axis);
+
+    const auto centroidOf = [&](std::uint32_t index) {
+        return 0.5f * (component(Bounds[index].minimum, axis) +
+                       component(Bounds[index].maximum, axis));
+    };
+
+    const auto begin = m_indices.begin() + Begin,
+               end = m_indices.begin() + End;
+    std::size_t middle = Begin + count / 2;
+
+    if (extent > 0.0f && Depth < MaxHeuristicDepth) {
+        const float scale = static_cast<float>(BinCount) / extent;
+        const auto binOf = [&](std::uint32_t index) {
+            const auto bin =
+                static_cast<std::size_t>((centroidOf(index) - low) * scale);
+            return std::min(bin, BinCount - 1);
+        };
+
+        AABB3 bins[BinCount];
+        std::size_t binCounts[BinCount] = {};
+        for (std::size_t i = Begin; i < End; ++i) {
+            const auto bin = binOf(m_indices[i]);
+            bins[bin].selfMerge(Bounds[m_indices[i]]);
+            ++binCounts[bin];
+        }
+
+        const auto bestSplit = Internal::bestBinnedSplit(
+            bins, binCounts, count,
+            [](const AABB3 &a, const AABB3 &b) { return a.merge(b); },
+            [](const AABB3 &box) { return box.surfaceArea(); });
+
+        if (bestSplit != 0)
+            middle = static_cast<std::size_t>(
+                std::partition(begin, end,
+                               [&](std::uint32_t index) {
+                                   return binOf(index) < bestSplit;
+                               }) -
+                m_indices.begin());
+    } else if (extent > 0.0f) {
+        std::nth_element(begin, m_indices.begin() + middle, end,
+                         [&](std::uint32_t a, std::uint32_t b) {
+                             return centroidOf(a) < centroidOf(b);
+                         });
+    }
+
+    const std::size_t left = m_nodes.size();
+    m_nodes.push_back({});
+    build(Bounds, left, Begin, middle, Depth + 1);
+
+    const std::size_t right = m_nodes.size();
+    m_nodes.push_back({});
+    build(Bounds, right, middle, End, Depth + 1);
+
+    m_nodes[Node].first = static_cast<std::uint32_t>(right);
+    m_nodes[Node].count = 0;
+    m_nodes[Node].axis = axis;
+}
+
+std::size_t TriangleMesh::triangleCount() const { return m_triangles.size(); }
+
+AABB3 TriangleMesh::getBounds() const {
+    return m_nodes.empty() ? AABB3::Empty : m_nodes[0].bounds;
+}
+
+std::optional<TriangleMesh::Hit>
+TriangleMesh::intersectRay(Vector3 Origin, Vector3 Direction,
+                           float MaxDistance) const {
+    std::optional<Hit> result;
+    if (m_nodes.empty())
+        return result;
+
+    const Ray ray(Origin, Direction);
+    float closest = MaxDistance;
+
+    std::uint32_t stack[StackSize];
+    float stackDistance[StackSize];
+    std::size_t top = 0;
+
+    float distance;
+    if (!ray.boxDistance(m_nodes[0].bounds, closest, distance))
+        return result;
+
+    stack[top] = 0;
+    stackDistance[top++] = distance;
+
+    while (top > 0) {
+        --top;
+        if (stackDistance[top] > closest)
+            continue;
+
+        const auto &node = m_nodes[stack[top]];
+
+        if (node.count == 0) {
+            // visit the nearer child first, it may prune the other one
+            const std::uint32_t children[2] = {stack[top] + 1, node.first};
+            float distances[2];
+            bool hits[2];
+
+            for (unsigned i = 0; i < 2; ++i)
+                hits[i] = ray.boxDistance(m_nodes[children[i]].bounds, closest,
+                                          distances[i]);
+
+            const unsigned nearer =
+                (hits[0] && hits[1]) ? (distances[1] < distances[0] ? 1 : 0)
+                                     : (hits[0] ? 0 : 1);
+
+            for (unsigned i : {1 - nearer, nearer}) {
+                if (hits[i]) {
+                    stack[top] = children[i];
+                    stackDistance[top++] = distances[i];
+                }
+            }
+            continue;
+        }
+
+        for (std::uint32_t i = node.first; i < node.first + node.count; ++i) {
+            const auto &triangle = m_triangles[i];
+
+            TriangleHit hit;
+            if (ray.intersectTriangle(triangle.corner, triangle.edge1,
+                                      triangle.edge2, closest, hit)) {
+                closest = hit.distance;
+                result = Hit{m_indices[i], hit.distance, hit.u, hit.v};
+            }
+        }
+    }
+
+    return result;
+}
+
+void TriangleMesh::intersectRays(const Vector3SoA &Origins,
+                                 const Vector3SoA &Directions, Hit *Hits,
+                                 float MaxDistance) const {
+    const std::size_t count = Origins.size();
+    std::size_t i = 0;
+
+#if defined(CALCDA_SIMD_AVX) || defined(CALCDA_SIMD_SSE2)
+    for (; !m_nodes.empty() && i + PacketWidth <= count; i += PacketWidth) {
+        Packet packet;
+        packet.origin[0] = load(Origins.x.data() + i);
+        packet.origin[1] = load(Origins.y.data() + i);
+        packet.origin[2] = load(Origins.z.data() + i);
+        packet.direction[0] = load(Directions.x.data() + i);
+        packet.direction[1] = load(Directions.y.data() + i);
+        packet.direction[2] = load(Directions.z.data() + i);
+
+        for (unsigned axis = 0; axis < 3; ++axis) {
+            float inverse[PacketWidth];
+            const float *direction = (axis == 0   ? Directions.x
+                                      : axis == 1 ? Directions.y
+                                                  : Directions.z)
+                                         .data() +
+                                     i;
+            for (std::size_t lane = 0; lane < PacketWidth; ++lane)
+                inverse[lane] = slabInverse(direction[lane]);
+            packet.inverse[axis] = load(inverse);
+        }
+
+        packet.distance = broadcast(MaxDistance);
+        packet.u = packet.v = broadcast(0.0f);
+        std::fill(packet.triangle, packet.triangle + PacketWidth, NoTriangle);
+
+        // the children are ordered by the direction of the first ray
+        const float firstDirection[3] = {Directions.x[i], Directions.y[i],
+                                         Directions.z[i]};
+
+        std::uint32_t stack[StackSize];
+        std::size_t top = 0;
+        stack[top++] = 0;
+
+        while (top > 0) {
+            const std::uint32_t index = stack[--top];
+            const auto &node = m_nodes[index];
+
+            if (bits(packet.hitsBox(node.bounds)) == 0)
+                continue;
+
+            if (node.count == 0) {
+                const bool leftFirst = firstDirection[node.axis] >= 0.0f;
+                stack[top++] = leftFirst ? node.first : index + 1;
+                stack[top++] = leftFirst ? index + 1 : node.first;
+                continue;
+            }
+
+            for (std::uint32_t j = node.first; j < node.first + node.count;
+                 ++j)
+                packet.intersectTriangle(m_triangles[j].corner,
+                                         m_triangles[j].edge1,
+                                         m_triangles[j].edge2, m_indices[j]);
+        }
+
+        float distances[PacketWidth], us[PacketWidth], vs[PacketWidth];
+        store(distances, packet.distance);
+        store(us, packet.u);
+        store(vs, packet.v);
+
+        for (std::size_t lane = 0; lane < PacketWidth; ++lane)
+            Hits[i + lane] =
+                packet.triangle[lane] == NoTriangle
+                    ? Hit{NoTriangle, INFINITY, 0.0f, 0.0f}
+                    : Hit{packet.triangle[lane], distances[lane], us[lane],
+                          vs[lane]};
+    }
+#endif
+
+    for (; i < count; ++i) {
+        const auto hit =
+            intersectRay(Origins.get(i), Directions.get(i), MaxDistance);
+        Hits[i] = hit ? *hit : Hit{NoTriangle, INFINITY, 0.0f, 0.0f};
+    }
+}
+
+} // namespace Calcda
@@ -0,0 +1,571 @@
+#include <cmath>
+
+#include "VectorSoA.hpp"
+
+/*
+ * The bulk operations are plain loops over the raw streams, written so the
+ * compiler can vectorize them (no calls, no branches). Element-wise
+ * operations run one output stream at a time, which keeps the number of
+ * aliasing checks low enough for the vectorizer, and allows the output to be
+ * one of the inputs.
+ */
+
+namespace Calcda {
+
+namespace {
+template <typename Operation>
+void forEachElement(const float *Value, float *Out, std::size_t Count,
+                    Operation operation) {
+    for (std::size_t i = 0; i < Count; ++i)
+        Out[i] = operation(Value[i]);
+}
+
+template <typename Operation>
+void forEachElement(const float *Value1, const float *Value2, float *Out,
+                    std::size_t Count, Operation operation) {
+    for (std::size_t i = 0; i < Count; ++i)
+        Out[i] = operation(Value1[i], Value2[i]);
+}
+
+void crossKernel(const float *x1, const float *y1, const float *z1,
+                 const float *x2, const float *y2, const float *z2,
+                 float *CALCDA_RESTRICT xo, float *CALCDA_RESTRICT yo,
+                 float *CALCDA_RESTRICT zo, std::size_t Count) {
+    for (std::size_t i = 0; i < Count; ++i) {
+        xo[i] = y1[i] * z2[i] - z1[i] * y2[i];
+        yo[i] = z1[i] * x2[i] - x1[i] * z2[i];
+        zo[i] = x1[i] * y2[i] - y1[i] * x2[i];
+    }
+}
+
+inline float minimum(float Value1, float Value2) {
+    return (Value1 < Value2) ? Value1 : Value2;
+}
+
+inline float maximum(float Value1, float Value2) {
+    return (Value1 > Value2) ? Value1 : Value2;
+}
+
+inline float clampElement(float Value, float min, float max) {
+    Value = (Value > max) ? max : Value;
+    Value = (Value < min) ? min : Value;
+
+    return Value;
+}
+} // namespace
+
+#pragma region Vector2SoA
+
+Vector2SoA::Vector2SoA(std::size_t Size) : x(Size), y(Size) {}
+
+Vector2SoA::Vector2SoA(const std::vector<Vector2> &Vectors)
+    : Vector2SoA(Vectors.data(), Vectors.size()) {}
+
+Vector2SoA::Vector2SoA(const Vector2 *Vectors, std::size_t Count)
+    : x(Count), y(Count) {
+    float *xs = x.data(), *ys = y.data();
+
+    for (std::size_t i = 0; i < Count; ++i) {
+        xs[i] = Vectors[i].x;
+        ys[i] = Vectors[i].y;
+    }
+}
+
+std::size_t Vector2SoA::size() const { return x.size(); }
+
+void Vector2SoA::resize(std::size_t Size) {
+    x.resize(Size);
+    y.resize(Size);
+}
+
+void Vector2SoA::reserve(std::size_t Size) {
+    x.reserve(Size);
+    y.reserve(Size);
+}
+
+void Vector2SoA::append(const Vector2 &Value) {
+    x.push_back(Value.x);
+    y.push_back(Value.y);
+}
+
+Vector2 Vector2SoA::get(std::size_t Index) const {
+    return Vector2(x[Index], y[Index]);
+}
+
+void Vector2SoA::set(std::size_t Index, const Vector2 &Value) {
+    x[Index] = Value.x;
+    y[Index] = Value.y;
+}
+
+std::vector<Vector2> Vector2SoA::toVector() const {
+    std::vector<Vector2> result(size());
+
+    const float *xs = x.data(), *ys = y.data();
+
+    for (std::size_t i = 0; i < result.size(); ++i) {
+        result[i].x = xs[i];
+        result[i].y = ys[i];
+    }
+
+    return result;
+}
+
+void Vector2SoA::length(float *Out) const {
+    const float *xs = x.data(), *ys = y.data();
+    const std::size_t count = size();
+
+    for (std::size_t i = 0; i < count; ++i)
+        Out[i] = std::sqrt(xs[i] * xs[i] + ys[i] * ys[i]);
+}
+
+void Vector2SoA::lengthSquared(float *Out) const {
+    const float *xs = x.data(), *ys = y.data();
+    const std::size_t count = size();
+
+    for (std::size_t i = 0; i < count; ++i)
+        Out[i] = xs[i] * xs[i] + ys[i] * ys[i];
+}
+
+Vector2SoA &Vector2SoA::selfNormalize() {
+    float *xs = x.data(), *ys = y.data();
+    const std::size_t count = size();
+
+    for (std::size_t i = 0; i < count; ++i) {
+        const float lengthReciprocal =
+            1.0f / std::sqrt(xs[i] * xs[i] + ys[i] * ys[i]);
+
+        xs[i] *= lengthReciprocal;
+        ys[i] *= lengthReciprocal;
+    }
+
+    return *this;
+}
+
+/* static */ void Vector2SoA::dot(const Vector2SoA &Value1,
+                                  const Vector2SoA &Value2, float *Out) {
+    const float *x1 = Value1.x.data(), *y1 = Value1.y.data();
+    const float *x2 = Value2.x.data(), *y2 = Value2.y.data();
+    const std::size_t count = Value1.size();
+
+    for (std::size_t i = 0; i < count; ++i)
+        Out[i] = x1[i] * x2[i] + y1[i] * y2[i];
+}
+
+/* static */ void Vector2SoA::lerp(const Vector2SoA &Value1,
+                                   const Vector2SoA &Value2, float Amount,
+                                   Vector2SoA &Out) {
+    const auto interpolate = [Amount](float Value1, float Value2) {
+        return Value1 + (Value2 - Value1) * Amount;
+    };
+    const std::size_t count = Value1.size();
+
+    forEachElement(Value1.x.data(), Value2.x.data(), Out.x.data(), count,
+                   interpolate);
+    forEachElement(Value1.y.data(), Value2.y.data(), Out.y.data(), count,
+                   interpolate);
+}
+
+/* static */ void Vector2SoA::clamp(const Vector2SoA &Value,
+                                    const Vector2 &min, const Vector2 &max,
+                                    Vector2SoA &Out) {
+    const std::size_t count = Value.size();
+
+    forEachElement(Value.x.data(), Out.x.data(), count, [&](float X) {
+        return clampElement(X, min.x, max.x);
+    });
+    forEachElement(Value.y.data(), Out.y.data(), count, [&](float Y) {
+        return clampElement(Y, min.y, max.y);
+    });
+}
+
+/* static */ void Vector2SoA::vmin(const Vector2SoA &Value1,
+                                   const Vector2SoA &Value2,
+                                   Vector2SoA &Out) {
+    const std::size_t count = Value1.size();
+
+    forEachElement(Value1.x.data(), Value2.x.data(), Out.x.data(), count,
+                   minimum);
+    forEachElement(Value1.y.data(), Value2.y.data(), Out.y.data(), count,
+                   minimum);
+}
+
+/* static */ void Vector2SoA::vmax(const Vector2SoA &Value1,
+                                   const Vector2SoA &Value2,
+                                   Vector2SoA &Out) {
+    const std::size_t count = Value1.size();
+
+    forEachElement(Value1.x.data(), Value2.x.data(), Out.x.data(), count,
+                   maximum);
+    forEachElement(Value1.y.data(), Value2.y.data(), Out.y.data(), count,
+                   maximum);
+}
+
+// Vector2SoA
+#pragma endregion
+
+#pragma region Vector3SoA
+
+Vector3SoA::Vector3SoA(std::size_t Size) : x(Size), y(Size), z(Size) {}
+
+Vector3SoA::Vector3SoA(const std::vector<Vector3> &Vectors)
+    : Vector3SoA(Vectors.data(), Vectors.size()) {}
+
+Vector3SoA::Vector3SoA(const Vector3 *Vectors, std::size_t Count)
+    : x(Count), y(Count), z(Count) {
+    float *xs = x.data(), *ys = y.data(), *zs = z.data();
+
+    for (std::size_t i = 0; i < Count; ++i) {
+        xs[i] = Vectors[i].x;
+        ys[i] = Vectors[i].y;
+        zs[i] = Vectors[i].z;
+    }
+}
+
+std::size_t Vector3SoA::size() const { return x.size(); }
+
+void Vector3SoA::resize(std::size_t Size) {
+    x.resize(Size);
+    y.resize(Size);
+    z.resize(Size);
+}
+
+void Vector3SoA::reserve(std::size_t Size) {
+    x.reserve(Size);
+    y.reserve(Size);
+    z.reserve(Size);
+}
+
+void Vector3SoA::append(const Vector3 &Value) {
+    x.push_back(Value.x);
+    y.push_back(Value.y);
+    z.push_back(Value.z);
+}
+
+Vector3 Vector3SoA::get(std::size_t Index) const {
+    return Vector3(x[Index], y[Index], z[Index]);
+}
+
+void Vector3SoA::set(std::size_t Index, const Vector3 &Value) {
+    x[Index] = Value.x;
+    y[Index] = Value.y;
+    z[Index] = Value.z;
+}
+
+std::vector<Vector3> Vector3SoA::toVector() const {
+    std::vector<Vector3> result(size());
+
+    const float *xs = x.data(), *ys = y.data(), *zs = z.data();
+
+    for (std::size_t i = 0; i < result.size(); ++i) {
+        result[i].x = xs[i];
+        result[i].y = ys[i];
+        result[i].z = zs[i];
+    }
+
+    return result;
+}
+
+void Vector3SoA::length(float *Out) const {
+    const float *xs = x.data(), *ys = y.data(), *zs = z.data();
+    const std::size_t count = size();
+
+    for (std::size_t i = 0; i < count; ++i)
+        Out[i] = std::sqrt(xs[i] * xs[i] + ys[i] * ys[i] + zs[i] * zs[i]);
+}
+
+void Vector3SoA::lengthSquared(float *Out) const {
+    const float *xs = x.data(), *ys = y.data(), *zs = z.data();
+    const std::size_t count = size();
+
+    for (std::size_t i = 0; i < count; ++i)
+        Out[i] = xs[i] * xs[i] + ys[i] * ys[i] + zs[i] * zs[i];
+}
+
+Vector3SoA &Vector3SoA::selfNormalize() {
+    float *xs = x.data(), *ys = y.data(), *zs = z.data();
+    const std::size_t count = size();
+
+    for (std::size_t i = 0; i < count; ++i) {
+        const float lengthReciprocal =
+            1.0f / std::sqrt(xs[i] * xs[i] + ys[i] * ys[i] + zs[i] * zs[i]);
+
+        xs[i] *= lengthReciprocal;
+        ys[i] *= lengthReciprocal;
+        zs[i] *= lengthReciprocal;
+    }
+
+    return *this;
+}
+
+/* static */ void Vector3SoA::dot(const Vector3SoA &Value1,
+                                  const Vector3SoA &Value2, float *Out) {
+    const float *x1 = Value1.x.data(), *y1 = Value1.y.data(),
+                *z1 = Value1.z.data();
+    const float *x2 = Value2.x.data(), *y2 = Value2.y.data(),
+                *z2 = Value2.z.data();
+    const std::size_t count = Value1.size();
+
+    for (std::size_t i = 0; i < count; ++i)
+        Out[i] = x1[i] * x2[i] + y1[i] * y2[i] + z1[i] * z2[i];
+}
+
+/* static */ void Vector3SoA::cross(const Vector3SoA &Value1,
+                                    const Vector3SoA &Value2,
+                                    Vector3SoA &Out) {
+    crossKernel(Value1.x.data(), Value1.y.data(), Value1.z.data(),
+                Value2.x.data(), Value2.y.data(), Value2.z.data(),
+                Out.x.data(), Out.y.data(), Out.z.data(), Value1.size());
+}
+
+/* static */ void Vector3SoA::lerp(const Vector3SoA &Value1,
+                                   const Vector3SoA &Value2, float Amount,
+                                   Vector3SoA &Out) {
+    const auto interpolate = [Amount](float Value1, float Value2) {
+        return Value1 + (Value2 - Value1) * Amount;
+    };
+    const std::size_t count = Value1.size();
+
+    forEachElement(Value1.x.data(), Value2.x.data(), Out.x.data(), count,
+                   interpolate);
+    forEachElement(Value1.y.data(), Value2.y.data(), Out.y.data(), count,
+                   interpolate);
+    forEachElement(Value1.z.data(), Value2.z.data(), Out.z.data(), count,
+                   interpolate);
+}
+
+/* static */ void Vector3SoA::clamp(const Vector3SoA &Value,
+                                    const Vector3 &min, const Vector3 &max,
+                                    Vector3SoA &Out) {
+    const std::size_t count = Value.size();
+
+    forEachElement(Value.x.data(), Out.x.data(), count, [&](float X) {
+        return clampElement(X, min.x, max.x);
+    });
+    forEachElement(Value.y.data(), Out.y.data(), count, [&](float Y) {
+        return clampElement(Y, min.y, max.y);
+    });
+    forEachElement(Value.z.data(), Out.z.data(), count, [&](float Z) {
+        return clampElement(Z, min.z, max.z);
+    });
+}
+
+/* static */ void Vector3SoA::vmin(const Vector3SoA &Value1,
+                                   const Vector3SoA &Value2,
+                                   Vector3SoA &Out) {
+    const std::size_t count = Value1.size();
+
+    forEachElement(Value1.x.data(), Value2.x.data(), Out.x.data(), count,
+                   minimum);
+    forEachElement(Value1.y.data(), Value2.y.data(), Out.y.data(), count,
+                   minimum);
+    forEachElement(Value1.z.data(), Value2.z.data(), Out.z.data(), count,
+                   minimum);
+}
+
+/* static */ void Vector3SoA::vmax(const Vector3SoA &Value1,
+                                   const Vector3SoA &Value2,
+                                   Vector3SoA &Out) {
+    const std::size_t count = Value1.size();
+
+    forEachElement(Value1.x.data(), Value2.x.data(), Out.x.data(), count,
+                   maximum);
+    forEachElement(Value1.y.data(), Value2.y.data(), Out.y.data(), count,
+                   maximum);
+    forEachElement(Value1.z.data(), Value2.z.data(), Out.z.data(), count,
+                   maximum);
+}
+
+// Vector3SoA
+#pragma endregion
+
+#pragma region Vector4SoA
+
+Vector4SoA::Vector4SoA(std::size_t Size)
+    : x(Size), y(Size), z(Size), w(Size) {}
+
+Vector4SoA::Vector4SoA(const std::vector<Vector4> &Vectors)
+    : Vector4SoA(Vectors.data(), Vectors.size()) {}
+
+Vector4SoA::Vector4SoA(const Vector4 *Vectors, std::size_t Count)
+    : x(Count), y(Count), z(Count), w(Count) {
+    float *xs = x.data(), *ys = y.data(), *zs = z.data(), *ws = w.data();
+
+    for (std::size_t i = 0; i < Count; ++i) {
+        xs[i] = Vectors[i].x;
+        ys[i] = Vectors[i].y;
+        zs[i] = Vectors[i].z;
+        ws[i] = Vectors[i].w;
+    }
+}
+
+std::size_t Vector4SoA::size() const { return x.size(); }
+
+void Vector4SoA::resize(std::size_t Size) {
+    x.resize(Size);
+    y.resize(Size);
+    z.resize(Size);
+    w.resize(Size);
+}
+
+void Vector4SoA::reserve(std::size_t Size) {
+    x.reserve(Size);
+    y.reserve(Size);
+    z.reserve(Size);
+    w.reserve(Size);
+}
+
+void Vector4SoA::append(const Vector4 &Value) {
+    x.push_back(Value.x);
+    y.push_back(Value.y);
+    z.push_back(Value.z);
+    w.push_back(Value.w);
+}
+
+Vector4 Vector4SoA::get(std::size_t Index) const {
+    return Vector4(x[Index], y[Index], z[Index], w[Index]);
+}
+
+void Vector4SoA::set(std::size_t Index, const Vector4 &Value) {
+    x[Index] = Value.x;
+    y[Index] = Value.y;
+    z[Index] = Value.z;
+    w[Index] = Value.w;
+}
+
+std::vector<Vector4> Vector4SoA::toVector() const {
+    std::vector<Vector4> result(size());
+
+    const float *xs = x.data(), *ys = y.data(), *zs = z.data(),
+                *ws = w.data();
+
+    for (std::size_t i = 0; i < result.size(); ++i) {
+        result[i].x = xs[i];
+        result[i].y = ys[i];
+        result[i].z = zs[i];
+        result[i].w = ws[i];
+    }
+
+    return result;
+}
+
+void Vector4SoA::length(float *Out) const {
+    const float *xs = x.data(), *ys = y.data(), *zs = z.data(),
+                *ws = w.data();
+    const std::size_t count = size();
+
+    for (std::size_t i = 0; i < count; ++i)
+        Out[i] = std::sqrt(xs[i] * xs[i] + ys[i] * ys[i] + zs[i] * zs[i] +
+                           ws[i] * ws[i]);
+}
+
+void Vector4SoA::lengthSquared(float *Out) const {
+    const float *xs = x.data(), *ys = y.data(), *zs = z.data(),
+                *ws = w.data();
+    const std::size_t count = size();
+
+    for (std::size_t i = 0; i < count; ++i)
+        Out[i] =
+            xs[i] * xs[i] + ys[i] * ys[i] + zs[i] * zs[i] + ws[i] * ws[i];
+}
+
+Vector4SoA &Vector4SoA::selfNormalize() {
+    float *xs = x.data(), *ys = y.data(), *zs = z.data(), *ws = w.data();
+    const std::size_t count = size();
+
+    for (std::size_t i = 0; i < count; ++i) {
+        const float lengthReciprocal =
+            1.0f / std::sqrt(xs[i] * xs[i] + ys[i] * ys[i] + zs[i] * zs[i] +
+                             ws[i] * ws[i]);
+
+        xs[i] *= lengthReciprocal;
+        ys[i] *= lengthReciprocal;
+        zs[i] *= lengthReciprocal;
+        ws[i] *= lengthReciprocal;
+    }
+
+    return *this;
+}
+
+/* static */ void Vector4SoA::dot(const Vector4SoA &Value1,
+                                  const Vector4SoA &Value2, float *Out) {
+    const float *x1 = Value1.x.data(), *y1 = Value1.y.data(),
+                *z1 = Value1.z.data(), *w1 = Value1.w.data();
+    const float *x2 = Value2.x.data(), *y2 = Value2.y.data(),
+                *z2 = Value2.z.data(), *w2 = Value2.w.data();
+    const std::size_t count = Value1.size();
+
+    for (std::size_t i = 0; i < count; ++i)
+        Out[i] = x1[i] * x2[i] + y1[i] * y2[i] + z1[i] * z2[i] + w1[i] * w2[i];
+}
+
+/* static */ void Vector4SoA::lerp(const Vector4SoA &Value1,
+                                   const Vector4SoA &Value2, float Amount,
+                                   Vector4SoA &Out) {
+    const auto interpolate = [Amount](float Value1, float Value2) {
+        return Value1 + (Value2 - Value1) * Amount;
+    };
+    const std::size_t count = Value1.size();
+
+    forEachElement(Value1.x.data(), Value2.x.data(), Out.x.data(), count,
+                   interpolate);
+    forEachElement(Value1.y.data(), Value2.y.data(), Out.y.data(), count,
+                   interpolate);
+    forEachElement(Value1.z.data(), Value2.z.data(), Out.z.data(), count,
+                   interpolate);
+    forEachElement(Value1.w.data(), Value2.w.data(), Out.w.data(), count,
+                   interpolate);
+}
+
+/* static */ void Vector4SoA::clamp(const Vector4SoA &Value,
+                                    const Vector4 &min, const Vector4 &max,
+                                    Vector4SoA &Out) {
+    const std::size_t count = Value.size();
+
+    forEachElement(Value.x.data(), Out.x.data(), count, [&](float X) {
+        return clampElement(X, min.x, max.x);
+    });
+    forEachElement(Value.y.data(), Out.y.data(), count, [&](float Y) {
+        return clampElement(Y, min.y, max.y);
+    });
+    forEachElement(Value.z.data(), Out.z.data(), count, [&](float Z) {
+        return clampElement(Z, min.z, max.z);
+    });
+    forEachElement(Value.w.data(), Out.w.data(), count, [&](float W) {
+        return clampElement(W, min.w, max.w);
+    });
+}
+
+/* static */ void Vector4SoA::vmin(const Vector4SoA &Value1,
+                                   const Vector4SoA &Value2,
+                                   Vector4SoA &Out) {
+    const std::size_t count = Value1.size();
+
+    forEachElement(Value1.x.data(), Value2.x.data(), Out.x.data(), count,
+                   minimum);
+    forEachElement(Value1.y.data(), Value2.y.data(), Out.y.data(), count,
+                   minimum);
+    forEachElement(Value1.z.data(), Value2.z.data(), Out.z.data(), count,
+                   minimum);
+    forEachElement(Value1.w.data(), Value2.w.data(), Out.w.data(), count,
+                   minimum);
+}
+
+/* static */ void Vector4SoA::vmax(const Vector4SoA &Value1,
+                                   const Vector4SoA &Value2,
+                                   Vector4SoA &Out) {
+    const std::size_t count = Value1.size();
+
+    forEachElement(Value1.x.data(), Value2.x.data(), Out.x.data(), count,
+                   maximum);
+    forEachElement(Value1.y.data(), Value2.y.data(), Out.y.data(), count,
+                   maximum);
+    forEachElement(Value1.z.data(), Value2.z.data(), Out.z.data(), count,
+                   maximum);
+    forEachElement(Value1.w.data(), Value2.w.data(), Out.w.data(), count,
+                   maximum);
+}
+
+// Vector4SoA
+#pragma endregion
+
+} // namespace Calcda
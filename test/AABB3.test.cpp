@@ -0,0 +1,170 @@
+#include <catch2/catch_all.hpp>
+
+#include "AABB3.hpp"
+#include "random.hpp"
+
+#include <cmath>
+#include <vector>
+
+using Calcda::AABB3;
+using Calcda::Matrix4;
+using Calcda::Vector3;
+
+namespace {
+AABB3 randomBox(const std::vector<float> &x, std::size_t i) {
+    return AABB3::fromCenter(Vector3(x[i] - 10.0f, x[i + 1] - 10.0f,
+                                     x[i + 2] - 10.0f),
+                             Vector3(x[i + 3], x[i + 4], x[i + 5]) / 8.0f);
+}
+} // namespace
+
+TEST_CASE("AABB3 operations", "AABB3") {
+    CALCDA_DEFINE_RANDOM(x)
+
+    CALCDA_REQUIRE_RANDOM(x, 12)
+    SECTION("merge and intersection") {
+        const auto first = randomBox(x, 0), second = randomBox(x, 6);
+        const auto merged = first.merge(second);
+
+        REQUIRE(merged.contains(first));
+        REQUIRE(merged.contains(second));
+        REQUIRE(merged.minimum.x == std::min(first.minimum.x,
+                                             second.minimum.x));
+        REQUIRE(merged.maximum.z == std::max(first.maximum.z,
+                                             second.maximum.z));
+        REQUIRE(AABB3::Empty.merge(first) == first);
+        REQUIRE(first.merge(AABB3::Empty) == first);
+
+        const auto overlap = first.intersection(second);
+        REQUIRE(overlap.isEmpty() == !first.intersects(second));
+        if (!overlap.isEmpty()) {
+            REQUIRE(first.contains(overlap));
+            REQUIRE(second.contains(overlap));
+        }
+        REQUIRE(first.intersection(first) == first);
+        REQUIRE(first.intersection(AABB3::Empty).isEmpty());
+
+        const Vector3 points[] = {first.minimum, second.maximum,
+                                  second.center()};
+        const auto bounds = AABB3::fromPoints(points, 3);
+        for (const auto &point : points)
+            REQUIRE(bounds.containsPoint(point));
+        REQUIRE(AABB3::fromPoints(points, 0).isEmpty());
+    }
+
+    CALCDA_REQUIRE_RANDOM(x, 9)
+    SECTION("transform bounds the transformed corners") {
+        const auto box = randomBox(x, 0);
+        const auto transform =
+            Matrix4::translation(x[6], -x[7], 1.0f) *
+            Matrix4::rotation(Calcda::Axis::Y, x[8]) *
+            Matrix4::rotation(Calcda::Axis::X, x[6]) *
+            Matrix4::scale(2.0f, 0.5f, 1.0f);
+
+        Vector3 corners[8];
+        for (std::size_t i = 0; i < 8; ++i)
+            corners[i] = Vector3(i & 1 ? box.maximum.x : box.minimum.x,
+                                 i & 2 ? box.maximum.y : box.minimum.y,
+                                 i & 4 ? box.maximum.z : box.minimum.z);
+        transform.transformPoints(corners, corners, 8);
+
+        const auto expected = AABB3::fromPoints(corners, 8);
+        const auto result = box.transform(transform);
+        REQUIRE(result.minimum.x == Catch::Approx(expected.minimum.x));
+        REQUIRE(result.minimum.y == Catch::Approx(expected.minimum.y));
+        REQUIRE(result.minimum.z == Catch::Approx(expected.minimum.z));
+        REQUIRE(result.maximum.x == Catch::Approx(expected.maximum.x));
+        REQUIRE(result.maximum.y == Catch::Approx(expected.maximum.y));
+        REQUIRE(result.maximum.z == Catch::Approx(expected.maximum.z));
+        REQUIRE(AABB3::Empty.transform(transform).isEmpty());
+    }
+
+    SECTION("ray tests") {
+        const AABB3 box(Vector3(-1.0f, -1.0f, -1.0f), Vector3::One);
+
+        REQUIRE(box.intersectRay(Vector3(-3.0f, 0.0f, 0.0f), Vector3::UnitX) ==
+                Catch::Approx(2.0f));
+        REQUIRE(box.intersectRay(Vector3(-3.0f, 0.0f, 0.0f),
+                                 Vector3(4.0f, 0.0f, 0.0f)) ==
+                Catch::Approx(0.5f));
+        REQUIRE(*box.intersectRay(Vector3::Zero, Vector3::UnitY) == 0.0f);
+        REQUIRE_FALSE(box.intersectRay(Vector3(-3.0f, 0.0f, 0.0f),
+                                       -Vector3::UnitX));
+        REQUIRE_FALSE(
+            box.intersectRay(Vector3(-3.0f, 0.0f, 0.0f), Vector3::UnitX, 1.5f));
+        REQUIRE_FALSE(
+            box.intersectRay(Vector3(-3.0f, 2.0f, 0.0f), Vector3::UnitX));
+
+        REQUIRE_FALSE(AABB3::Empty.intersectRay(Vector3::Zero, Vector3::One));
+        REQUIRE_FALSE(AABB3().intersectRay(Vector3::Zero, Vector3::UnitX));
+    }
+
+    CALCDA_REQUIRE_RANDOM(x, 6 * 37 + 6)
+    SECTION("batch ray test matches the single test") {
+        // 37 boxes, so one is left over after the SIMD blocks
+        std::vector<AABB3> boxes;
+        for (std::size_t i = 0; i < 37; ++i)
+            boxes.push_back(randomBox(x, 6 * i));
+
+        const Vector3 origin(x[222] - 10.0f, x[223] - 10.0f, x[224] - 10.0f),
+            direction(x[225] - 10.5f, x[226] - 10.5f, x[227] - 10.5f);
+
+        std::vector<float> distances(boxes.size());
+        AABB3::intersectRayBatch(origin, direction, boxes.data(),
+                                 boxes.size(), distances.data(), 5.0f);
+
+        for (std::size_t i = 0; i < boxes.size(); ++i) {
+            const auto expected =
+                boxes[i].intersectRay(origin, direction, 5.0f);
+            REQUIRE(std::isinf(distances[i]) == !expected.has_value());
+            if (expected)
+                REQUIRE(distances[i] == Catch::Approx(*expected));
+        }
+    }
+
+    SECTION("batch ray test of rays in the planes of faces") {
+        // 5 boxes, so the last one is tested on its own
+        const std::vector<AABB3> boxes(5, AABB3(Vector3::Zero, Vector3::One));
+        std::vector<float> distances(boxes.size());
+
+        for (const float y : {0.0f, 1.0f}) {
+            AABB3::intersectRayBatch(Vector3(-1.0f, y, 0.5f), Vector3::UnitX,
+                                     boxes.data(), boxes.size(),
+                                     distances.data());
+            for (const float distance : distances)
+                REQUIRE(distance == 1.0f);
+        }
+
+        AABB3::intersectRayBatch(Vector3(-1.0f, 1.5f, 0.5f), Vector3::UnitX,
+                                 boxes.data(), boxes.size(), distances.data());
+        for (const float distance : distances)
+            REQUIRE(std::isinf(distance));
+    }
+
+    SECTION("ray tests with denormal direction components") {
+        // the ray starts left of the boxes and points away from them
+        const Vector3 origin(-1.0f, 0.5f, 0.5f), direction(-1e-40f, 0.0f, 0.0f);
+        REQUIRE(std::fpclassify(direction.x) == FP_SUBNORMAL);
+
+        const AABB3 box(Vector3::Zero, Vector3::One);
+        REQUIRE_FALSE(box.intersectRay(origin, direction));
+
+        const std::vector<AABB3> boxes(5, box);
+        std::vector<float> distances(boxes.size());
+        AABB3::intersectRayBatch(origin, direction, boxes.data(), boxes.size(),
+                                 distances.data());
+        for (const float distance : distances)
+            REQUIRE(std::isinf(distance));
+    }
+
+    SECTION("batch ray test of empty boxes") {
+        // in the SIMD block and on their own
+        const std::vector<AABB3> boxes(5, AABB3::Empty);
+        std::vector<float> distances(boxes.size());
+
+        AABB3::intersectRayBatch(Vector3::Zero, Vector3::One, boxes.data(),
+                                 boxes.size(), distances.data());
+        for (const float distance : distances)
+            REQUIRE(std::isinf(distance));
+    }
+}
@@ -0,0 +1,207 @@
+#include <catch2/catch_all.hpp>
+
+#include "ConvexHull.hpp"
+#include "Predicates.hpp"
+#include "random.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <utility>
+#include <vector>
+
+using Calcda::ConvexHull3;
+using Calcda::Polygon;
+using Calcda::Vector2;
+using Calcda::Vector3;
+using Calcda::Predicates::orient2d;
+
+namespace {
+// the hull turns left at every corner, and no point is right of an edge
+void requireConvexHull(const std::vector<Vector2> &Points,
+                       const Polygon &Hull) {
+    const auto hull = Hull.getPoints();
+    const auto leftmost = std::min_element(
+        Points.begin(), Points.end(), [](Vector2 a, Vector2 b) {
+            return a.x < b.x || (a.x == b.x && a.y < b.y);
+        });
+    REQUIRE(hull.front() == *leftmost);
+
+    for (std::size_t i = 0; i < hull.size(); ++i) {
+        const Vector2 a = hull[i], b = hull[(i + 1) % hull.size()],
+                      c = hull[(i + 2) % hull.size()];
+        REQUIRE(orient2d(a, b, c) > 0.0);
+        REQUIRE(std::find(Points.begin(), Points.end(), a) != Points.end());
+
+        REQUIRE(std::none_of(Points.begin(), Points.end(), [&](Vector2 p) {
+            return orient2d(a, b, p) < 0.0;
+        }));
+    }
+}
+
+double hullVolume(const ConvexHull3 &Hull) {
+    double volume = 0.0;
+    for (std::size_t i = 0; i < Hull.indices.size(); i += 3) {
+        const Vector3 a = Hull.vertices[Hull.indices[i]],
+                      b = Hull.vertices[Hull.indices[i + 1]],
+                      c = Hull.vertices[Hull.indices[i + 2]];
+        volume += Vector3::dot(a, Vector3::cross(b, c)) / 6.0;
+    }
+
+    return volume;
+}
+
+/*
+ * Every edge is shared by two triangles that run it in opposite directions,
+ * and no point is above a triangle by more than Tolerance
+ */
+void requireConvexHull(const std::vector<Vector3> &Points,
+                       const ConvexHull3 &Hull, float Tolerance) {
+    REQUIRE(Hull.indices.size() % 3 == 0);
+    REQUIRE(Hull.indices.size() >= 12);
+
+    std::map<std::pair<std::uint32_t, std::uint32_t>, int> edges;
+    for (std::size_t i = 0; i < Hull.indices.size(); i += 3)
+        for (std::size_t j = 0; j < 3; ++j)
+            ++edges[{Hull.indices[i + j], Hull.indices[i + (j + 1) % 3]}];
+
+    for (const auto &edge : edges) {
+        REQUIRE(edge.second == 1);
+        REQUIRE(edges.count({edge.first.second, edge.first.first}) == 1);
+    }
+
+    // Euler's formula for a closed surface without holes
+    const std::size_t faces = Hull.indices.size() / 3;
+    REQUIRE(Hull.vertices.size() + faces == edges.size() / 2 + 2);
+
+    for (std::size_t i = 0; i < Hull.indices.size(); i += 3) {
+        const Vector3 a = Hull.vertices[Hull.indices[i]],
+                      b = Hull.vertices[Hull.indices[i + 1]],
+                      c = Hull.vertices[Hull.indices[i + 2]];
+        const Vector3 normal = Vector3::cross(b - a, c - a);
+        const float length = normal.length();
+        if (length == 0.0f)
+            continue;
+
+        REQUIRE(std::none_of(Points.begin(), Points.end(), [&](Vector3 p) {
+            return Vector3::dot(p - a, normal) / length > Tolerance;
+        }));
+    }
+}
+} // namespace
+
+TEST_CASE("Convex hull of points", "ConvexHull") {
+    SECTION("degenerate inputs") {
+        REQUIRE(Calcda::computeConvexHull(std::vector<Vector2>())
+                    .getPoints()
+                    .empty());
+
+        const std::vector<Vector2> same(5, Vector2(2.0f, 3.0f));
+        REQUIRE(Calcda::computeConvexHull(same).getPoints().toVector() ==
+                std::vector<Vector2>{Vector2(2.0f, 3.0f)});
+
+        const std::vector<Vector2> line = {
+            Vector2(2.0f, 2.0f), Vector2(0.0f, 0.0f), Vector2(3.0f, 3.0f),
+            Vector2(1.0f, 1.0f), Vector2(3.0f, 3.0f)};
+        REQUIRE(Calcda::computeConvexHull(line).getPoints().toVector() ==
+                std::vector<Vector2>{Vector2(0.0f, 0.0f), Vector2(3.0f, 3.0f)});
+    }
+
+    SECTION("square with points on the edges") {
+        std::vector<Vector2> points = {
+            Vector2(4.0f, 4.0f), Vector2(2.0f, 0.0f), Vector2(0.0f, 4.0f),
+            Vector2(0.0f, 0.0f), Vector2(4.0f, 0.0f), Vector2(4.0f, 1.0f),
+            Vector2(2.0f, 2.0f), Vector2(0.0f, 4.0f), Vector2(1.0f, 3.0f)};
+
+        const Polygon hull = Calcda::computeConvexHull(points);
+        REQUIRE(hull.getPoints().toVector() ==
+                std::vector<Vector2>{Vector2(0.0f, 0.0f), Vector2(4.0f, 0.0f),
+                                     Vector2(4.0f, 4.0f), Vector2(0.0f, 4.0f)});
+        REQUIRE(hull.getArea() == 16.0f);
+    }
+
+    CALCDA_DEFINE_RANDOM(x)
+
+    // enough points for the threads to start
+    constexpr std::size_t Count = 100000;
+    CALCDA_REQUIRE_RANDOM(x, 2 * Count)
+    std::vector<Vector2> points;
+    for (std::size_t i = 0; i < Count; ++i)
+        points.emplace_back(x[2 * i], x[2 * i + 1]);
+
+    SECTION("uniform points") {
+        const Polygon hull = Calcda::computeConvexHull(points, 1);
+        requireConvexHull(points, hull);
+
+        for (const unsigned int threads : {2U, 3U, 0U})
+            REQUIRE(Calcda::computeConvexHull(points, threads)
+                        .getPoints()
+                        .toVector() == hull.getPoints().toVector());
+    }
+
+    SECTION("points on a circle") {
+        std::vector<Vector2> circle;
+        for (std::size_t i = 0; i < 1000; ++i) {
+            const float angle = x[i] * 6.2831853f / 19.0f;
+            circle.emplace_back(10.0f * std::cos(angle),
+                                10.0f * std::sin(angle));
+        }
+
+        requireConvexHull(circle, Calcda::computeConvexHull(circle));
+    }
+}
+
+TEST_CASE("Convex hull of 3D points", "ConvexHull") {
+    SECTION("degenerate inputs") {
+        REQUIRE(
+            Calcda::computeConvexHull(std::vector<Vector3>()).indices.empty());
+        REQUIRE(Calcda::computeConvexHull(
+                    std::vector<Vector3>(3, Vector3(1.0f, 2.0f, 3.0f)))
+                    .indices.empty());
+
+        const std::vector<Vector3> plane = {
+            Vector3(0.0f, 0.0f, 1.0f), Vector3(4.0f, 0.0f, 1.0f),
+            Vector3(0.0f, 4.0f, 1.0f), Vector3(4.0f, 4.0f, 1.0f),
+            Vector3(2.0f, 1.0f, 1.0f)};
+        REQUIRE(Calcda::computeConvexHull(plane).vertices.empty());
+    }
+
+    CALCDA_DEFINE_RANDOM(x)
+
+    constexpr std::size_t Count = 2000;
+    CALCDA_REQUIRE_RANDOM(x, 3 * Count)
+
+    SECTION("cube around random points") {
+        std::vector<Vector3> points;
+        for (std::size_t i = 0; i < Count; ++i)
+            points.emplace_back(x[3 * i], x[3 * i + 1], x[3 * i + 2]);
+        for (int corner = 0; corner < 8; ++corner)
+            points.emplace_back(corner & 1 ? 21.0f : 0.0f,
+                                corner & 2 ? 21.0f : 0.0f,
+                                corner & 4 ? 21.0f : 0.0f);
+
+        const ConvexHull3 hull = Calcda::computeConvexHull(points);
+        requireConvexHull(points, hull, 1e-4f);
+        REQUIRE(hull.vertices.size() == 8);
+        REQUIRE(hull.indices.size() == 36);
+        REQUIRE(hullVolume(hull) == Catch::Approx(21.0 * 21.0 * 21.0));
+    }
+
+    SECTION("random and spherical points") {
+        std::vector<Vector3> points, sphere;
+        for (std::size_t i = 0; i < Count; ++i) {
+            const Vector3 point(x[3 * i], x[3 * i + 1], x[3 * i + 2]);
+            points.push_back(point);
+            sphere.push_back(
+                (point - Vector3(10.5f, 10.5f, 10.5f)).normalize() *
+                Vector3(10.0f, 10.0f, 10.0f));
+        }
+
+        requireConvexHull(points, Calcda::computeConvexHull(points), 1e-4f);
+
+        const ConvexHull3 hull = Calcda::computeConvexHull(sphere);
+        requireConvexHull(sphere, hull, 1e-4f);
+        REQUIRE(hullVolume(hull) ==
+                Catch::Approx(4.0 / 3.0 * 3.14159265 * 1000.0).epsilon(0.05));
+    }
+}
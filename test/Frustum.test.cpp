@@ -0,0 +1,100 @@
+#include <catch2/catch_all.hpp>
+
+#include "Frustum.hpp"
+#include "random.hpp"
+
+#include <cmath>
+
+using Calcda::Frustum;
+using Calcda::Matrix4;
+using Calcda::Vector3;
+using Calcda::Vector3SoA;
+
+TEST_CASE("Frustum culling", "Frustum") {
+    // looking down -Z from the origin, 1 to 100 units away
+    const Frustum frustum(
+        Matrix4::perspective(0.5f, 4.0f / 3.0f, 1.0f, 100.0f) *
+        Matrix4::lookAt(Vector3::Zero, Vector3(0.0f, 0.0f, -1.0f),
+                        Vector3::UnitY));
+
+    SECTION("planes") {
+        for (std::size_t i = 0; i < Frustum::PlaneCount; ++i) {
+            const auto &normal = frustum.getPlane(i).normal;
+            REQUIRE(std::sqrt(Vector3::dot(normal, normal)) ==
+                    Catch::Approx(1.0f));
+        }
+
+        // near and far
+        REQUIRE(frustum.getPlane(4).signedDistance(Vector3::Zero) ==
+                Catch::Approx(-1.0f));
+        REQUIRE(frustum.getPlane(5).signedDistance(Vector3::Zero) ==
+                Catch::Approx(100.0f));
+    }
+
+    SECTION("single tests") {
+        REQUIRE(frustum.containsPoint(Vector3(0.0f, 0.0f, -10.0f)));
+        REQUIRE_FALSE(frustum.containsPoint(Vector3(0.0f, 0.0f, 10.0f)));
+        REQUIRE_FALSE(frustum.containsPoint(Vector3(0.0f, 0.0f, -0.5f)));
+        REQUIRE_FALSE(frustum.containsPoint(Vector3(0.0f, 0.0f, -101.0f)));
+        REQUIRE_FALSE(frustum.containsPoint(Vector3(50.0f, 0.0f, -10.0f)));
+
+        REQUIRE(frustum.intersectsSphere(Vector3(0.0f, 0.0f, 1.0f), 2.5f));
+        REQUIRE_FALSE(
+            frustum.intersectsSphere(Vector3(0.0f, 0.0f, 1.0f), 1.5f));
+
+        REQUIRE(frustum.intersectsBox(Vector3(-100.0f, -100.0f, -50.0f),
+                                      Vector3(100.0f, 100.0f, -40.0f)));
+        REQUIRE(frustum.intersectsBox(Vector3(-1.0f, -1.0f, -2.0f),
+                                      Vector3(1.0f, 1.0f, 2.0f)));
+        REQUIRE_FALSE(frustum.intersectsBox(Vector3(-1.0f, -1.0f, 1.0f),
+                                            Vector3(1.0f, 1.0f, 2.0f)));
+    }
+
+    CALCDA_DEFINE_RANDOM(x)
+
+    CALCDA_REQUIRE_RANDOM(x, 7 * 75)
+    SECTION("batches match the single tests") {
+        // 75 objects, so some are left over after the SIMD blocks
+        const std::size_t count = 75;
+        Vector3SoA centers, mins, maxs;
+        std::vector<float> radii;
+        for (std::size_t i = 0; i < count; ++i) {
+            const float *values = x.data() + 7 * i;
+            const Vector3 center(4.0f * (values[0] - 10.5f),
+                                 4.0f * (values[1] - 10.5f),
+                                 -6.0f * values[2]);
+            const Vector3 extent(values[3], values[4], values[5]);
+
+            centers.append(center);
+            radii.push_back(values[6]);
+            mins.append(center - extent);
+            maxs.append(center + extent);
+        }
+
+        std::uint32_t spheres[3], boxes[3];
+        frustum.intersectsSpheres(centers, radii.data(), spheres);
+        frustum.intersectsBoxes(mins, maxs, boxes);
+
+        std::size_t visible = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            const bool sphere = (spheres[i / 32] >> (i % 32)) & 1U,
+                       box = (boxes[i / 32] >> (i % 32)) & 1U;
+
+            REQUIRE(sphere ==
+                    frustum.intersectsSphere(centers.get(i), radii[i]));
+            REQUIRE(box == frustum.intersectsBox(mins.get(i), maxs.get(i)));
+
+            // conservative: anything with its center inside is visible
+            if (frustum.containsPoint(centers.get(i))) {
+                REQUIRE(sphere);
+                REQUIRE(box);
+            }
+            visible += sphere;
+        }
+
+        REQUIRE(visible > 0);
+        REQUIRE(visible < count);
+        REQUIRE(spheres[2] >> (count % 32) == 0U);
+        REQUIRE(boxes[2] >> (count % 32) == 0U);
+    }
+}
@@ -1,5 +1,15 @@
 #include <catch2/catch_all.hpp>
+#include "BoundingVolumeHierarchy.hpp"
 #include "Geometry.hpp"
+#include "Predicates.hpp"
+#include "SegmentIntersection.hpp"
+#include "random.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
 
 TEST_CASE("Polygon intersections", "Polygon") {
     using namespace Calcda;
@@ -16,4 +26,804 @@ TEST_CASE("Polygon intersections", "Polygon") {
                      Catch::Matchers::UnorderedEquals(std::vector<Vector2>{
                          Vector2(1.0f, 1.0f), Vector2(0.5f, 0.0f)}));
     }
-}
\ No newline at end of file
+
+    SECTION("intersection into a caller buffer") {
+        Vector2 buffer[4];
+        const auto count =
+            square.intersectLine(Vector2(0.25, -0.5f), Vector2(1.0f, 1.0f),
+                                 LineType::RAY, buffer, 4);
+
+        REQUIRE(count == 2);
+        REQUIRE_THAT(std::vector<Vector2>(buffer, buffer + count),
+                     Catch::Matchers::UnorderedEquals(std::vector<Vector2>{
+                         Vector2(1.0f, 1.0f), Vector2(0.5f, 0.0f)}));
+
+        // the count is exact even when the buffer is too small
+        REQUIRE(square.intersectLine(Vector2(-1.0f, 0.5f), Vector2(0.0f, 0.5f),
+                                     LineType::LINE, nullptr, 0) == 2);
+
+        const Line diagonal(Vector2(0.0f, 0.0f), Vector2(1.0f, 1.0f),
+                            LineType::SEGMENT);
+        REQUIRE(diagonal.intersectLine(Vector2(0.0f, 1.0f),
+                                       Vector2(1.0f, 0.0f), LineType::SEGMENT,
+                                       buffer, Line::MaxIntersections) == 1);
+        REQUIRE(buffer[0] == Vector2(0.5f, 0.5f));
+    }
+
+    SECTION("intersections are sorted along the line, without duplicates") {
+        const Polygon diamond = {Vector2(0.3f, 0.0f), Vector2(0.7f, 0.35f),
+                                 Vector2(0.3f, 0.7f), Vector2(-0.1f, 0.35f)};
+
+        // through the left and right vertices, from the right
+        const auto intersections = diamond.intersectLine(
+            Vector2(0.9f, 0.35f), Vector2(0.8f, 0.35f), LineType::RAY);
+
+        REQUIRE(intersections.size() == 2);
+        REQUIRE(intersections[0].x == Catch::Approx(0.7f));
+        REQUIRE(intersections[1].x == Catch::Approx(-0.1f));
+
+        // the buffer keeps the first hits along the line
+        Vector2 nearest;
+        REQUIRE(diamond.intersectLine(Vector2(-0.5f, 0.35f),
+                                      Vector2(0.0f, 0.35f), LineType::LINE,
+                                      &nearest, 1) == 2);
+        REQUIRE(nearest.x == Catch::Approx(-0.1f));
+
+        // even behind a, which is nearer to the right vertex
+        REQUIRE(diamond.intersectLine(Vector2(0.6f, 0.35f),
+                                      Vector2(0.7f, 0.35f), LineType::LINE,
+                                      &nearest, 1) == 2);
+        REQUIRE(nearest.x == Catch::Approx(-0.1f));
+
+        const auto edges = square.intersectLineEx(
+            Vector2(2.0f, 0.5f), Vector2(1.5f, 0.5f), LineType::RAY);
+
+        REQUIRE(edges.size() == 2);
+        REQUIRE(edges[0].intersection == Vector2(1.0f, 0.5f));
+        REQUIRE(edges[1].intersection == Vector2(0.0f, 0.5f));
+    }
+
+    SECTION("close hits on consecutive edges are not merged") {
+        // a notch 2e-6 wide, whose edges are hit away from their vertices
+        const Polygon notched = {
+            Vector2(1.0f, 0.0f),      Vector2(3.0f, 0.0f),
+            Vector2(3.0f, 10.0f),     Vector2(2.000004f, 10.0f),
+            Vector2(2.000002f, 1.0f), Vector2(2.0f, 10.0f),
+            Vector2(1.0f, 10.0f)};
+
+        REQUIRE_FALSE(notched.isPointInside(Vector2(0.0f, 5.0f)));
+        REQUIRE(notched.isPointInside(Vector2(1.5f, 5.0f)));
+        REQUIRE(notched.isPointInside(Vector2(2.5f, 5.0f)));
+        REQUIRE(notched.intersectLine(Vector2(0.0f, 5.0f), Vector2(1.0f, 5.0f),
+                                      LineType::LINE, nullptr, 0) == 4);
+
+        // the ray through the bottom of the notch hits it once
+        REQUIRE(notched.intersectLine(Vector2(0.0f, 1.0f), Vector2(1.0f, 1.0f),
+                                      LineType::LINE, nullptr, 0) == 3);
+    }
+}
+TEST_CASE("Bounding volume hierarchy queries", "BoundingVolumeHierarchy") {
+    using namespace Calcda;
+    using Calcda::Polygon;
+
+    constexpr std::size_t ShapeCount = 200, QueryCount = 20;
+
+    CALCDA_DEFINE_RANDOM(x)
+
+    CALCDA_REQUIRE_RANDOM(x, 3 * ShapeCount + 4 * QueryCount)
+    std::vector<Polygon> shapes;
+    for (std::size_t i = 0; i < ShapeCount; ++i) {
+        const Vector2 origin(x[3 * i] * 5.0f, x[3 * i + 1] * 5.0f);
+        const float size = x[3 * i + 2] * 0.25f;
+
+        shapes.push_back(Polygon{origin, origin + Vector2(size, 0.0f),
+                                 origin + Vector2(size, size),
+                                 origin + Vector2(0.0f, size)});
+    }
+
+    std::vector<std::pair<Vector2, Vector2>> queries;
+    for (std::size_t i = 0; i < QueryCount; ++i) {
+        const float *q = &x[3 * ShapeCount + 4 * i];
+        queries.emplace_back(Vector2(q[0] * 5.0f, q[1] * 5.0f),
+                             Vector2(q[2] * 5.0f, q[3] * 5.0f));
+    }
+
+    const BoundingVolumeHierarchy hierarchy(shapes);
+    REQUIRE(hierarchy.size() == shapes.size());
+
+    // a hierarchy of a temporary vector would dangle
+    STATIC_REQUIRE(std::is_constructible_v<BoundingVolumeHierarchy,
+                                           const std::vector<Polygon> &>);
+    STATIC_REQUIRE_FALSE(std::is_constructible_v<BoundingVolumeHierarchy,
+                                                 std::vector<Polygon> &&>);
+    STATIC_REQUIRE_FALSE(std::is_convertible_v<const std::vector<Polygon> &,
+                                               BoundingVolumeHierarchy>);
+    STATIC_REQUIRE(std::is_constructible_v<BoundingVolumeHierarchy,
+                                           std::vector<const Shape *> &&>);
+
+    SECTION("point query matches a linear search") {
+        for (const auto &[a, b] : queries) {
+            std::vector<std::size_t> expected;
+            for (std::size_t i = 0; i < shapes.size(); ++i)
+                if (shapes[i].isPointInside(a))
+                    expected.push_back(i);
+
+            REQUIRE_THAT(hierarchy.queryPoint(a),
+                         Catch::Matchers::UnorderedEquals(expected));
+        }
+    }
+
+    SECTION("rectangle query matches a linear search") {
+        for (const auto &[a, b] : queries) {
+            const auto xymin = Vector2::vmin(a, b), xymax = Vector2::vmax(a, b);
+
+            std::vector<std::size_t> expected;
+            for (std::size_t i = 0; i < shapes.size(); ++i) {
+                const auto [smin, smax] = shapes[i].getBoundingRectangle();
+                if (smin.x <= xymax.x && xymin.x <= smax.x &&
+                    smin.y <= xymax.y && xymin.y <= smax.y)
+                    expected.push_back(i);
+            }
+
+            REQUIRE_THAT(hierarchy.queryRectangle(xymin, xymax),
+                         Catch::Matchers::UnorderedEquals(expected));
+        }
+    }
+
+    SECTION("line queries match a linear search") {
+        for (const auto &[a, b] : queries) {
+            for (const auto type : {LineType::SEGMENT, LineType::RAY}) {
+                std::vector<BoundingVolumeHierarchy::ShapeIntersection>
+                    expected;
+                std::optional<float> closest;
+
+                for (std::size_t i = 0; i < shapes.size(); ++i) {
+                    for (const auto &point :
+                         shapes[i].intersectLine(a, b, type)) {
+                        expected.push_back({i, point});
+
+                        const float distance = (point - a).lengthSquared();
+                        if (!closest || distance < *closest)
+                            closest = distance;
+                    }
+                }
+
+                REQUIRE_THAT(hierarchy.intersectLine(a, b, type),
+                             Catch::Matchers::UnorderedEquals(expected));
+
+                const auto result = hierarchy.intersectLineClosest(a, b, type);
+                REQUIRE(result.has_value() == closest.has_value());
+                if (result)
+                    REQUIRE((result->intersection - a).lengthSquared() ==
+                            Catch::Approx(*closest));
+            }
+        }
+    }
+}
+
+TEST_CASE("Prepared polygon containment", "PreparedPolygon") {
+    using namespace Calcda;
+
+    // even-odd rule, counting the edges right of the point
+    const auto reference = [](const std::vector<Vector2> &points,
+                              Vector2 point) {
+        bool inside = false;
+        Vector2 a = points.back();
+        for (const auto &b : points) {
+            if ((a.y <= point.y) != (b.y <= point.y) &&
+                a.x + (point.y - a.y) * (b.x - a.x) / (b.y - a.y) > point.x)
+                inside = !inside;
+            a = b;
+        }
+        return inside;
+    };
+
+    CALCDA_DEFINE_RANDOM(x)
+
+    CALCDA_REQUIRE_RANDOM(x, 64 + 2 * 500)
+    SECTION("star polygon") {
+        std::vector<Vector2> points;
+        for (std::size_t i = 0; i < 64; ++i) {
+            const float angle = static_cast<float>(i) * 6.2831853f / 64.0f;
+            points.emplace_back(10.0f + std::cos(angle) * x[i] * 0.5f,
+                                10.0f + std::sin(angle) * x[i] * 0.5f);
+        }
+
+        const PreparedPolygon polygon(points);
+
+        std::vector<Vector2> queries;
+        for (std::size_t i = 0; i < 500; ++i)
+            queries.emplace_back(x[64 + 2 * i], x[64 + 2 * i + 1]);
+
+        std::unique_ptr<bool[]> inside(new bool[queries.size()]);
+        polygon.containsPoints(queries.data(), inside.get(), queries.size());
+
+        for (std::size_t i = 0; i < queries.size(); ++i) {
+            REQUIRE(inside[i] == reference(points, queries[i]));
+            REQUIRE(polygon.isPointInside(queries[i]) == inside[i]);
+        }
+    }
+
+    CALCDA_REQUIRE_RANDOM(x, 2 * 500)
+    SECTION("self-intersecting polygon") {
+        const std::vector<Vector2> points = {
+            Vector2(10.0f, 19.0f), Vector2(15.0f, 2.0f), Vector2(1.0f, 13.0f),
+            Vector2(19.0f, 13.0f), Vector2(5.0f, 2.0f)};
+        const PreparedPolygon polygon(points);
+
+        for (std::size_t i = 0; i < 500; ++i) {
+            const Vector2 query(x[2 * i], x[2 * i + 1]);
+            REQUIRE(polygon.isPointInside(query) == reference(points, query));
+        }
+    }
+
+    SECTION("boundaries") {
+        const PreparedPolygon square = {
+            Vector2(0.0f, 0.0f), Vector2(0.0f, 1.0f), Vector2(1.0f, 1.0f),
+            Vector2(1.0f, 0.0f)};
+
+        REQUIRE(square.isPointInside(Vector2(0.5f, 0.5f)));
+        REQUIRE(square.isPointInside(Vector2(0.0f, 0.5f)));
+        REQUIRE(square.isPointInside(Vector2(0.5f, 0.0f)));
+        REQUIRE_FALSE(square.isPointInside(Vector2(1.0f, 0.5f)));
+        REQUIRE_FALSE(square.isPointInside(Vector2(0.5f, 1.0f)));
+        REQUIRE_FALSE(square.isPointInside(Vector2(1.5f, 0.5f)));
+    }
+}
+
+TEST_CASE("Polygon views", "PolygonView") {
+    using namespace Calcda;
+    using Calcda::Polygon;
+
+    CALCDA_DEFINE_RANDOM(x)
+
+    // two polygons of 16 points in one shared buffer
+    CALCDA_REQUIRE_RANDOM(x, 32 + 4 * 100)
+    std::vector<Vector2> buffer;
+    for (std::size_t i = 0; i < 32; ++i) {
+        const float angle = static_cast<float>(i % 16) * 6.2831853f / 16.0f,
+                    center = i < 16 ? 10.0f : 12.0f;
+        buffer.emplace_back(center + std::cos(angle) * x[i] * 0.5f,
+                            center + std::sin(angle) * x[i] * 0.5f);
+    }
+
+    const std::vector<Vector2> second(buffer.begin() + 16, buffer.end());
+    const Polygon polygon(second);
+
+    SECTION("queries match Polygon") {
+        const PolygonView view(buffer.data() + 16, 16);
+        REQUIRE(view.getPoints().data() == buffer.data() + 16);
+        REQUIRE(view.getPoints().toVector() == second);
+        REQUIRE(view.getBoundingRectangle() == polygon.getBoundingRectangle());
+
+        for (std::size_t i = 0; i < 100; ++i) {
+            const float *q = x.data() + 32 + 4 * i;
+            const Vector2 a(q[0], q[1]), b(q[2], q[3]);
+
+            REQUIRE(view.isPointInside(a) == polygon.isPointInside(a));
+            for (const auto type :
+                 {LineType::LINE, LineType::RAY, LineType::SEGMENT}) {
+                REQUIRE(view.intersectLine(a, b, type) ==
+                        polygon.intersectLine(a, b, type));
+                REQUIRE(view.intersectLineEx(a, b, type) ==
+                        polygon.intersectLineEx(a, b, type));
+            }
+        }
+    }
+
+    SECTION("coordinate pairs") {
+        std::vector<float> coordinates;
+        for (const auto &point : second) {
+            coordinates.push_back(point.x);
+            coordinates.push_back(point.y);
+        }
+
+        const PolygonView view(coordinates.data(), second.size());
+        REQUIRE(view.getPoints().toVector() == second);
+        REQUIRE(view.getBoundingRectangle() == polygon.getBoundingRectangle());
+
+        // views of a polygon share its points
+        const PolygonView polygonView(polygon);
+        REQUIRE(polygonView.getPoints().data() ==
+                polygon.getPoints().data());
+
+        // a view of a temporary polygon would dangle
+        STATIC_REQUIRE(std::is_constructible_v<PolygonView, const Polygon &>);
+        STATIC_REQUIRE_FALSE(std::is_constructible_v<PolygonView, Polygon &&>);
+        STATIC_REQUIRE_FALSE(
+            std::is_convertible_v<const Polygon &, PolygonView>);
+        REQUIRE(Polygon(view).getPoints().toVector() == second);
+    }
+
+    SECTION("moves keep the points") {
+        Polygon copy(polygon);
+        const Vector2 *points = copy.getPoints().data();
+
+        const Polygon moved(std::move(copy));
+        REQUIRE(moved.getPoints().data() == points);
+        REQUIRE(moved.getBoundingRectangle() ==
+                polygon.getBoundingRectangle());
+
+        const PreparedPolygon prepared{Polygon(buffer)};
+        REQUIRE(prepared.getPoints().size() == buffer.size());
+    }
+
+    SECTION("hierarchy over views") {
+        const std::vector<PolygonView> views = {
+            PolygonView(buffer.data(), 16),
+            PolygonView(buffer.data() + 16, 16)};
+        const BoundingVolumeHierarchy hierarchy(views);
+
+        const Vector2 center(12.0f, 12.0f);
+        const auto hits = hierarchy.queryPoint(center);
+        REQUIRE(std::count(hits.begin(), hits.end(), 1) == 1);
+        REQUIRE(std::count(hits.begin(), hits.end(), 0) ==
+                views[0].isPointInside(center));
+    }
+}
+
+TEST_CASE("Polygon metrics", "Polygon") {
+    using namespace Calcda;
+    using Calcda::Polygon;
+
+    SECTION("square and triangle") {
+        // clockwise, as the square of the other tests
+        const Polygon square{Vector2(0.0f, 0.0f), Vector2(0.0f, 2.0f),
+                             Vector2(2.0f, 2.0f), Vector2(2.0f, 0.0f)};
+        const PolygonMetrics metrics = square.getMetrics();
+        REQUIRE(metrics.signedArea == -4.0f);
+        REQUIRE(metrics.getArea() == 4.0f);
+        REQUIRE(metrics.perimeter == 8.0f);
+        REQUIRE(metrics.centroid == Vector2(1.0f, 1.0f));
+        REQUIRE(square.getWinding() == Winding::CLOCKWISE);
+
+        const std::vector<Vector2> triangle = {
+            Vector2(1.0f, 1.0f), Vector2(4.0f, 1.0f), Vector2(1.0f, 5.0f)};
+        const PolygonView view(triangle.data(), triangle.size());
+        REQUIRE(view.getArea() == 6.0f);
+        REQUIRE(view.getPerimeter() == 12.0f);
+        REQUIRE(view.getCentroid() == Vector2(2.0f, 7.0f / 3.0f));
+        REQUIRE(view.getWinding() == Winding::COUNTERCLOCKWISE);
+    }
+
+    SECTION("degenerate polygons") {
+        REQUIRE(computePolygonMetrics(PointSpan()).perimeter == 0.0f);
+        REQUIRE(computePolygonMetrics(PointSpan()).getWinding() ==
+                Winding::NONE);
+
+        const std::vector<Vector2> line = {
+            Vector2(0.0f, 0.0f), Vector2(2.0f, 0.0f), Vector2(4.0f, 0.0f)};
+        const PolygonMetrics metrics = computePolygonMetrics(line);
+        REQUIRE(metrics.getWinding() == Winding::NONE);
+        REQUIRE(metrics.perimeter == 8.0f);
+        REQUIRE(metrics.centroid == Vector2(2.0f, 0.0f));
+    }
+
+    CALCDA_DEFINE_RANDOM(x)
+
+    // stars of 37 points, odd so the SIMD blocks leave a tail
+    constexpr std::size_t PolygonCount = 100, PointCount = 37;
+    CALCDA_REQUIRE_RANDOM(x, PolygonCount * PointCount + 2 * PolygonCount)
+    std::vector<std::vector<Vector2>> polygons(PolygonCount);
+    for (std::size_t i = 0; i < PolygonCount; ++i) {
+        const float *radii = x.data() + i * PointCount,
+                    *center = x.data() + PolygonCount * PointCount + 2 * i;
+        for (std::size_t j = 0; j < PointCount; ++j) {
+            const float angle =
+                static_cast<float>(j) * 6.2831853f / PointCount;
+            polygons[i].emplace_back(center[0] + std::cos(angle) * radii[j],
+                                     center[1] + std::sin(angle) * radii[j]);
+        }
+    }
+
+    SECTION("fast summation matches compensated") {
+        for (const auto &polygon : polygons) {
+            const PolygonMetrics fast = computePolygonMetrics(polygon),
+                                 exact = computePolygonMetrics(
+                                     polygon, Summation::COMPENSATED);
+
+            REQUIRE(fast.getWinding() == Winding::COUNTERCLOCKWISE);
+            REQUIRE(fast.signedArea == Catch::Approx(exact.signedArea));
+            REQUIRE(fast.perimeter == Catch::Approx(exact.perimeter));
+            // centroids may land near 0, where relative errors are large
+            REQUIRE(fast.centroid.x ==
+                    Catch::Approx(exact.centroid.x).margin(1e-4));
+            REQUIRE(fast.centroid.y ==
+                    Catch::Approx(exact.centroid.y).margin(1e-4));
+
+            // reversing the points flips the sign only
+            const std::vector<Vector2> reversed(polygon.rbegin(),
+                                                polygon.rend());
+            const PolygonMetrics flipped =
+                computePolygonMetrics(reversed, Summation::COMPENSATED);
+            REQUIRE(flipped.getWinding() == Winding::CLOCKWISE);
+            REQUIRE(flipped.signedArea == Catch::Approx(-exact.signedArea));
+        }
+    }
+
+    SECTION("batch matches single polygons") {
+        const std::vector<PointSpan> spans(polygons.begin(), polygons.end());
+
+        for (const auto mode : {Summation::FAST, Summation::COMPENSATED}) {
+            for (const unsigned int threads : {1U, 3U, 0U}) {
+                std::vector<PolygonMetrics> out(PolygonCount);
+                computePolygonMetrics(spans.data(), spans.size(), out.data(),
+                                      mode, threads);
+
+                for (std::size_t i = 0; i < PolygonCount; ++i) {
+                    const PolygonMetrics single =
+                        computePolygonMetrics(spans[i], mode);
+                    REQUIRE(out[i].signedArea == single.signedArea);
+                    REQUIRE(out[i].centroid == single.centroid);
+                    REQUIRE(out[i].perimeter == single.perimeter);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Batch circle containment", "Circle") {
+    using namespace Calcda;
+
+    CALCDA_DEFINE_RANDOM(x)
+
+    // more points than a tile of the many circles test, and not a whole
+    // number of mask words
+    constexpr std::size_t pointCount = 2503;
+
+    CALCDA_REQUIRE_RANDOM(x, 2 * pointCount + 3 * 5)
+    SECTION("matches isPointInside") {
+        Vector2SoA points;
+        for (std::size_t i = 0; i < pointCount; ++i)
+            points.append(Vector2(x[2 * i], x[2 * i + 1]));
+
+        std::vector<Circle> circles;
+        for (std::size_t i = 0; i < 5; ++i) {
+            const float *values = x.data() + 2 * pointCount + 3 * i;
+            circles.emplace_back(Vector2(values[0], values[1]),
+                                 values[2] * 0.5f);
+        }
+        // a point on the circle is outside
+        points.set(7, Vector2(3.5f, 4.5f));
+        circles.emplace_back(Vector2(0.5f, 0.5f), 5.0f);
+
+        const std::size_t words = (pointCount + 31) / 32;
+        std::vector<std::uint32_t> masks(circles.size() * words, ~0U);
+        Circle::containsPoints(circles.data(), circles.size(), points,
+                               masks.data());
+
+        for (std::size_t c = 0; c < circles.size(); ++c) {
+            std::vector<std::uint32_t> single(words, ~0U);
+            circles[c].containsPoints(points, single.data());
+
+            std::vector<std::size_t> indices;
+            circles[c].containsPoints(points, indices);
+
+            std::vector<std::size_t> expected;
+            for (std::size_t i = 0; i < pointCount; ++i) {
+                const bool inside = (single[i / 32] >> (i % 32)) & 1U;
+                if (inside)
+                    expected.push_back(i);
+
+                // FMA contraction may round the SIMD and scalar paths
+                // differently, right at the circle
+                const Vector2 offset = points.get(i) - circles[c].getOrigin();
+                const float radius = circles[c].getRadius();
+                if (std::abs(offset.length() - radius) > 1e-4f * radius)
+                    REQUIRE(circles[c].isPointInside(points.get(i)) == inside);
+            }
+
+            REQUIRE(indices == expected);
+            REQUIRE(single.back() >> (pointCount % 32) == 0U);
+            REQUIRE(std::equal(single.begin(), single.end(),
+                               masks.begin() + c * words));
+        }
+
+        REQUIRE_FALSE(circles.back().isPointInside(points.get(7)));
+        REQUIRE_FALSE(masks[(circles.size() - 1) * words] & (1U << 7));
+    }
+}
+
+TEST_CASE("Circle line intersections", "Circle") {
+    using namespace Calcda;
+
+    SECTION("line types") {
+        const Circle circle(Vector2::Zero, 1.0f);
+        const Vector2 left(-2.0f, 0.0f), right(2.0f, 0.0f);
+
+        REQUIRE(circle.intersectLine(left, right) ==
+                std::vector<Vector2>{{-1.0f, 0.0f}, {1.0f, 0.0f}});
+        REQUIRE(circle.intersectLine(right, left, LineType::SEGMENT) ==
+                std::vector<Vector2>{{1.0f, 0.0f}, {-1.0f, 0.0f}});
+        REQUIRE(circle.intersectLine(Vector2::Zero, right, LineType::SEGMENT) ==
+                std::vector<Vector2>{{1.0f, 0.0f}});
+        REQUIRE(circle.intersectLine(Vector2::Zero, {0.5f, 0.0f},
+                                     LineType::RAY) ==
+                std::vector<Vector2>{{1.0f, 0.0f}});
+        REQUIRE(circle.intersectLine(Vector2::Zero, {0.5f, 0.0f},
+                                     LineType::SEGMENT)
+                    .empty());
+        REQUIRE(circle.intersectLine(right, {3.0f, 0.0f}, LineType::RAY)
+                    .empty());
+        REQUIRE(circle.intersectLine({-2.0f, 1.0f}, {2.0f, 1.0f}) ==
+                std::vector<Vector2>{{0.0f, 1.0f}});
+        REQUIRE(circle.intersectLine({-2.0f, 2.0f}, {2.0f, 2.0f}).empty());
+        REQUIRE(circle.intersectLine(Vector2::Zero, Vector2::Zero).empty());
+    }
+
+    CALCDA_DEFINE_RANDOM(x)
+
+    // not a whole number of SIMD blocks
+    constexpr std::size_t lineCount = 7, circleCount = 13;
+
+    CALCDA_REQUIRE_RANDOM(x, 4 * lineCount + 3 * circleCount)
+    SECTION("batch matches intersectLine") {
+        Vector2SoA origins, directions, centers;
+        for (std::size_t i = 0; i < lineCount; ++i) {
+            const float *values = x.data() + 4 * i;
+            origins.append(Vector2(values[0], values[1]));
+            directions.append(Vector2((values[2] - 10.5f) * 0.5f,
+                                      (values[3] - 10.5f) * 0.5f));
+        }
+
+        std::vector<float> radii;
+        for (std::size_t i = 0; i < circleCount; ++i) {
+            const float *values = x.data() + 4 * lineCount + 3 * i;
+            centers.append(Vector2(values[0], values[1]));
+            radii.push_back(values[2] * 0.5f);
+        }
+
+        const std::size_t size = lineCount * circleCount;
+        std::vector<float> lineEntries(size), lineExits(size);
+        Circle::intersectLines<LineType::LINE>(origins, directions, centers,
+                                               radii.data(),
+                                               lineEntries.data(),
+                                               lineExits.data());
+
+        for (const auto type :
+             {LineType::LINE, LineType::RAY, LineType::SEGMENT}) {
+            std::vector<float> entries(size), exits(size);
+            std::vector<Vector2> entryPoints(size), exitPoints(size);
+            Circle::intersectLines(origins, directions, type, centers,
+                                   radii.data(), entries.data(), exits.data(),
+                                   entryPoints.data(), exitPoints.data());
+
+            for (std::size_t i = 0; i < size; ++i) {
+                const std::size_t line = i / circleCount,
+                                  circle = i % circleCount;
+
+                // rounding decides tangents, and hits at the ends
+                const float entry = lineEntries[i], exit = lineExits[i];
+                const auto nearEnd = [](float t) {
+                    return std::abs(t) < 1e-4f || std::abs(t - 1.0f) < 1e-4f;
+                };
+                if (!std::isnan(entry) &&
+                    (exit - entry < 1e-3f || nearEnd(entry) || nearEnd(exit)))
+                    continue;
+
+                std::vector<Vector2> batch;
+                if (!std::isnan(entries[i])) {
+                    REQUIRE(entries[i] == entry);
+                    batch.push_back(entryPoints[i]);
+                }
+                if (!std::isnan(exits[i])) {
+                    REQUIRE(exits[i] == exit);
+                    batch.push_back(exitPoints[i]);
+                }
+
+                const Vector2 a = origins.get(line);
+                const auto expected =
+                    Circle(centers.get(circle), radii[circle])
+                        .intersectLine(a, a + directions.get(line), type);
+
+                REQUIRE(batch.size() == expected.size());
+                for (std::size_t k = 0; k < batch.size(); ++k) {
+                    REQUIRE(batch[k].x ==
+                            Catch::Approx(expected[k].x).margin(1e-3));
+                    REQUIRE(batch[k].y ==
+                            Catch::Approx(expected[k].y).margin(1e-3));
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Batch line intersections", "Line") {
+    using namespace Calcda;
+
+    constexpr std::size_t FirstCount = 20, SecondCount = 100;
+
+    CALCDA_DEFINE_RANDOM(x)
+
+    CALCDA_REQUIRE_RANDOM(x, 4 * (FirstCount + SecondCount))
+    std::vector<Vector2> first, second;
+    for (std::size_t i = 0; i < 2 * FirstCount; ++i)
+        first.emplace_back(x[2 * i], x[2 * i + 1]);
+    for (std::size_t i = 2 * FirstCount; i < 2 * (FirstCount + SecondCount);
+         ++i)
+        second.emplace_back(x[2 * i], x[2 * i + 1]);
+
+    // a parallel pair
+    second[0] = first[0] + Vector2(1.0f, 0.0f);
+    second[1] = first[1] + Vector2(1.0f, 0.0f);
+
+    SECTION("matches Line::intersectRaw for every line type") {
+        for (const auto firstType :
+             {LineType::LINE, LineType::RAY, LineType::SEGMENT}) {
+            for (const auto secondType :
+                 {LineType::LINE, LineType::RAY, LineType::SEGMENT}) {
+                std::vector<LineIntersection> hits;
+                Line::intersectBatch(first.data(), FirstCount, firstType,
+                                     second.data(), SecondCount, secondType,
+                                     hits);
+
+                std::size_t expected = 0;
+                for (std::size_t i = 0; i < FirstCount; ++i) {
+                    for (std::size_t j = 0; j < SecondCount; ++j) {
+                        const auto intersection = Line::intersectRaw(
+                            first[2 * i], first[2 * i + 1], firstType,
+                            second[2 * j], second[2 * j + 1], secondType);
+                        if (!intersection)
+                            continue;
+
+                        REQUIRE(expected < hits.size());
+                        const auto &hit = hits[expected++];
+                        REQUIRE(hit.first == i);
+                        REQUIRE(hit.second == j);
+                        REQUIRE(hit.intersection.x ==
+                                Catch::Approx(intersection->x));
+                        REQUIRE(hit.intersection.y ==
+                                Catch::Approx(intersection->y));
+                    }
+                }
+                REQUIRE(hits.size() == expected);
+            }
+        }
+    }
+}
+
+TEST_CASE("Sweep-line segment intersections", "Line") {
+    using namespace Calcda;
+
+    SECTION("matches testing every pair") {
+        constexpr std::size_t Count = 200;
+
+        CALCDA_DEFINE_RANDOM(x)
+
+        CALCDA_REQUIRE_RANDOM(x, 4 * Count)
+        std::vector<Line> segments;
+        for (std::size_t i = 0; i < Count; ++i)
+            segments.emplace_back(Vector2(x[4 * i], x[4 * i + 1]),
+                                  Vector2(x[4 * i + 2], x[4 * i + 3]),
+                                  LineType::SEGMENT);
+
+        const auto hits = intersectSegments(segments);
+
+        std::size_t expected = 0;
+        for (std::size_t i = 0; i < Count; ++i) {
+            for (std::size_t j = i + 1; j < Count; ++j) {
+                const auto intersection =
+                    segments[i].intersectLine(segments[j]);
+                if (intersection.empty())
+                    continue;
+
+                REQUIRE(expected < hits.size());
+                const auto &hit = hits[expected++];
+                REQUIRE(hit.first == i);
+                REQUIRE(hit.second == j);
+                REQUIRE(hit.intersection.x ==
+                        Catch::Approx(intersection[0].x));
+                REQUIRE(hit.intersection.y ==
+                        Catch::Approx(intersection[0].y));
+            }
+        }
+        REQUIRE(hits.size() == expected);
+    }
+
+    SECTION("shared endpoints, vertical and collinear segments") {
+        // a star and a polyline through its centre
+        const std::vector<Vector2> points = {
+            {0.0f, 0.0f},  {2.0f, 2.0f},   // 0
+            {0.0f, 0.0f},  {-2.0f, 2.0f},  // 1
+            {0.0f, 0.0f},  {0.0f, -2.0f},  // 2, vertical
+            {-3.0f, 0.0f}, {0.0f, 0.0f},   // 3
+            {0.0f, 0.0f},  {3.0f, 0.0f},   // 4
+            {1.0f, 0.0f},  {1.0f, 1.0f},   // 5, T-junction with 4
+            {2.0f, 0.0f},  {4.0f, 0.0f},   // 6, overlaps 4
+            {5.0f, 5.0f},  {6.0f, 6.0f},   // 7, alone
+        };
+
+        const auto hits = intersectSegments(points.data(), points.size() / 2);
+
+        std::vector<std::pair<std::size_t, std::size_t>> pairs;
+        for (const auto &hit : hits)
+            pairs.emplace_back(hit.first, hit.second);
+
+        REQUIRE(pairs == std::vector<std::pair<std::size_t, std::size_t>>{
+                             {0, 1}, {0, 2}, {0, 3}, {0, 4}, {0, 5}, {1, 2},
+                             {1, 3}, {1, 4}, {2, 3}, {2, 4}, {3, 4}, {4, 5},
+                             {4, 6}});
+
+        // the T-junction, and the start of the overlap
+        REQUIRE(hits[11].firstParameter == Catch::Approx(1.0f / 3.0f));
+        REQUIRE(hits[11].secondParameter == 0.0f);
+        REQUIRE(hits[12].intersection == Vector2(2.0f, 0.0f));
+        REQUIRE(hits[12].firstParameter == Catch::Approx(2.0f / 3.0f));
+        REQUIRE(hits[12].secondParameter == 0.0f);
+    }
+
+    SECTION("nearly collinear segments") {
+        // crossings a few ulps apart, which rounding used to misorder; the
+        // end of 2 passes 1e-10 above 0 without touching it
+        const std::vector<Vector2> points = {
+            {0.0133846076f, 0.10401538f},  {0.876569688f, 0.362970918f},
+            {0.375113904f, 0.212534174f},  {0.393329322f, 0.217998803f},
+            {0.869623959f, 0.3608872f},    {0.224354342f, 0.167306304f},
+        };
+
+        const auto hits = intersectSegments(points.data(), points.size() / 2);
+
+        std::vector<std::pair<std::size_t, std::size_t>> pairs;
+        for (const auto &hit : hits)
+            pairs.emplace_back(hit.first, hit.second);
+
+        REQUIRE(pairs == std::vector<std::pair<std::size_t, std::size_t>>{
+                             {0, 1}, {1, 2}});
+    }
+
+    SECTION("nearly collinear segments match an exact test of every pair") {
+        using Predicates::orient2d;
+
+        constexpr std::size_t Count = 100;
+
+        // the endpoints are rounded from one line
+        CALCDA_DEFINE_RANDOM(x)
+
+        CALCDA_REQUIRE_RANDOM(x, 2 * Count)
+        std::vector<Vector2> points;
+        for (const float value : x)
+            points.emplace_back(value, static_cast<float>(0.3 * value + 0.1));
+
+        const auto hits = intersectSegments(points.data(), Count);
+
+        std::vector<std::pair<std::size_t, std::size_t>> pairs;
+        for (const auto &hit : hits)
+            pairs.emplace_back(hit.first, hit.second);
+
+        const auto straddles = [](double a, double b) {
+            return (a <= 0.0 && b >= 0.0) || (a >= 0.0 && b <= 0.0);
+        };
+        const auto before = [](Vector2 a, Vector2 b) {
+            return a.x < b.x || (a.x == b.x && a.y < b.y);
+        };
+
+        std::vector<std::pair<std::size_t, std::size_t>> expected;
+        for (std::size_t i = 0; i < Count; ++i) {
+            for (std::size_t j = i + 1; j < Count; ++j) {
+                const auto a = points[2 * i], b = points[2 * i + 1],
+                           c = points[2 * j], d = points[2 * j + 1];
+                const double ca = orient2d(c, d, a), cb = orient2d(c, d, b),
+                             ac = orient2d(a, b, c), ad = orient2d(a, b, d);
+
+                bool intersects;
+                if (ca == 0.0 && cb == 0.0 && ac == 0.0 && ad == 0.0) {
+                    // collinear, so the overlap of the sorted endpoints
+                    const auto first = std::max(std::min(a, b, before),
+                                                std::min(c, d, before),
+                                                before),
+                               last = std::min(std::max(a, b, before),
+                                               std::max(c, d, before),
+                                               before);
+                    intersects = !before(last, first);
+                } else {
+                    intersects = straddles(ca, cb) && straddles(ac, ad);
+                }
+
+                if (intersects)
+                    expected.emplace_back(i, j);
+            }
+        }
+
+        REQUIRE(pairs == expected);
+    }
+}
@@ -0,0 +1,63 @@
+#include <catch2/catch_all.hpp>
+#include <cmath>
+
+#include "Vector2.hpp"
+#include "Vector3.hpp"
+#include "Vector4.hpp"
+
+#ifndef CALCDA_HEADER_ONLY_VECTORS
+#error "HeaderOnlyVectors.test.cpp needs CALCDA_HEADER_ONLY_VECTORS"
+#endif
+
+using Calcda::BasicVector2;
+using Calcda::Vector2;
+using Calcda::Vector3;
+using Calcda::Vector4;
+
+// the trivial operations are constant expressions
+static_assert(Vector2(1, 2) + Vector2(3, 4) == Vector2(4, 6));
+static_assert(Vector2(4, 6) - Vector2(3, 4) == Vector2(1, 2));
+static_assert(Vector2(1, 2) * Vector2::scalar(2) == Vector2(2, 4));
+static_assert(-Vector2(1, 2) == Vector2(-1, -2));
+static_assert(Vector2(1, 2).yx() == Vector2(2, 1));
+static_assert(Vector2(3, 4).lengthSquared() == 25.0f);
+static_assert(Vector2::dot(Vector2(1, 2), Vector2(3, 4)) == 11.0f);
+
+static_assert(Vector3(1, 2, 3) + Vector3(4, 5, 6) == Vector3(5, 7, 9));
+static_assert(Vector3::cross(Vector3(1, 0, 0), Vector3(0, 1, 0)) ==
+              Vector3(0, 0, 1));
+static_assert(Vector3::dot(Vector3(1, 2, 3), Vector3(4, 5, 6)) == 32.0f);
+static_assert(Vector3::lerp(Vector3(0, 0, 0), Vector3(2, 4, 6), 0.5f) ==
+              Vector3(1, 2, 3));
+static_assert(Vector3::clamp(Vector3(-1, 5, 2), Vector3(0, 0, 0),
+                             Vector3(3, 3, 3)) == Vector3(0, 3, 2));
+
+static_assert(Vector4(1, 2, 3, 4) / 2.0f == Vector4(0.5f, 1, 1.5f, 2));
+static_assert(Vector4::vmin(Vector4(1, 5, 2, 0), Vector4(3, 1, 2, -1)) ==
+              Vector4(1, 1, 2, -1));
+
+// compound assignments are constexpr too
+constexpr Vector2 accumulate() {
+    Vector2 result;
+    for (int i = 1; i <= 4; ++i)
+        result += Vector2::scalar(static_cast<float>(i));
+    return result;
+}
+static_assert(accumulate() == Vector2(10, 10));
+
+TEST_CASE("Header-only vectors", "Vector2") {
+    SECTION("element types other than float and double") {
+        constexpr BasicVector2<int> a(1, 2), b(3, 4);
+        STATIC_REQUIRE(a + b == BasicVector2<int>(4, 6));
+        REQUIRE((a * b).toString() == BasicVector2<int>(3, 8).toString());
+    }
+
+    SECTION("the operations give the same results at run time") {
+        Vector2 value(1, 2);
+        value *= Vector2::scalar(3);
+        value -= Vector2(1, 1);
+        REQUIRE(value == Vector2(2, 5));
+        REQUIRE(Vector3(value, 1.0f).length() ==
+                Catch::Approx(std::sqrt(30.0f)));
+    }
+}
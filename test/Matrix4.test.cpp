@@ -0,0 +1,291 @@
+#include <catch2/catch_all.hpp>
+
+#include "Matrix4.hpp"
+#include "random.hpp"
+
+#include <cmath>
+
+using Calcda::Matrix4;
+
+TEST_CASE("Matrix4 operations", "Matrix4") {
+    CALCDA_DEFINE_RANDOM(x)
+
+    CALCDA_REQUIRE_RANDOM(x, 32)
+    SECTION("multiplication matches the scalar product") {
+        Matrix4 left, right, expected;
+        for (std::size_t i = 0; i < 16; ++i) {
+            left.value.data[i] = x[i];
+            right.value.data[i] = x[16 + i];
+        }
+
+        for (unsigned int i = 0U; i < 4U; i++)
+            for (unsigned int j = 0U; j < 4U; j++)
+                for (unsigned int k = 0U; k < 4U; k++)
+                    expected.value.matrix[i][j] +=
+                        left.value.matrix[i][k] * right.value.matrix[k][j];
+
+        const auto result = left * right;
+        for (std::size_t i = 0; i < 16; ++i)
+#ifdef CALCDA_STRICT_MATH
+            REQUIRE(result.value.data[i] == expected.value.data[i]);
+#else
+            REQUIRE(result.value.data[i] ==
+                    Catch::Approx(expected.value.data[i]));
+#endif
+    }
+
+    CALCDA_REQUIRE_RANDOM(x, 32)
+    SECTION("self multiplication") {
+        Matrix4 left, right;
+        for (std::size_t i = 0; i < 16; ++i) {
+            left.value.data[i] = x[i];
+            right.value.data[i] = x[16 + i];
+        }
+
+        auto product = left;
+        product *= right;
+
+        REQUIRE(product == left * right);
+    }
+
+    CALCDA_REQUIRE_RANDOM(x, 16)
+    SECTION("identity") {
+        Matrix4 mat;
+        for (std::size_t i = 0; i < 16; ++i)
+            mat.value.data[i] = x[i];
+
+        REQUIRE(mat * Matrix4::Identity == mat);
+        REQUIRE(Matrix4::Identity * mat == mat);
+    }
+}
+
+TEST_CASE("Matrix4 batch transforms", "Matrix4") {
+    using Calcda::Vector3;
+    using Calcda::Vector4;
+
+    CALCDA_DEFINE_RANDOM(x)
+
+    CALCDA_REQUIRE_RANDOM(x, 16 + 4 * 7)
+    SECTION("transformBatch matches multiply") {
+        Matrix4 mat;
+        for (std::size_t i = 0; i < 16; ++i)
+            mat.value.data[i] = x[i];
+
+        std::vector<Vector4> vectors;
+        for (std::size_t i = 0; i < 7; ++i)
+            vectors.emplace_back(x[16 + i * 4], x[17 + i * 4], x[18 + i * 4],
+                                 x[19 + i * 4]);
+
+        std::vector<Vector4> results(vectors.size());
+        mat.transformBatch(vectors.data(), results.data(), vectors.size());
+
+        for (std::size_t i = 0; i < vectors.size(); ++i) {
+            const auto expected = mat * vectors[i];
+            REQUIRE(results[i].x == Catch::Approx(expected.x));
+            REQUIRE(results[i].y == Catch::Approx(expected.y));
+            REQUIRE(results[i].z == Catch::Approx(expected.z));
+            REQUIRE(results[i].w == Catch::Approx(expected.w));
+        }
+    }
+
+    CALCDA_REQUIRE_RANDOM(x, 3 * 5)
+    SECTION("strided points and directions") {
+        struct Vertex {
+            Vector3 position;
+            Vector3 normal;
+            float uv[2];
+        };
+
+        const auto mat = Matrix4::translation(1.0f, 2.0f, 3.0f) *
+                         Matrix4::scale(2.0f, 2.0f, 2.0f);
+
+        std::vector<Vertex> vertices;
+        for (std::size_t i = 0; i < 5; ++i) {
+            const Vector3 v = {x[i * 3], x[i * 3 + 1], x[i * 3 + 2]};
+            vertices.push_back({v, v, {0.0f, 0.0f}});
+        }
+
+        mat.transformPoints(&vertices[0].position, &vertices[0].position,
+                            vertices.size(), sizeof(Vertex), sizeof(Vertex));
+        mat.transformDirections(&vertices[0].normal, &vertices[0].normal,
+                                vertices.size(), sizeof(Vertex),
+                                sizeof(Vertex));
+
+        for (std::size_t i = 0; i < vertices.size(); ++i) {
+            const Vector3 v = {x[i * 3], x[i * 3 + 1], x[i * 3 + 2]};
+
+            REQUIRE(vertices[i].position.x == Catch::Approx(v.x * 2.0f + 1.0f));
+            REQUIRE(vertices[i].position.y == Catch::Approx(v.y * 2.0f + 2.0f));
+            REQUIRE(vertices[i].position.z == Catch::Approx(v.z * 2.0f + 3.0f));
+            REQUIRE(vertices[i].normal.x == Catch::Approx(v.x * 2.0f));
+            REQUIRE(vertices[i].normal.y == Catch::Approx(v.y * 2.0f));
+            REQUIRE(vertices[i].normal.z == Catch::Approx(v.z * 2.0f));
+        }
+    }
+}
+
+TEST_CASE("Matrix4 inverses", "Matrix4") {
+    using Calcda::Axis;
+    using Calcda::Vector3;
+
+    const auto requireIdentity = [](const Matrix4 &mat) {
+        for (std::size_t i = 0; i < 16; ++i)
+            REQUIRE(mat.value.data[i] ==
+                    Catch::Approx(Matrix4::Identity.value.data[i])
+                        .margin(1e-5));
+    };
+
+    CALCDA_DEFINE_RANDOM(x)
+
+    CALCDA_REQUIRE_RANDOM(x, 16)
+    SECTION("general inverse") {
+        // diagonally dominant, so well-conditioned
+        Matrix4 mat;
+        for (std::size_t i = 0; i < 16; ++i)
+            mat.value.data[i] = x[i] + (i % 5 == 0 ? 80.0f : 0.0f);
+
+        const auto expected = mat.inverse();
+        const auto result = mat.inverseUnchecked();
+        for (std::size_t i = 0; i < 16; ++i)
+            REQUIRE(result.value.data[i] ==
+                    Catch::Approx(expected.value.data[i]).margin(1e-6));
+
+        requireIdentity(mat * result);
+
+        const auto checked = mat.inverseChecked();
+        REQUIRE(checked.has_value());
+        REQUIRE(*checked == result);
+    }
+
+    CALCDA_REQUIRE_RANDOM(x, 12)
+    SECTION("singular matrix") {
+        // the last row is zero
+        Matrix4 mat;
+        for (std::size_t i = 0; i < 12; ++i)
+            mat.value.data[i] = x[i];
+
+        REQUIRE_FALSE(mat.inverseChecked().has_value());
+        REQUIRE(mat.inverse() == Matrix4::Identity);
+    }
+
+    CALCDA_REQUIRE_RANDOM(x, 6)
+    SECTION("affine and rigid transforms") {
+        const auto rigid =
+            Matrix4::translation(Vector3(x[0], x[1], x[2]) / 10.0f) *
+            Matrix4::rotation(Axis::X, x[3]) *
+            Matrix4::rotation(Axis::Z, x[4]);
+        const auto affine = rigid * Matrix4::scale(x[5] / 10.0f, 0.5f, 2.0f);
+
+        requireIdentity(rigid * rigid.inverse());
+        requireIdentity(rigid * rigid.inverseRigid());
+        requireIdentity(rigid * rigid.inverseAffine());
+        requireIdentity(affine * affine.inverse());
+        requireIdentity(affine * affine.inverseAffine());
+        requireIdentity(affine * affine.inverseUnchecked());
+    }
+
+    SECTION("affine transforms with a large translation") {
+        // the translation must not leak into the determinant
+        const auto rigid =
+            Matrix4::translation(Vector3(12345.678f, 23456.789f, 34567.891f)) *
+            Matrix4::rotation(Axis::Z, 0.3f);
+        const auto affine = rigid * Matrix4::scale(1.5f, 1.5f, 1.5f);
+
+        const auto rigidInverse = rigid.inverse();
+        const auto affineInverse = affine.inverse();
+        const auto fastRigidInverse = rigid.inverseRigid();
+        const auto fastAffineInverse = affine.inverseAffine();
+        for (std::size_t i = 0; i < 16; ++i) {
+            REQUIRE(fastRigidInverse.value.data[i] ==
+                    Catch::Approx(rigidInverse.value.data[i]).margin(1e-2));
+            REQUIRE(fastAffineInverse.value.data[i] ==
+                    Catch::Approx(affineInverse.value.data[i]).margin(1e-2));
+        }
+    }
+}
+
+TEST_CASE("Matrix4d operations", "Matrix4") {
+    using Calcda::Matrix4d;
+    using Calcda::Vector3d;
+    using Calcda::Vector4d;
+
+    CALCDA_DEFINE_RANDOM(x)
+
+    CALCDA_REQUIRE_RANDOM(x, 32 + 4 * 7)
+    SECTION("products and transforms match the scalar ones") {
+        Matrix4d left, right, expected;
+        for (std::size_t i = 0; i < 16; ++i) {
+            left.value.data[i] = x[i];
+            right.value.data[i] = x[16 + i];
+        }
+
+        for (unsigned int i = 0U; i < 4U; i++)
+            for (unsigned int j = 0U; j < 4U; j++)
+                for (unsigned int k = 0U; k < 4U; k++)
+                    expected.value.matrix[i][j] +=
+                        left.value.matrix[i][k] * right.value.matrix[k][j];
+
+        const auto result = left * right;
+        for (std::size_t i = 0; i < 16; ++i)
+            REQUIRE(result.value.data[i] ==
+                    Catch::Approx(expected.value.data[i]).epsilon(1e-12));
+
+        std::vector<Vector4d> vectors;
+        for (std::size_t i = 0; i < 7; ++i)
+            vectors.emplace_back(x[32 + i * 4], x[33 + i * 4], x[34 + i * 4],
+                                 x[35 + i * 4]);
+
+        std::vector<Vector4d> results(vectors.size());
+        left.transformBatch(vectors.data(), results.data(), vectors.size());
+
+        std::vector<Vector3d> points(vectors.size());
+        for (std::size_t i = 0; i < vectors.size(); ++i)
+            points[i] = Vector3d(vectors[i].x, vectors[i].y, vectors[i].z);
+        left.transformPoints(points.data(), points.data(), points.size());
+
+        for (std::size_t i = 0; i < vectors.size(); ++i) {
+            const auto expectedVector = left * vectors[i];
+            const auto expectedPoint =
+                left * Vector4d(vectors[i].x, vectors[i].y, vectors[i].z, 1.0);
+            REQUIRE(results[i].x == Catch::Approx(expectedVector.x));
+            REQUIRE(results[i].y == Catch::Approx(expectedVector.y));
+            REQUIRE(results[i].z == Catch::Approx(expectedVector.z));
+            REQUIRE(results[i].w == Catch::Approx(expectedVector.w));
+            REQUIRE(points[i].x == Catch::Approx(expectedPoint.x));
+            REQUIRE(points[i].y == Catch::Approx(expectedPoint.y));
+            REQUIRE(points[i].z == Catch::Approx(expectedPoint.z));
+        }
+    }
+
+    CALCDA_REQUIRE_RANDOM(x, 16)
+    SECTION("inverses") {
+        Matrix4d mat;
+        for (std::size_t i = 0; i < 16; ++i)
+            mat.value.data[i] = x[i] + (i % 5 == 0 ? 80.0 : 0.0);
+
+        const auto product = mat * mat.inverseUnchecked();
+        for (std::size_t i = 0; i < 16; ++i)
+            REQUIRE(product.value.data[i] ==
+                    Catch::Approx(Matrix4d::Identity.value.data[i])
+                        .margin(1e-12));
+    }
+
+    CALCDA_REQUIRE_RANDOM(x, 3)
+    SECTION("large coordinates") {
+        // in metres, a camera 10^4 km from the origin and a point a few
+        // centimetres from it
+        const Vector3d offset(std::floor(x[0]) / 64.0, std::floor(x[1]) / 64.0,
+                              std::floor(x[2]) / 64.0);
+        const Vector3d eye(1e7, 2e7, -1e7);
+        const auto view = Matrix4d::translation(-eye);
+
+        Vector3d point = eye + offset;
+        view.transformPoints(&point, &point, 1);
+        REQUIRE(point == offset);
+
+        // floats keep 24 bits, about a metre at this distance
+        Calcda::Vector3 pointf = Calcda::Vector3(eye + offset);
+        Matrix4(view).transformPoints(&pointf, &pointf, 1);
+        REQUIRE(Vector3d(pointf) != offset);
+    }
+}
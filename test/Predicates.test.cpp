@@ -0,0 +1,124 @@
+#include <catch2/catch_all.hpp>
+
+#include "Geometry.hpp"
+#include "Predicates.hpp"
+#include "random.hpp"
+
+#include <cmath>
+#include <cstdint>
+
+using Calcda::Line;
+using Calcda::LineType;
+using Calcda::Vector2;
+
+namespace Predicates = Calcda::Predicates;
+
+namespace {
+// the sign of the orientation of points on an integer grid, exactly
+int orientationSign(std::int64_t ax, std::int64_t ay, std::int64_t bx,
+                    std::int64_t by, std::int64_t cx, std::int64_t cy) {
+    const std::int64_t result = (bx - ax) * (cy - ay) - (by - ay) * (cx - ax);
+    return (result > 0) - (result < 0);
+}
+
+int sign(double value) { return (value > 0.0) - (value < 0.0); }
+} // namespace
+
+TEST_CASE("Exact predicates", "Predicates") {
+    SECTION("orientation") {
+        REQUIRE(Predicates::orient2d({0.0f, 0.0f}, {1.0f, 0.0f},
+                                     {0.0f, 1.0f}) == Catch::Approx(1.0));
+        REQUIRE(Predicates::orient2d({0.0f, 0.0f}, {0.0f, 1.0f},
+                                     {1.0f, 0.0f}) < 0.0);
+        REQUIRE(Predicates::orient2d({0.0f, 0.0f}, {1.0f, 1.0f},
+                                     {0.1f, 0.1f}) == 0.0);
+
+        // 1e30 + 1e-30 rounds to 1e30 in double precision, so the plain
+        // evaluation cancels to zero
+        const Vector2 a(-1e30f, -1e30f), b(1e30f, 1e30f);
+        REQUIRE(Predicates::orient2d(a, b, {1e-30f, 2e-30f}) > 0.0);
+        REQUIRE(Predicates::orient2d(a, b, {2e-30f, 1e-30f}) < 0.0);
+        REQUIRE(Predicates::orient2d(a, b, {1e-30f, 1e-30f}) == 0.0);
+        REQUIRE(Predicates::cross2d(a, b, {1e-30f, 1e-30f},
+                                    {3e-30f, 2e-30f}) < 0.0);
+    }
+
+    CALCDA_DEFINE_RANDOM(x)
+
+    CALCDA_REQUIRE_RANDOM(x, 6 * 100)
+    SECTION("nearly collinear points on a fine grid") {
+        // steps of 2^-20, with the third point moved at most a step off the
+        // line through the first two
+        const float step = std::ldexp(1.0f, -20);
+        for (std::size_t i = 0; i < 100; ++i) {
+            const float *values = x.data() + 6 * i;
+            const std::int64_t ax = static_cast<std::int64_t>(values[0]),
+                               ay = static_cast<std::int64_t>(values[1]),
+                               bx = ax + 16 * static_cast<std::int64_t>(
+                                                  values[2]),
+                               by = ay + 16 * static_cast<std::int64_t>(
+                                                  values[3]);
+            const std::int64_t k = static_cast<std::int64_t>(values[4]);
+            const std::int64_t cx = ax + (bx - ax) * k / 16,
+                               cy = ay + (by - ay) * k / 16 +
+                                    static_cast<std::int64_t>(values[5]) % 3 -
+                                    1;
+
+            const auto grid = [step](std::int64_t x, std::int64_t y) {
+                return Vector2(static_cast<float>(x) * step,
+                               static_cast<float>(y) * step);
+            };
+
+            REQUIRE(sign(Predicates::orient2d(grid(ax, ay), grid(bx, by),
+                                              grid(cx, cy))) ==
+                    orientationSign(ax, ay, bx, by, cx, cy));
+            REQUIRE(sign(Predicates::cross2d(grid(ax, ay), grid(bx, by),
+                                             grid(ax, ay), grid(cx, cy))) ==
+                    orientationSign(ax, ay, bx, by, cx, cy));
+        }
+    }
+
+    SECTION("incircle") {
+        const Vector2 a(1.0f, 0.0f), b(0.0f, 1.0f), c(-1.0f, 0.0f);
+        REQUIRE(Predicates::incircle(a, b, c, Vector2::Zero) > 0.0);
+        REQUIRE(Predicates::incircle(a, b, c, {0.0f, -1.0f}) == 0.0);
+        REQUIRE(Predicates::incircle(a, b, c, {2.0f, 2.0f}) < 0.0);
+        REQUIRE(Predicates::incircle(c, b, a, Vector2::Zero) < 0.0);
+
+        // a circle of radius 2^20, and points a step of its ulp inside and
+        // outside
+        const float radius = 1048576.0f;
+        const Vector2 a1(radius, 0.0f), b1(0.0f, radius), c1(-radius, 0.0f);
+        REQUIRE(Predicates::incircle(a1, b1, c1, {0.0f, -radius}) == 0.0);
+        REQUIRE(Predicates::incircle(
+                    a1, b1, c1, {0.0f, -std::nextafter(radius, 0.0f)}) > 0.0);
+        REQUIRE(Predicates::incircle(
+                    a1, b1, c1, {0.0f, -std::nextafter(radius, 2 * radius)}) <
+                0.0);
+        REQUIRE(Predicates::incircle(a1, b1, c1,
+                                     {0.5f, -std::nextafter(radius, 0.0f)}) >
+                0.0);
+    }
+
+#if defined(CALCDA_ROBUST_PREDICATES)
+    SECTION("robust line tests") {
+        // with floats, the slope 7 / 3 puts some of these points off the line
+        const Vector2 begin(0.0f, 0.0f), end(3.0f, 7.0f);
+        const Line line(begin, end, LineType::SEGMENT);
+
+        for (int k = 1; k < 64; ++k) {
+            const Vector2 point(3.0f * k / 64.0f, 7.0f * k / 64.0f),
+                above(point.x, std::nextafter(point.y, 8.0f));
+            REQUIRE(line.isPointInside(point));
+            REQUIRE_FALSE(line.isPointInside(above));
+
+            // a segment starting on the line, or a step above it
+            REQUIRE(Line::intersectRaw(begin, end, LineType::SEGMENT, point,
+                                       {point.x, 10.0f}, LineType::SEGMENT));
+            REQUIRE_FALSE(Line::intersectRaw(begin, end, LineType::SEGMENT,
+                                             above, {point.x, 10.0f},
+                                             LineType::SEGMENT));
+        }
+    }
+#endif
+}
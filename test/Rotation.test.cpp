@@ -0,0 +1,197 @@
+#include <catch2/catch_all.hpp>
+
+#include "Matrix3.hpp"
+#include "Matrix4.hpp"
+#include "Rotation.hpp"
+#include "random.hpp"
+
+#include <cmath>
+#include <utility>
+#include <vector>
+
+using Calcda::Quaternion;
+using Calcda::Vector3;
+
+namespace {
+void requireNear(Vector3 result, Vector3 expected) {
+    REQUIRE(result.x == Catch::Approx(expected.x).margin(1e-4));
+    REQUIRE(result.y == Catch::Approx(expected.y).margin(1e-4));
+    REQUIRE(result.z == Catch::Approx(expected.z).margin(1e-4));
+}
+
+// q and -q are the same rotation
+void requireSameRotation(const Quaternion &result, const Quaternion &expected) {
+    const float sign = Quaternion::dot(result, expected) < 0.0f ? -1.0f : 1.0f;
+    REQUIRE(sign * result.x == Catch::Approx(expected.x).margin(1e-5));
+    REQUIRE(sign * result.y == Catch::Approx(expected.y).margin(1e-5));
+    REQUIRE(sign * result.z == Catch::Approx(expected.z).margin(1e-5));
+    REQUIRE(sign * result.w == Catch::Approx(expected.w).margin(1e-5));
+}
+
+Vector3 rotateByMatrix(const Calcda::Matrix4 &Rotation, Vector3 Point) {
+    Vector3 result;
+    Rotation.transformDirections(&Point, &result, 1);
+    return result;
+}
+
+Quaternion randomRotation(const std::vector<float> &x, std::size_t i) {
+    return Quaternion::fromAxisAngle(Vector3(x[i] - 10.0f, x[i + 1] - 10.0f,
+                                             x[i + 2] - 10.0f),
+                                     x[i + 3]);
+}
+} // namespace
+
+TEST_CASE("Quaternion rotations", "Rotation") {
+    CALCDA_DEFINE_RANDOM(x)
+
+    CALCDA_REQUIRE_RANDOM(x, 11)
+    SECTION("rotate matches the matrix") {
+        const auto rotation = randomRotation(x, 0);
+        const Vector3 point(x[4], x[5], x[6]);
+
+        REQUIRE(rotation.length() == Catch::Approx(1.0f));
+        requireNear(rotation.rotate(point),
+                    rotation.toMatrix3().multiply(point));
+        requireNear(rotation * point,
+                    rotateByMatrix(rotation.toMatrix4(), point));
+
+        requireNear(Quaternion::fromAxisAngle(Vector3::UnitZ, CALCDA_PIf / 2)
+                        .rotate(Vector3::UnitX),
+                    Vector3::UnitY);
+    }
+
+    CALCDA_REQUIRE_RANDOM(x, 11)
+    SECTION("composition matches the matrix product") {
+        const auto first = randomRotation(x, 0), second = randomRotation(x, 4);
+        const Vector3 point(x[8], x[9], x[10]);
+
+        requireNear((second * first).rotate(point),
+                    second.rotate(first.rotate(point)));
+        requireNear((second * first).rotate(point),
+                    (second.toMatrix3() * first.toMatrix3()).multiply(point));
+
+        auto product = second;
+        product *= first;
+        REQUIRE(product == second.multiply(first));
+
+        requireSameRotation(first * first.inverse(), Quaternion::Identity);
+        requireSameRotation(first * first.conjugate(), Quaternion::Identity);
+    }
+
+    CALCDA_REQUIRE_RANDOM(x, 4)
+    SECTION("matrix round trips") {
+        const auto rotation = randomRotation(x, 0);
+
+        requireSameRotation(Quaternion::fromMatrix(rotation.toMatrix3()),
+                            rotation);
+        requireSameRotation(Quaternion::fromMatrix(rotation.toMatrix4()),
+                            rotation);
+
+        // each branch of the conversion
+        for (const auto &axis :
+             {Vector3::UnitX, Vector3::UnitY, Vector3::UnitZ})
+            requireSameRotation(
+                Quaternion::fromMatrix(
+                    Quaternion::fromAxisAngle(axis, 3.0f).toMatrix3()),
+                Quaternion::fromAxisAngle(axis, 3.0f));
+
+        const auto matrix = Calcda::Matrix4::rotation(Calcda::Axis::Y, x[0]);
+        const Vector3 point(x[1], x[2], x[3]);
+        requireNear(Quaternion::fromMatrix(matrix).rotate(point),
+                    rotateByMatrix(matrix, point));
+    }
+
+    CALCDA_REQUIRE_RANDOM(x, 1)
+    SECTION("the axis rotations of the matrices turn the other way") {
+        using Calcda::Axis;
+
+        const std::pair<Axis, Vector3> axes[] = {{Axis::X, Vector3::UnitX},
+                                                 {Axis::Y, Vector3::UnitY},
+                                                 {Axis::Z, Vector3::UnitZ}};
+        for (const auto &[axis, vector] : axes) {
+            const auto rotation = Quaternion::fromAxisAngle(vector, x[0]);
+
+            const auto matrix3 = rotation.toMatrix3(),
+                       expected3 = Calcda::Matrix3::rotation(axis, -x[0]);
+            for (std::size_t i = 0; i < 9; ++i)
+                REQUIRE(matrix3.value.data[i] ==
+                        Catch::Approx(expected3.value.data[i]).margin(1e-5));
+
+            const auto matrix4 = rotation.toMatrix4(),
+                       expected4 = Calcda::Matrix4::rotation(axis, -x[0]);
+            for (std::size_t i = 0; i < 16; ++i)
+                REQUIRE(matrix4.value.data[i] ==
+                        Catch::Approx(expected4.value.data[i]).margin(1e-5));
+        }
+    }
+
+    CALCDA_REQUIRE_RANDOM(x, 3)
+    SECTION("axis and angle") {
+        const auto axis = Vector3(x[0], x[1], x[2]).normalize();
+        const auto [resultAxis, angle] =
+            Quaternion::fromAxisAngle(axis, 1.25f).toAxisAngle();
+
+        requireNear(resultAxis, axis);
+        REQUIRE(angle == Catch::Approx(1.25f));
+
+        const auto [identityAxis, identityAngle] =
+            Quaternion::Identity.toAxisAngle();
+        REQUIRE(identityAxis == Vector3::UnitX);
+        REQUIRE(identityAngle == 0.0f);
+    }
+}
+
+TEST_CASE("Quaternion interpolation", "Rotation") {
+    CALCDA_DEFINE_RANDOM(x)
+
+    CALCDA_REQUIRE_RANDOM(x, 8)
+    SECTION("slerp endpoints and midpoint") {
+        const auto from = randomRotation(x, 0), to = randomRotation(x, 4);
+
+        requireSameRotation(Quaternion::slerp(from, to, 0.0f), from);
+        requireSameRotation(Quaternion::slerp(from, to, 1.0f), to);
+        requireSameRotation(Quaternion::nlerp(from, to, 0.0f), from);
+        requireSameRotation(Quaternion::nlerp(from, to, 1.0f), to);
+
+        // the midpoint is halfway along the shorter arc
+        const auto middle = Quaternion::slerp(from, to, 0.5f);
+        REQUIRE(middle.length() == Catch::Approx(1.0f));
+        REQUIRE(std::abs(Quaternion::dot(from, middle)) ==
+                Catch::Approx(std::abs(Quaternion::dot(middle, to))));
+        requireSameRotation(Quaternion::nlerp(from, to, 0.5f), middle);
+
+        const auto rotation = Quaternion::fromAxisAngle(Vector3::UnitY, 2.0f);
+        requireSameRotation(
+            Quaternion::slerp(Quaternion::Identity, rotation, 0.25f),
+            Quaternion::fromAxisAngle(Vector3::UnitY, 0.5f));
+        requireSameRotation(
+            Quaternion::slerp(Quaternion::Identity, -rotation, 0.25f),
+            Quaternion::fromAxisAngle(Vector3::UnitY, 0.5f));
+    }
+
+    CALCDA_REQUIRE_RANDOM(x, 64 * 9)
+    SECTION("slerpBatch matches slerp") {
+        std::vector<Quaternion> from, to, out(64);
+        std::vector<float> amount;
+        for (std::size_t i = 0; i < 64; ++i) {
+            from.push_back(randomRotation(x, 9 * i));
+            to.push_back(randomRotation(x, 9 * i + 4));
+            amount.push_back(x[9 * i + 8] / 20.0f);
+        }
+        // nearly equal rotations, and opposite signs
+        to[0] = from[0];
+        to[1] = -from[1];
+        to[2] = from[2] * Quaternion::fromAxisAngle(Vector3::UnitX, 1e-3f);
+
+        Quaternion::slerpBatch(from.data(), to.data(), amount.data(),
+                               out.data(), out.size());
+
+        for (std::size_t i = 0; i < out.size(); ++i) {
+            const auto expected = Quaternion::slerp(from[i], to[i], amount[i]);
+            REQUIRE(out[i].x == Catch::Approx(expected.x).margin(1e-5));
+            REQUIRE(out[i].y == Catch::Approx(expected.y).margin(1e-5));
+            REQUIRE(out[i].z == Catch::Approx(expected.z).margin(1e-5));
+            REQUIRE(out[i].w == Catch::Approx(expected.w).margin(1e-5));
+        }
+    }
+}
@@ -0,0 +1,222 @@
+#include <catch2/catch_all.hpp>
+
+#include "Transform.hpp"
+#include "TransformHierarchy.hpp"
+#include "random.hpp"
+
+using Calcda::CachedTransform;
+using Calcda::Matrix4;
+using Calcda::Quaternion;
+using Calcda::Transform;
+using Calcda::TransformHierarchy;
+using Calcda::Vector3;
+
+namespace {
+void requireNear(Vector3 result, Vector3 expected) {
+    REQUIRE(result.x == Catch::Approx(expected.x).margin(1e-3));
+    REQUIRE(result.y == Catch::Approx(expected.y).margin(1e-3));
+    REQUIRE(result.z == Catch::Approx(expected.z).margin(1e-3));
+}
+
+Vector3 transformByMatrix(const Matrix4 &Matrix, Vector3 Point) {
+    Vector3 result;
+    Matrix.transformPoints(&Point, &result, 1);
+    return result;
+}
+
+Transform randomTransform(const std::vector<float> &x, std::size_t i,
+                          Vector3 Scale) {
+    return Transform(
+        Vector3(x[i], x[i + 1], x[i + 2]),
+        Quaternion::fromAxisAngle(
+            Vector3(x[i + 3] - 10.0f, x[i + 4] - 10.0f, x[i + 5]), x[i + 6]),
+        Scale);
+}
+} // namespace
+
+TEST_CASE("Transform operations", "Transform") {
+    CALCDA_DEFINE_RANDOM(x)
+
+    CALCDA_REQUIRE_RANDOM(x, 10)
+    SECTION("matches the product of the matrices") {
+        const Vector3 scale(x[7] / 10.0f, 0.5f, 2.0f);
+        const auto transform = randomTransform(x, 0, scale);
+        const auto expected = Matrix4::translation(transform.getTranslation()) *
+                              transform.getRotation().toMatrix4() *
+                              Matrix4::scale(scale);
+
+        const auto matrix = transform.toMatrix4();
+        for (std::size_t i = 0; i < 16; ++i)
+            REQUIRE(matrix.value.data[i] ==
+                    Catch::Approx(expected.value.data[i]).margin(1e-5));
+
+        const Vector3 point(x[8], x[9], x[7]);
+        requireNear(transform.transformPoint(point),
+                    transformByMatrix(expected, point));
+        requireNear(transform * point, transformByMatrix(expected, point));
+        requireNear(transform.transformDirection(point),
+                    transformByMatrix(expected, point) -
+                        transform.getTranslation());
+    }
+
+    CALCDA_REQUIRE_RANDOM(x, 17)
+    SECTION("combine and inverse") {
+        const auto parent = randomTransform(x, 0, Vector3(1.5f, 1.5f, 1.5f)),
+                   child = randomTransform(x, 7, Vector3(0.5f, 1.0f, 2.0f));
+        const Vector3 point(x[14], x[15], x[16]);
+
+        requireNear((parent * child).transformPoint(point),
+                    parent.transformPoint(child.transformPoint(point)));
+        requireNear((parent * child).transformPoint(point),
+                    transformByMatrix(parent.toMatrix4() * child.toMatrix4(),
+                                      point));
+
+        auto combined = parent;
+        combined *= child;
+        REQUIRE(combined == parent.combine(child));
+
+        requireNear(parent.inverse().transformPoint(
+                        parent.transformPoint(point)),
+                    point);
+        requireNear((parent * parent.inverse()).transformPoint(point), point);
+    }
+
+    SECTION("only the decomposition is stored") {
+        STATIC_REQUIRE(sizeof(Transform) ==
+                       2 * sizeof(Vector3) + sizeof(Quaternion));
+    }
+
+    CALCDA_REQUIRE_RANDOM(x, 7)
+    SECTION("the cached matrix is rebuilt after changes") {
+        CachedTransform transform(randomTransform(x, 0, Vector3::One));
+        const auto before = transform.toMatrix4();
+        REQUIRE(before == transform.getTransform().toMatrix4());
+        REQUIRE(&transform.toMatrix4() == &transform.toMatrix4());
+
+        transform.translate(Vector3(1.0f, 2.0f, 3.0f));
+        const auto &moved = transform.toMatrix4();
+        REQUIRE(moved.value.m03 == Catch::Approx(before.value.m03 + 1.0f));
+        REQUIRE(moved.value.m13 == Catch::Approx(before.value.m13 + 2.0f));
+        REQUIRE(moved.value.m23 == Catch::Approx(before.value.m23 + 3.0f));
+
+        transform.setScale(Vector3(2.0f, 2.0f, 2.0f));
+        REQUIRE(transform.toMatrix4().value.m00 ==
+                Catch::Approx(2.0f * before.value.m00));
+
+        transform.rotate(transform.getTransform().getRotation().conjugate());
+        REQUIRE(transform.toMatrix4().value.m00 == Catch::Approx(2.0f));
+
+        transform.setTransform(Transform::Identity);
+        REQUIRE(transform.toMatrix4() == Matrix4::Identity);
+        REQUIRE(CachedTransform().toMatrix4() == Matrix4::Identity);
+        REQUIRE(Transform::Identity.toMatrix4() == Matrix4::Identity);
+    }
+}
+
+TEST_CASE("Transform hierarchy", "Transform") {
+    using Calcda::Axis;
+
+    // two trees: 0 -> 1 -> 2, 1 -> 3, and 4 -> 5
+    TransformHierarchy hierarchy;
+    const std::size_t parents[] = {TransformHierarchy::NoParent, 0, 1, 1,
+                                   TransformHierarchy::NoParent, 4};
+    for (std::size_t i = 0; i < 6; ++i) {
+        const float offset = static_cast<float>(i);
+        hierarchy.add(Matrix4::translation(offset, 0.0f, 0.0f) *
+                          Matrix4::rotation(Axis::Z, 0.25 * offset),
+                      parents[i]);
+    }
+
+    const auto requireWorlds = [&]() {
+        for (std::size_t i = 0; i < hierarchy.size(); ++i) {
+            const auto parent = hierarchy.getParent(i);
+            const auto expected =
+                parent == TransformHierarchy::NoParent
+                    ? hierarchy.getLocal(i)
+                    : hierarchy.getWorld(parent) * hierarchy.getLocal(i);
+
+            for (std::size_t j = 0; j < 16; ++j)
+                REQUIRE(hierarchy.getWorld(i).value.data[j] ==
+                        Catch::Approx(expected.value.data[j]).margin(1e-5));
+        }
+    };
+
+    SECTION("only dirty subtrees are recomputed") {
+        REQUIRE(hierarchy.update() == 6);
+        requireWorlds();
+        REQUIRE(hierarchy.update() == 0);
+
+        hierarchy.setLocal(1, Transform(Vector3(0.0f, 2.0f, 0.0f)));
+        REQUIRE(hierarchy.update() == 3);
+        requireWorlds();
+
+        hierarchy.setLocal(2, Matrix4::scale(2.0f, 2.0f, 2.0f));
+        hierarchy.setLocal(5, Matrix4::Identity);
+        REQUIRE(hierarchy.update() == 2);
+        requireWorlds();
+
+        hierarchy.add(Matrix4::translation(1.0f, 1.0f, 1.0f), 3);
+        REQUIRE(hierarchy.update() == 1);
+        requireWorlds();
+    }
+
+    SECTION("parallel update") {
+        for (const unsigned int threads : {0U, 1U, 2U, 4U}) {
+            const float offset = static_cast<float>(threads);
+            hierarchy.setLocal(0, Matrix4::translation(0.0f, 0.0f, offset));
+            hierarchy.setLocal(4, Matrix4::translation(0.0f, offset, 0.0f));
+
+            REQUIRE(hierarchy.updateParallel(threads) == 6);
+            requireWorlds();
+            REQUIRE(hierarchy.updateParallel(threads) == 0);
+        }
+
+        hierarchy.add(Matrix4::Identity, TransformHierarchy::NoParent);
+        hierarchy.setLocal(3, Matrix4::Identity);
+        REQUIRE(hierarchy.updateParallel(2) == 2);
+        requireWorlds();
+    }
+}
+
+TEST_CASE("Parallel update of a single root", "Transform") {
+    using Calcda::Axis;
+
+    // one root with 64 children, each the top of a chain of 3 nodes
+    TransformHierarchy serial, parallel;
+    const auto add = [&](const Matrix4 &Local, std::size_t Parent) {
+        serial.add(Local, Parent);
+        return parallel.add(Local, Parent);
+    };
+
+    const auto root = add(Matrix4::translation(1.0f, 2.0f, 3.0f),
+                          TransformHierarchy::NoParent);
+    for (std::size_t i = 0; i < 64; ++i) {
+        const float offset = static_cast<float>(i);
+        auto node = add(Matrix4::rotation(Axis::Y, 0.1 * offset), root);
+        for (std::size_t j = 0; j < 2; ++j)
+            node = add(Matrix4::translation(offset, 0.0f, 1.0f), node);
+    }
+
+    const auto requireSame = [&]() {
+        for (std::size_t i = 0; i < serial.size(); ++i)
+            REQUIRE(parallel.getWorld(i) == serial.getWorld(i));
+    };
+
+    REQUIRE(parallel.updateParallel(4) == serial.update());
+    requireSame();
+
+    parallel.setLocal(root, Matrix4::scale(2.0f, 2.0f, 2.0f));
+    serial.setLocal(root, Matrix4::scale(2.0f, 2.0f, 2.0f));
+    for (std::size_t i = 5; i < serial.size(); i += 7) {
+        parallel.setLocal(i, Matrix4::rotation(Axis::X, 0.5));
+        serial.setLocal(i, Matrix4::rotation(Axis::X, 0.5));
+    }
+
+    for (const unsigned int threads : {3U, 8U}) {
+        REQUIRE(parallel.updateParallel(threads) == serial.update());
+        requireSame();
+
+        parallel.setLocal(1, Matrix4::Identity);
+        serial.setLocal(1, Matrix4::Identity);
+    }
+}
@@ -0,0 +1,115 @@
+#include <catch2/catch_all.hpp>
+
+#include "TriangleMesh.hpp"
+#include "random.hpp"
+
+#include <cmath>
+#include <vector>
+
+using Calcda::TriangleMesh;
+using Calcda::Vector3;
+using Calcda::Vector3SoA;
+
+TEST_CASE("Ray triangle intersection", "TriangleMesh") {
+    const Vector3 a(0.0f, 0.0f, 0.0f), b(2.0f, 0.0f, 0.0f), c(0.0f, 2.0f, 0.0f);
+
+    SECTION("single triangle") {
+        const auto hit = Calcda::intersectRayTriangle(
+            Vector3(0.5f, 1.0f, 3.0f), Vector3(0.0f, 0.0f, -2.0f), a, b, c);
+        REQUIRE(hit);
+        REQUIRE(hit->distance == Catch::Approx(1.5f));
+        REQUIRE(hit->u == Catch::Approx(0.25f));
+        REQUIRE(hit->v == Catch::Approx(0.5f));
+
+        // from behind, on an edge, past the end, outside, in the plane
+        REQUIRE(Calcda::intersectRayTriangle(Vector3(0.5f, 0.5f, -1.0f),
+                                             Vector3::UnitZ, a, b, c));
+        REQUIRE(Calcda::intersectRayTriangle(Vector3(1.0f, 0.0f, 1.0f),
+                                             -Vector3::UnitZ, a, b, c));
+        REQUIRE_FALSE(Calcda::intersectRayTriangle(
+            Vector3(0.5f, 0.5f, 3.0f), -Vector3::UnitZ, a, b, c, 2.0f));
+        REQUIRE_FALSE(Calcda::intersectRayTriangle(
+            Vector3(1.5f, 1.5f, 1.0f), -Vector3::UnitZ, a, b, c));
+        REQUIRE_FALSE(Calcda::intersectRayTriangle(
+            Vector3(-1.0f, 0.5f, 0.0f), Vector3::UnitX, a, b, c));
+        REQUIRE_FALSE(Calcda::intersectRayTriangle(
+            Vector3(0.5f, 0.5f, 1.0f), Vector3::UnitZ, a, b, c));
+    }
+
+    CALCDA_DEFINE_RANDOM(x)
+
+    CALCDA_REQUIRE_RANDOM(x, 9 * 300 + 6 * 37)
+    SECTION("mesh queries match testing every triangle") {
+        // 300 small triangles scattered in the cube from 1 to 20
+        std::vector<Vector3> vertices;
+        std::vector<std::uint32_t> indices;
+        for (std::size_t i = 0; i < 300; ++i) {
+            const float *values = x.data() + 9 * i;
+            const Vector3 center(values[0], values[1], values[2]);
+
+            for (std::size_t corner = 0; corner < 3; ++corner) {
+                indices.push_back(static_cast<std::uint32_t>(vertices.size()));
+                vertices.emplace_back(
+                    center.x + (values[3 + 2 * corner] - 10.5f) / 4.0f,
+                    center.y + (values[4 + 2 * corner] - 10.5f) / 4.0f,
+                    center.z + (values[3 + corner] - 10.5f) / 4.0f);
+            }
+        }
+
+        const TriangleMesh mesh(vertices, indices);
+        REQUIRE(mesh.triangleCount() == 300);
+        for (const auto &vertex : vertices)
+            REQUIRE(mesh.getBounds().containsPoint(vertex));
+
+        // 37 rays into the cube from one side, so some go through the tail
+        Vector3SoA origins, directions;
+        for (std::size_t i = 0; i < 37; ++i) {
+            const float *values = x.data() + 9 * 300 + 6 * i;
+            origins.append(Vector3(-5.0f, values[0], values[1]));
+            directions.append(Vector3(1.0f, (values[2] - 10.5f) / 40.0f,
+                                      (values[3] - 10.5f) / 40.0f));
+        }
+
+        std::vector<TriangleMesh::Hit> hits(origins.size());
+        mesh.intersectRays(origins, directions, hits.data(), 30.0f);
+
+        std::size_t hitCount = 0;
+        for (std::size_t i = 0; i < origins.size(); ++i) {
+            const auto origin = origins.get(i), direction = directions.get(i);
+
+            float expected = INFINITY;
+            for (std::size_t j = 0; j < 300; ++j) {
+                const auto hit = Calcda::intersectRayTriangle(
+                    origin, direction, vertices[3 * j], vertices[3 * j + 1],
+                    vertices[3 * j + 2], 30.0f);
+                if (hit)
+                    expected = std::min(expected, hit->distance);
+            }
+
+            const auto single = mesh.intersectRay(origin, direction, 30.0f);
+            REQUIRE(single.has_value() == std::isfinite(expected));
+            REQUIRE((hits[i].triangle == TriangleMesh::NoTriangle) ==
+                    !single.has_value());
+            if (!single) {
+                REQUIRE(std::isinf(hits[i].distance));
+                continue;
+            }
+
+            ++hitCount;
+            REQUIRE(single->distance == Catch::Approx(expected));
+            REQUIRE(hits[i].distance == Catch::Approx(expected));
+
+            // the reported triangle is hit at the reported distance
+            const auto check = Calcda::intersectRayTriangle(
+                origin, direction, vertices[3 * hits[i].triangle],
+                vertices[3 * hits[i].triangle + 1],
+                vertices[3 * hits[i].triangle + 2]);
+            REQUIRE(check);
+            REQUIRE(check->distance == Catch::Approx(hits[i].distance));
+            REQUIRE(check->u == Catch::Approx(hits[i].u).margin(1e-4));
+            REQUIRE(check->v == Catch::Approx(hits[i].v).margin(1e-4));
+        }
+
+        REQUIRE(hitCount > 0);
+    }
+}
@@ -162,4 +162,19 @@ TEST_CASE("Vector2 operations", "Vector2") {
         REQUIRE(Vector2::reflect(v1, v2) ==
                 Vector2(v1.x - 2.0f * dot * v2.x, v1.y - 2.0f * dot * v2.y));
     }
-}
\ No newline at end of file
+
+    CALCDA_REQUIRE_RANDOM(x, 2)
+    SECTION("double precision") {
+        using Calcda::Vector2d;
+
+        // 2^24 + 1 has no float representation
+        const Vector2d large(16777217.0, x[0]);
+        REQUIRE((large - Vector2d(16777216.0, 0.0)).x == 1.0);
+        REQUIRE(Vector2d(Vector2(x[0], x[1])) ==
+                Vector2d(static_cast<double>(x[0]), static_cast<double>(x[1])));
+        REQUIRE(Vector2(large).x == 16777216.0f);
+
+        const auto vec = Vector2d(x[0], x[1]).normalize();
+        REQUIRE(vec.length() == Approx(1.0).epsilon(1e-12));
+    }
+}
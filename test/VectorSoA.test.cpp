@@ -0,0 +1,91 @@
+#include <catch2/catch_all.hpp>
+
+#include "VectorSoA.hpp"
+#include "random.hpp"
+
+#include <algorithm>
+
+using Calcda::Vector3;
+using Calcda::Vector3SoA;
+
+TEST_CASE("Vector3SoA operations", "VectorSoA") {
+    using Catch::Approx;
+
+    CALCDA_DEFINE_RANDOM(x)
+
+    CALCDA_REQUIRE_RANDOM(x, 6 * 9)
+    SECTION("conversion and bulk operations") {
+        std::vector<Vector3> first, second;
+        for (std::size_t i = 0; i < 9; ++i) {
+            first.emplace_back(x[i * 6], x[i * 6 + 1], x[i * 6 + 2]);
+            second.emplace_back(x[i * 6 + 3], x[i * 6 + 4], x[i * 6 + 5]);
+        }
+
+        const Vector3SoA a = first, b = second;
+        REQUIRE(a.size() == first.size());
+        REQUIRE(a.toVector() == first);
+
+        std::vector<float> dots(a.size()), lengths(a.size());
+        Vector3SoA::dot(a, b, dots.data());
+        a.length(lengths.data());
+
+        Vector3SoA crosses(a.size()), minimums(a.size());
+        Vector3SoA::cross(a, b, crosses);
+        Vector3SoA::vmin(a, b, minimums);
+
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            REQUIRE(dots[i] == Approx(Vector3::dot(first[i], second[i])));
+            REQUIRE(lengths[i] == Approx(first[i].length()));
+            REQUIRE(minimums.get(i) == Vector3::vmin(first[i], second[i]));
+
+            // FMA contraction may round the SIMD and scalar paths differently
+            const auto cross = Vector3::cross(first[i], second[i]);
+            REQUIRE(crosses.get(i).x == Approx(cross.x).margin(1e-3));
+            REQUIRE(crosses.get(i).y == Approx(cross.y).margin(1e-3));
+            REQUIRE(crosses.get(i).z == Approx(cross.z).margin(1e-3));
+        }
+    }
+
+    SECTION("in-place lerp") {
+        Vector3SoA a = std::vector<Vector3>{{-1.0f, -1.0f, -1.0f}};
+        const Vector3SoA b = std::vector<Vector3>{{1.0f, 1.0f, 1.0f}};
+
+        Vector3SoA::lerp(a, b, 0.5f, a);
+        REQUIRE(a.get(0) == Vector3(0.0f, 0.0f, 0.0f));
+    }
+}
+
+TEST_CASE("Vector2SoA operations", "VectorSoA") {
+    using Calcda::Vector2;
+    using Calcda::Vector2SoA;
+    using Catch::Approx;
+
+    CALCDA_DEFINE_RANDOM(x)
+
+    CALCDA_REQUIRE_RANDOM(x, 4 * 9)
+    SECTION("conversion and bulk operations") {
+        std::vector<Vector2> first, second;
+        for (std::size_t i = 0; i < 9; ++i) {
+            first.emplace_back(x[i * 4], x[i * 4 + 1]);
+            second.emplace_back(x[i * 4 + 2], x[i * 4 + 3]);
+        }
+
+        const Vector2SoA a = first, b = second;
+        REQUIRE(a.size() == first.size());
+        REQUIRE(a.toVector() == first);
+
+        std::vector<float> dots(a.size()), lengths(a.size());
+        Vector2SoA::dot(a, b, dots.data());
+        a.length(lengths.data());
+
+        Vector2SoA maximums(a.size());
+        Vector2SoA::vmax(a, b, maximums);
+
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            REQUIRE(dots[i] == Approx(Vector2::dot(first[i], second[i])));
+            REQUIRE(lengths[i] == Approx(first[i].length()));
+            REQUIRE(maximums.get(i).x == std::max(first[i].x, second[i].x));
+            REQUIRE(maximums.get(i).y == std::max(first[i].y, second[i].y));
+        }
+    }
+}
@@ -4,7 +4,8 @@
 #include <random>
 #include <vector>
 
-std::vector<float> generateRandomFloats(unsigned count, float min, float max) {
+inline std::vector<float> generateRandomFloats(unsigned count, float min,
+                                               float max) {
     static std::random_device dev;
     static std::mt19937 gen(dev());
 